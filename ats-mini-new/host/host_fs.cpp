@@ -0,0 +1,104 @@
+// Host-native LittleFS: firmware paths are plain files under $ATS_HOST_FS (default ./host_fs).
+
+#include <LittleFS.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <string>
+
+fs::LittleFSFS LittleFS;
+
+namespace {
+
+bool g_mounted = false;
+
+std::string rootDir() {
+  const char* env = getenv("ATS_HOST_FS");
+  return env != nullptr && env[0] != '\0' ? std::string(env) : std::string("host_fs");
+}
+
+std::string hostPath(const char* path) {
+  std::string full = rootDir();
+  if (path == nullptr || path[0] != '/') {
+    full += '/';
+  }
+  if (path != nullptr) {
+    full += path;
+  }
+  return full;
+}
+
+}  // namespace
+
+namespace fs {
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+  return fp_ != nullptr ? fwrite(buffer, 1, size, fp_) : 0;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+  return fp_ != nullptr ? fread(buffer, 1, size, fp_) : 0;
+}
+
+size_t File::size() const {
+  if (fp_ == nullptr) {
+    return 0;
+  }
+  const long pos = ftell(fp_);
+  fseek(fp_, 0, SEEK_END);
+  const long end = ftell(fp_);
+  fseek(fp_, pos, SEEK_SET);
+  return end > 0 ? static_cast<size_t>(end) : 0;
+}
+
+void File::close() {
+  if (fp_ != nullptr) {
+    fclose(fp_);
+    fp_ = nullptr;
+  }
+}
+
+bool LittleFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel) {
+  (void)basePath;
+  (void)maxOpenFiles;
+  (void)partitionLabel;
+  struct stat st {};
+  const std::string root = rootDir();
+  if (stat(root.c_str(), &st) != 0) {
+    if (!formatOnFail || ::mkdir(root.c_str(), 0755) != 0) {
+      return false;
+    }
+  }
+  g_mounted = true;
+  return true;
+}
+
+bool LittleFSFS::format() {
+  // Only the directory itself is created; the harness points ATS_HOST_FS at a fresh directory.
+  return begin(true);
+}
+
+bool LittleFSFS::exists(const char* path) {
+  struct stat st {};
+  return g_mounted && stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool LittleFSFS::mkdir(const char* path) { return g_mounted && ::mkdir(hostPath(path).c_str(), 0755) == 0; }
+
+bool LittleFSFS::remove(const char* path) { return g_mounted && ::remove(hostPath(path).c_str()) == 0; }
+
+bool LittleFSFS::rename(const char* pathFrom, const char* pathTo) {
+  return g_mounted && ::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0;
+}
+
+File LittleFSFS::open(const char* path, const char* mode) {
+  if (!g_mounted) {
+    return File();
+  }
+  const char* hostMode = (mode != nullptr && mode[0] == 'w') ? "wb" : (mode != nullptr && mode[0] == 'a') ? "ab" : "rb";
+  return File(fopen(hostPath(path).c_str(), hostMode));
+}
+
+}  // namespace fs
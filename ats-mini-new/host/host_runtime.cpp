@@ -0,0 +1,221 @@
+// Host-native runtime: virtual clock, esp_timer and FreeRTOS placeholders for env:native.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <string.h>
+
+HostSerial Serial;
+TwoWire Wire;
+
+struct HostQueue {
+  uint8_t* storage;
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  UBaseType_t head;
+  UBaseType_t count;
+};
+
+struct esp_timer {
+  esp_timer_cb_t callback;
+  void* arg;
+  uint64_t periodUs;
+  int64_t nextUs;
+  bool running;
+};
+
+namespace {
+
+constexpr uint8_t kMaxHostTimers = 4;
+constexpr uint8_t kMaxHostSemaphores = 8;
+constexpr uint8_t kMaxHostQueues = 4;
+constexpr size_t kHostQueueBytes = 256;
+
+int64_t g_nowUs = 0;
+esp_timer g_timers[kMaxHostTimers];
+uint8_t g_timerCount = 0;
+HostSemaphore g_semaphores[kMaxHostSemaphores];
+uint8_t g_semaphoreCount = 0;
+uint32_t g_semaphoreTakes = 0;
+HostQueue g_queues[kMaxHostQueues];
+uint8_t g_queueStorage[kMaxHostQueues][kHostQueueBytes];
+uint8_t g_queueCount = 0;
+uint8_t g_pinLevels[64];
+
+void runDueTimers() {
+  for (uint8_t i = 0; i < g_timerCount; ++i) {
+    esp_timer& timer = g_timers[i];
+    // skip_unhandled_events semantics: at most one callback per timer per advance step.
+    if (timer.running && timer.nextUs <= g_nowUs) {
+      timer.nextUs = g_nowUs + static_cast<int64_t>(timer.periodUs);
+      timer.callback(timer.arg);
+    }
+  }
+}
+
+}  // namespace
+
+namespace host {
+
+void advanceUs(uint64_t us) {
+  const int64_t targetUs = g_nowUs + static_cast<int64_t>(us);
+  if (g_timerCount == 0) {
+    g_nowUs = targetUs;
+    return;
+  }
+  while (g_nowUs < targetUs) {
+    int64_t stepTo = targetUs;
+    for (uint8_t i = 0; i < g_timerCount; ++i) {
+      if (g_timers[i].running && g_timers[i].nextUs > g_nowUs && g_timers[i].nextUs < stepTo) {
+        stepTo = g_timers[i].nextUs;
+      }
+    }
+    g_nowUs = stepTo;
+    runDueTimers();
+  }
+}
+
+void advanceMs(uint32_t ms) { advanceUs(static_cast<uint64_t>(ms) * 1000U); }
+
+int64_t nowUs() { return g_nowUs; }
+
+uint32_t semaphoreTakes() { return g_semaphoreTakes; }
+
+}  // namespace host
+
+uint32_t millis() { return static_cast<uint32_t>(g_nowUs / 1000); }
+
+uint32_t micros() { return static_cast<uint32_t>(g_nowUs); }
+
+void delay(uint32_t ms) { host::advanceMs(ms); }
+
+void delayMicroseconds(uint32_t us) { host::advanceUs(us); }
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (pin < sizeof(g_pinLevels)) {
+    g_pinLevels[pin] = value;
+  }
+}
+
+int digitalRead(uint8_t pin) { return pin < sizeof(g_pinLevels) ? g_pinLevels[pin] : HIGH; }
+
+// Battery divider reading for a ~3.9 V cell (ui_service scales by 1.702 mV per count).
+uint16_t analogRead(uint8_t pin) {
+  (void)pin;
+  return 2300;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* outHandle) {
+  if (args == nullptr || outHandle == nullptr || args->callback == nullptr || g_timerCount >= kMaxHostTimers) {
+    return ESP_FAIL;
+  }
+  esp_timer& timer = g_timers[g_timerCount++];
+  timer.callback = args->callback;
+  timer.arg = args->arg;
+  timer.periodUs = 0;
+  timer.nextUs = 0;
+  timer.running = false;
+  *outHandle = &timer;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t periodUs) {
+  if (timer == nullptr || periodUs == 0) {
+    return ESP_FAIL;
+  }
+  timer->periodUs = periodUs;
+  timer->nextUs = g_nowUs + static_cast<int64_t>(periodUs);
+  timer->running = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+  if (timer == nullptr) {
+    return ESP_FAIL;
+  }
+  timer->running = false;
+  return ESP_OK;
+}
+
+int64_t esp_timer_get_time() { return g_nowUs; }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  if (g_semaphoreCount >= kMaxHostSemaphores) {
+    return nullptr;
+  }
+  HostSemaphore* sem = &g_semaphores[g_semaphoreCount++];
+  sem->depth = 0;
+  return sem;
+}
+
+// Nothing on the host ever waits on a fence (there are no tasks to signal one), so binary semaphores
+// share the mutex bookkeeping.
+SemaphoreHandle_t xSemaphoreCreateBinary() { return xSemaphoreCreateMutex(); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t timeout) {
+  (void)timeout;
+  if (sem == nullptr) {
+    return pdFALSE;
+  }
+  ++sem->depth;
+  ++g_semaphoreTakes;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+  if (sem == nullptr || sem->depth == 0) {
+    return pdFALSE;
+  }
+  --sem->depth;
+  return pdTRUE;
+}
+
+void vTaskDelay(TickType_t ticks) { host::advanceMs(ticks); }
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  if (g_queueCount >= kMaxHostQueues || length == 0 || itemSize == 0 ||
+      static_cast<size_t>(length) * itemSize > kHostQueueBytes) {
+    return nullptr;
+  }
+  HostQueue* queue = &g_queues[g_queueCount];
+  queue->storage = g_queueStorage[g_queueCount++];
+  queue->length = length;
+  queue->itemSize = itemSize;
+  queue->head = 0;
+  queue->count = 0;
+  return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t timeout) {
+  (void)timeout;
+  if (queue == nullptr || queue->count >= queue->length) {
+    return pdFALSE;
+  }
+  const UBaseType_t tail = (queue->head + queue->count) % queue->length;
+  memcpy(queue->storage + tail * queue->itemSize, item, queue->itemSize);
+  ++queue->count;
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t timeout) {
+  (void)timeout;
+  if (queue == nullptr || queue->count == 0) {
+    return pdFALSE;
+  }
+  memcpy(item, queue->storage + queue->head * queue->itemSize, queue->itemSize);
+  queue->head = (queue->head + 1) % queue->length;
+  --queue->count;
+  return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) { return queue == nullptr ? 0 : queue->count; }
@@ -0,0 +1,56 @@
+// Inert stand-ins for the hardware-facing services that env:native does not link
+// (input_service and settings_service need GPIO/NVS; ui_service runs on the host TFT framebuffer).
+
+#include <Arduino.h>
+
+#include "../include/app_services.h"
+
+namespace services::input {
+namespace {
+bool g_abortRequested = false;
+bool g_abortEventRequested = false;
+}  // namespace
+
+bool begin() { return true; }
+void tick() {}
+int8_t consumeEncoderDelta() { return 0; }
+bool consumeSingleClick() { return false; }
+bool consumeDoubleClick() { return false; }
+bool consumeTripleClick() { return false; }
+bool consumeLongPress() { return false; }
+bool consumeVeryLongPress() { return false; }
+bool isButtonHeld() { return false; }
+void setMultiClickWindowMs(uint32_t windowMs) { (void)windowMs; }
+
+void clearAbortRequest() {
+  g_abortRequested = false;
+  g_abortEventRequested = false;
+}
+
+void requestAbortEvent() {
+  g_abortRequested = true;
+  g_abortEventRequested = true;
+}
+
+bool consumeAbortRequest() {
+  const bool requested = g_abortRequested;
+  g_abortRequested = false;
+  return requested;
+}
+
+bool consumeAbortEventRequest() {
+  const bool requested = g_abortEventRequested;
+  g_abortEventRequested = false;
+  return requested;
+}
+}  // namespace services::input
+
+namespace services::settings {
+bool begin() { return true; }
+bool load(app::AppState& state) {
+  state = app::makeDefaultState();
+  return false;
+}
+void markDirty() {}
+void tick(const app::AppState& state) { (void)state; }
+}  // namespace services::settings
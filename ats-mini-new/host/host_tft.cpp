@@ -0,0 +1,325 @@
+// Host-native TFT_eSPI: an RGB565 panel buffer plus sprites that push into it.
+
+#include <TFT_eSPI.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+uint16_t g_panel[host::kTftWidth * host::kTftHeight];
+constexpr uint8_t kMaxSprites = 4;
+const uint16_t* g_sprites[kMaxSprites] = {};
+uint8_t g_spriteCount = 0;
+uint32_t g_pixelsPushed = 0;
+
+int32_t glyphWidth(uint8_t font, char ch) {
+  switch (font) {
+    case 2:
+      return 8;
+    case 4:
+      return 14;
+    case 7:
+      return (ch == '.' || ch == ':') ? 12 : 32;
+    default:
+      return 6;
+  }
+}
+
+}  // namespace
+
+TFT_eSPI::TFT_eSPI() : TFT_eSPI(g_panel, host::kTftWidth, host::kTftHeight) {}
+
+TFT_eSPI::TFT_eSPI(uint16_t* buffer, int32_t width, int32_t height)
+    : buffer_(buffer), width_(width), height_(height), vpW_(width), vpH_(height) {}
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+  vpX_ = x;
+  vpY_ = y;
+  vpW_ = w;
+  vpH_ = h;
+  originX_ = vpDatum ? x : 0;
+  originY_ = vpDatum ? y : 0;
+}
+
+void TFT_eSPI::resetViewport() {
+  vpX_ = 0;
+  vpY_ = 0;
+  vpW_ = width_;
+  vpH_ = height_;
+  originX_ = 0;
+  originY_ = 0;
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  x += originX_;
+  y += originY_;
+  if (buffer_ == nullptr || x < vpX_ || y < vpY_ || x >= vpX_ + vpW_ || y >= vpY_ + vpH_ || x < 0 || y < 0 ||
+      x >= width_ || y >= height_) {
+    return;
+  }
+  buffer_[y * width_ + x] = static_cast<uint16_t>(color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  for (int32_t i = 0; i < w; ++i) {
+    drawPixel(x + i, y, color);
+  }
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  for (int32_t i = 0; i < h; ++i) {
+    drawPixel(x, y + i, color);
+  }
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  const int32_t dx = abs(x1 - x0);
+  const int32_t dy = -abs(y1 - y0);
+  const int32_t sx = x0 < x1 ? 1 : -1;
+  const int32_t sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+  while (true) {
+    drawPixel(x0, y0, color);
+    if (x0 == x1 && y0 == y1) {
+      return;
+    }
+    const int32_t e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  for (int32_t row = 0; row < h; ++row) {
+    drawFastHLine(x, y + row, w, color);
+  }
+}
+
+bool TFT_eSPI::roundRectContains(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, int32_t px, int32_t py) const {
+  if (px < x || py < y || px >= x + w || py >= y + h) {
+    return false;
+  }
+  const int32_t cx = px < x + r ? x + r : (px >= x + w - r ? x + w - 1 - r : px);
+  const int32_t cy = py < y + r ? y + r : (py >= y + h - r ? y + h - 1 - r : py);
+  const int32_t ddx = px - cx;
+  const int32_t ddy = py - cy;
+  return ddx * ddx + ddy * ddy <= r * r;
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  for (int32_t py = y; py < y + h; ++py) {
+    for (int32_t px = x; px < x + w; ++px) {
+      if (roundRectContains(x, y, w, h, r, px, py) &&
+          (!roundRectContains(x, y, w, h, r, px - 1, py) || !roundRectContains(x, y, w, h, r, px + 1, py) ||
+           !roundRectContains(x, y, w, h, r, px, py - 1) || !roundRectContains(x, y, w, h, r, px, py + 1))) {
+        drawPixel(px, py, color);
+      }
+    }
+  }
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  for (int32_t py = y; py < y + h; ++py) {
+    for (int32_t px = x; px < x + w; ++px) {
+      if (roundRectContains(x, y, w, h, r, px, py)) {
+        drawPixel(px, py, color);
+      }
+    }
+  }
+}
+
+void TFT_eSPI::drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+  int32_t px = r;
+  int32_t py = 0;
+  int32_t err = 1 - r;
+  while (px >= py) {
+    drawPixel(x + px, y + py, color);
+    drawPixel(x - px, y + py, color);
+    drawPixel(x + px, y - py, color);
+    drawPixel(x - px, y - py, color);
+    drawPixel(x + py, y + px, color);
+    drawPixel(x - py, y + px, color);
+    drawPixel(x + py, y - px, color);
+    drawPixel(x - py, y - px, color);
+    ++py;
+    if (err < 0) {
+      err += 2 * py + 1;
+    } else {
+      --px;
+      err += 2 * (py - px) + 1;
+    }
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+  for (int32_t dy = -r; dy <= r; ++dy) {
+    for (int32_t dx = -r; dx <= r; ++dx) {
+      if (dx * dx + dy * dy <= r * r) {
+        drawPixel(x + dx, y + dy, color);
+      }
+    }
+  }
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+  const int32_t minX = x0 < x1 ? (x0 < x2 ? x0 : x2) : (x1 < x2 ? x1 : x2);
+  const int32_t maxX = x0 > x1 ? (x0 > x2 ? x0 : x2) : (x1 > x2 ? x1 : x2);
+  const int32_t minY = y0 < y1 ? (y0 < y2 ? y0 : y2) : (y1 < y2 ? y1 : y2);
+  const int32_t maxY = y0 > y1 ? (y0 > y2 ? y0 : y2) : (y1 > y2 ? y1 : y2);
+  const int32_t area = (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
+  for (int32_t py = minY; py <= maxY; ++py) {
+    for (int32_t px = minX; px <= maxX; ++px) {
+      int32_t w0 = (x1 - x0) * (py - y0) - (y1 - y0) * (px - x0);
+      int32_t w1 = (x2 - x1) * (py - y1) - (y2 - y1) * (px - x1);
+      int32_t w2 = (x0 - x2) * (py - y2) - (y0 - y2) * (px - x2);
+      if (area < 0) {
+        w0 = -w0;
+        w1 = -w1;
+        w2 = -w2;
+      }
+      if (w0 >= 0 && w1 >= 0 && w2 >= 0) {
+        drawPixel(px, py, color);
+      }
+    }
+  }
+}
+
+void TFT_eSPI::setTextColor(uint16_t fgColor, uint16_t bgColor, bool bgFill) {
+  (void)bgFill;
+  textColor_ = fgColor;
+  textBgColor_ = bgColor;
+}
+
+int16_t TFT_eSPI::textWidth(const char* text, uint8_t font) {
+  int32_t width = 0;
+  for (const char* p = text; p != nullptr && *p != '\0'; ++p) {
+    width += glyphWidth(font, *p);
+  }
+  return static_cast<int16_t>(width);
+}
+
+int16_t TFT_eSPI::fontHeight(int16_t font) {
+  switch (font) {
+    case 2:
+      return 16;
+    case 4:
+      return 26;
+    case 7:
+      return 48;
+    default:
+      return 8;
+  }
+}
+
+int16_t TFT_eSPI::drawString(const char* text, int32_t x, int32_t y, uint8_t font) {
+  const int32_t w = textWidth(text, font);
+  const int32_t h = fontHeight(font);
+  const uint8_t column = textDatum_ % 3;
+  const uint8_t row = textDatum_ / 3;
+  int32_t cellX = column == 0 ? x : (column == 1 ? x - (w / 2) : x - w);
+  const int32_t cellY = row == 0 ? y : (row == 1 ? y - (h / 2) : y - h);
+
+  for (const char* p = text; p != nullptr && *p != '\0'; ++p) {
+    const uint8_t ch = static_cast<uint8_t>(*p);
+    const int32_t cw = glyphWidth(font, *p);
+    for (int32_t gy = 0; gy < h; ++gy) {
+      for (int32_t gx = 0; gx < cw; ++gx) {
+        const bool ink = gx < cw - 1 && gy < h - 1 && ch != ' ' && ((ch * 7 + gy * 3 + gx * 5) % 4) == 0;
+        if (ink) {
+          drawPixel(cellX + gx, cellY + gy, textColor_);
+        } else if (textBgColor_ != textColor_) {
+          drawPixel(cellX + gx, cellY + gy, textBgColor_);
+        }
+      }
+    }
+    cellX += cw;
+  }
+  return static_cast<int16_t>(w);
+}
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(nullptr, 0, 0), tft_(tft) {}
+
+TFT_eSprite::~TFT_eSprite() { deleteSprite(); }
+
+void* TFT_eSprite::createSprite(int16_t width, int16_t height, uint8_t frames) {
+  (void)frames;
+  deleteSprite();
+  buffer_ = static_cast<uint16_t*>(calloc(static_cast<size_t>(width) * height, sizeof(uint16_t)));
+  if (buffer_ == nullptr) {
+    return nullptr;
+  }
+  width_ = width;
+  height_ = height;
+  resetViewport();
+  if (g_spriteCount < kMaxSprites) {
+    g_sprites[g_spriteCount++] = buffer_;
+  }
+  return buffer_;
+}
+
+void TFT_eSprite::deleteSprite() {
+  for (uint8_t i = 0; i < g_spriteCount; ++i) {
+    if (buffer_ != nullptr && g_sprites[i] == buffer_) {
+      g_sprites[i] = nullptr;
+    }
+  }
+  free(buffer_);
+  buffer_ = nullptr;
+  width_ = 0;
+  height_ = 0;
+}
+
+void TFT_eSprite::fillSprite(uint32_t color) {
+  fillRect(vpX_ - originX_, vpY_ - originY_, vpW_, vpH_, color);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  pushSprite(x, y, 0, 0, width_, height_);
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+  if (buffer_ == nullptr || tft_ == nullptr || tft_->buffer_ == nullptr) {
+    return false;
+  }
+  for (int32_t row = 0; row < sh; ++row) {
+    const int32_t srcY = sy + row;
+    const int32_t dstY = ty + row;
+    if (srcY < 0 || srcY >= height_ || dstY < 0 || dstY >= tft_->height_) {
+      continue;
+    }
+    for (int32_t col = 0; col < sw; ++col) {
+      const int32_t srcX = sx + col;
+      const int32_t dstX = tx + col;
+      if (srcX < 0 || srcX >= width_ || dstX < 0 || dstX >= tft_->width_) {
+        continue;
+      }
+      tft_->buffer_[dstY * tft_->width_ + dstX] = buffer_[srcY * width_ + srcX];
+      ++g_pixelsPushed;
+    }
+  }
+  return true;
+}
+
+namespace host {
+
+const uint16_t* tftPanel() { return g_panel; }
+
+const uint16_t* tftSpriteFrame(uint8_t index) { return index < g_spriteCount ? g_sprites[index] : nullptr; }
+
+uint32_t tftPixelsPushed() { return g_pixelsPushed; }
+
+}  // namespace host
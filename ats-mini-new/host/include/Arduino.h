@@ -0,0 +1,71 @@
+#pragma once
+
+// Minimal Arduino core surface for the host-native build (env:native).
+// Time is virtual: millis()/micros() only move when delay() or host::advanceMs() is called,
+// so scan and RDS timing is deterministic and runs as fast as the host CPU allows.
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define IRAM_ATTR
+#define PROGMEM
+
+// The ESP32 core exposes the std:: versions for C++ sources.
+using std::max;
+using std::min;
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+// esp32-hal-psram.h: the host heap stands in for the 8 MB OPI PSRAM of the ATS-Mini.
+inline bool psramFound() { return true; }
+inline void* ps_malloc(size_t size) { return malloc(size); }
+inline void* ps_realloc(void* ptr, size_t size) { return realloc(ptr, size); }
+
+class HostSerial {
+ public:
+  void begin(uint32_t) {}
+  void print(const char* text) { fputs(text, stdout); }
+  void println(const char* text = "") {
+    fputs(text, stdout);
+    fputc('\n', stdout);
+  }
+  int printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    const int written = vprintf(format, args);
+    va_end(args);
+    return written;
+  }
+};
+
+extern HostSerial Serial;
+
+namespace host {
+// Advance the virtual clock, firing any due esp_timer callbacks on the way.
+void advanceMs(uint32_t ms);
+void advanceUs(uint64_t us);
+int64_t nowUs();
+}  // namespace host
@@ -0,0 +1,58 @@
+#pragma once
+
+// File-backed stand-in for the ESP32 LittleFS/FS API subset the firmware uses (env:native).
+// Firmware paths map under a host directory: $ATS_HOST_FS, or ./host_fs when unset.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+namespace fs {
+
+class File {
+ public:
+  File() = default;
+  explicit File(FILE* fp) : fp_(fp) {}
+  File(File&& other) noexcept : fp_(other.fp_) { other.fp_ = nullptr; }
+  File& operator=(File&& other) noexcept {
+    if (this != &other) {
+      close();
+      fp_ = other.fp_;
+      other.fp_ = nullptr;
+    }
+    return *this;
+  }
+  File(const File&) = delete;
+  File& operator=(const File&) = delete;
+  ~File() { close(); }
+
+  size_t write(const uint8_t* buffer, size_t size);
+  size_t read(uint8_t* buffer, size_t size);
+  size_t size() const;
+  void close();
+  explicit operator bool() const { return fp_ != nullptr; }
+
+ private:
+  FILE* fp_ = nullptr;
+};
+
+class LittleFSFS {
+ public:
+  bool begin(bool formatOnFail = false,
+             const char* basePath = "/littlefs",
+             uint8_t maxOpenFiles = 10,
+             const char* partitionLabel = "spiffs");
+  void end() {}
+  bool format();
+  bool exists(const char* path);
+  bool mkdir(const char* path);
+  bool remove(const char* path);
+  bool rename(const char* pathFrom, const char* pathTo);
+  File open(const char* path, const char* mode = "r");
+};
+
+}  // namespace fs
+
+using fs::File;
+
+extern fs::LittleFSFS LittleFS;
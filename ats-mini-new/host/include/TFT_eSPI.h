@@ -0,0 +1,117 @@
+#pragma once
+
+// Framebuffer stand-in for the TFT_eSPI subset ui_service uses (env:native).
+// TFT_eSPI draws straight into a 320x170 RGB565 panel buffer; TFT_eSprite draws into its own buffer and
+// pushSprite() copies into the panel. Shapes and viewport clipping follow TFT_eSPI. Glyphs are
+// deterministic placeholder patterns with approximate cell metrics, not the real fonts, which is enough
+// to diff a partial redraw against a full one on the host.
+
+#include <stdint.h>
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+#define TFT_DARKGREY 0x7BEF
+#define TFT_YELLOW 0xFFE0
+#define TFT_RED 0xF800
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+class TFT_eSprite;
+
+class TFT_eSPI {
+ public:
+  TFT_eSPI();
+  virtual ~TFT_eSPI() = default;
+
+  void begin() {}
+  void setRotation(uint8_t rotation) { (void)rotation; }
+  void setSwapBytes(bool swap) { (void)swap; }
+  int16_t width() const { return static_cast<int16_t>(width_); }
+  int16_t height() const { return static_cast<int16_t>(height_); }
+
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+  void resetViewport();
+
+  void fillScreen(uint32_t color) { fillRect(0, 0, width_, height_, color); }
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+
+  void setTextColor(uint16_t color) { setTextColor(color, color); }
+  void setTextColor(uint16_t fgColor, uint16_t bgColor, bool bgFill = false);
+  void setTextDatum(uint8_t datum) { textDatum_ = datum; }
+  void setTextFont(uint8_t font) { textFont_ = font; }
+  int16_t textWidth(const char* text) { return textWidth(text, textFont_); }
+  int16_t textWidth(const char* text, uint8_t font);
+  int16_t fontHeight() { return fontHeight(textFont_); }
+  int16_t fontHeight(int16_t font);
+  int16_t drawString(const char* text, int32_t x, int32_t y) { return drawString(text, x, y, textFont_); }
+  int16_t drawString(const char* text, int32_t x, int32_t y, uint8_t font);
+
+ protected:
+  TFT_eSPI(uint16_t* buffer, int32_t width, int32_t height);
+
+  bool roundRectContains(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, int32_t px, int32_t py) const;
+
+  uint16_t* buffer_;
+  int32_t width_;
+  int32_t height_;
+
+ private:
+  friend class TFT_eSprite;
+
+  int32_t vpX_ = 0;
+  int32_t vpY_ = 0;
+  int32_t vpW_;
+  int32_t vpH_;
+  int32_t originX_ = 0;
+  int32_t originY_ = 0;
+  uint16_t textColor_ = TFT_WHITE;
+  uint16_t textBgColor_ = TFT_BLACK;
+  uint8_t textDatum_ = TL_DATUM;
+  uint8_t textFont_ = 1;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+ public:
+  explicit TFT_eSprite(TFT_eSPI* tft);
+  ~TFT_eSprite() override;
+
+  void* createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+  void deleteSprite();
+  void* getPointer() { return buffer_; }
+  void fillSprite(uint32_t color);
+  void pushSprite(int32_t x, int32_t y);
+  bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+ private:
+  TFT_eSPI* tft_;
+};
+
+namespace host {
+constexpr int32_t kTftWidth = 320;
+constexpr int32_t kTftHeight = 170;
+
+// Panel contents as last pushed, row-major kTftWidth x kTftHeight.
+const uint16_t* tftPanel();
+// Buffer of the index-th sprite created, in creation order (ui_service: 0 composes, 1 is the front buffer).
+const uint16_t* tftSpriteFrame(uint8_t index = 0);
+// Pixels written to the panel by pushSprite() since start.
+uint32_t tftPixelsPushed();
+}  // namespace host
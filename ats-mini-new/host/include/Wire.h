@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdint.h>
+
+class TwoWire {
+ public:
+  bool begin(int sda = -1, int scl = -1) {
+    (void)sda;
+    (void)scl;
+    return true;
+  }
+};
+
+extern TwoWire Wire;
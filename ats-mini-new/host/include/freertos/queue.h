@@ -0,0 +1,13 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// Fixed-size FIFO with the FreeRTOS call shapes. Timeouts are ignored: with no scheduler a receive on an
+// empty queue and a send to a full one fail immediately.
+struct HostQueue;
+typedef HostQueue* QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t timeout);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t timeout);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
@@ -0,0 +1,1759 @@
+// env:native entry point: drives the service layer against the simulated tuner.
+//
+//   .pio/build/native/program [scans]
+//   .pio/build/native/program bench
+//   .pio/build/native/program replay <trace>
+//
+// Runs repeated ETM scans (every ScanSpeed) on the built-in FM, MW and SW scenarios, a bandscope fill
+// check, a multi-band batch scan, station-store scaling, off-raster SW peak fitting, scan resume after a
+// cancel, memory vs hardware seek, the scan accuracy benchmark, an idle-listen RSQ traffic check, one RDS acquisition, radio worker queue checks, the
+// ETM identify pass and a scripted UI session, printing one key=value line per run so results can be diffed between builds.
+// "bench" runs only the scan accuracy benchmark; "replay" decodes a recorded RDS trace (/rds/trace.bin or a
+// serial capture of "rdstrace dump") through the RDS service and prints one line per tuned segment.
+
+#include <Arduino.h>
+
+#include <LittleFS.h>
+#include <TFT_eSPI.h>
+#include <freertos/semphr.h>
+
+#include <chrono>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/aie_engine.h"
+#include "../include/app_config.h"
+#include "../include/app_services.h"
+#include "../include/bandplan.h"
+#include "../include/tuner_sim.h"
+
+namespace {
+
+namespace sim = services::radio::sim;
+
+constexpr uint32_t kLoopStepMs = 1;
+constexpr uint32_t kRdsRunMs = 10000;
+// runListen polls radio::readSignalQuality at the ui_service signal meter cadence instead of rendering.
+constexpr uint32_t kUiSignalPollMs = 80;
+
+app::AppState g_state = app::makeDefaultState();
+// Checks that must hold on every run (trace replay matches, partial frames equal full redraws); main()
+// exits non-zero when any failed.
+uint32_t g_failedChecks = 0;
+
+uint8_t bandIndexFor(app::BandId id) {
+  for (uint8_t i = 0; i < app::kBandCount; ++i) {
+    if (app::kBandPlan[i].id == id) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+// Same service ordering as loop() in main.cpp, without input and rendering.
+void stepLoop() {
+  services::seekscan::syncContext(g_state);
+  services::etm::syncContext(g_state);
+  services::aie::tick(g_state);
+  if (services::etm::busy()) {
+    services::etm::tick(g_state);
+  } else if (services::seekscan::busy()) {
+    services::seekscan::tick(g_state);
+  } else {
+    services::etm::tickBackgroundRefresh(g_state);
+  }
+  services::radio::tick();
+  services::rds::tick(g_state);
+  services::af::tick(g_state);
+  services::rdscache::tick();
+  services::clock::tick(g_state);
+  host::advanceMs(kLoopStepMs);
+}
+
+void selectBand(app::BandId id, app::Modulation modulation, uint16_t frequencyKhz) {
+  g_state.radio.bandIndex = bandIndexFor(id);
+  g_state.radio.modulation = modulation;
+  g_state.radio.frequencyKhz = frequencyKhz;
+  g_state.radio.amStepKhz = app::defaultMwStepKhzForRegion(g_state.global.fmRegion);
+  services::radio::apply(g_state);
+  services::radio::applyRuntimeSettings(g_state);
+  services::etm::syncContext(g_state);
+}
+
+constexpr uint8_t kScanSpeedCount = static_cast<uint8_t>(app::ScanSpeed::Hybrid) + 1;
+const char* const kSpeedNames[kScanSpeedCount] = {"fast", "thorough", "hybrid"};
+
+// found[speed] receives the last scan's station count for each speed.
+void runScans(const char* label, uint32_t scans, bool adaptiveSettle, uint16_t found[kScanSpeedCount]) {
+  services::etm::setAdaptiveSettle(adaptiveSettle);
+  for (uint8_t speed = 0; speed <= static_cast<uint8_t>(app::ScanSpeed::Hybrid); ++speed) {
+    g_state.global.scanSpeed = static_cast<app::ScanSpeed>(speed);
+    sim::resetStats();
+    const uint32_t startMs = millis();
+    const auto hostStart = std::chrono::steady_clock::now();
+    uint32_t completed = 0;
+    for (uint32_t i = 0; i < scans; ++i) {
+      if (!services::etm::requestScan(g_state)) {
+        break;
+      }
+      while (services::etm::busy()) {
+        stepLoop();
+      }
+      ++completed;
+    }
+    const auto hostUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - hostStart).count();
+    const sim::SimStats& st = sim::stats();
+    const uint32_t virtualMs = millis() - startMs;
+    Serial.printf("scan band=%s speed=%s settle=%s scans=%lu found=%u points=%u last_scan_ms=%lu "
+                  "virtual_ms_per_scan=%lu tunes=%lu rsq_reads=%lu seek_steps=%lu host_us=%lld scans_per_s=%.1f\n",
+                  label,
+                  kSpeedNames[speed],
+                  adaptiveSettle ? "adaptive" : "fixed",
+                  static_cast<unsigned long>(completed),
+                  g_state.seekScan.foundCount,
+                  g_state.seekScan.totalPoints,
+                  static_cast<unsigned long>(g_state.seekScan.scanDurationMs),
+                  static_cast<unsigned long>(completed > 0 ? virtualMs / completed : 0),
+                  static_cast<unsigned long>(st.tunes),
+                  static_cast<unsigned long>(st.rsqReads),
+                  static_cast<unsigned long>(st.seekSteps),
+                  static_cast<long long>(hostUs),
+                  hostUs > 0 ? static_cast<double>(completed) * 1e6 / static_cast<double>(hostUs) : 0.0);
+    found[speed] = g_state.seekScan.foundCount;
+  }
+}
+
+// Adaptive settle only shortens waits; a station it loses against fixed settle fails the run.
+void runSettleScans(const char* label, uint32_t scans) {
+  uint16_t fixedFound[kScanSpeedCount] = {};
+  uint16_t adaptiveFound[kScanSpeedCount] = {};
+  runScans(label, scans, false, fixedFound);
+  runScans(label, scans, true, adaptiveFound);
+  for (uint8_t speed = 0; speed < kScanSpeedCount; ++speed) {
+    const bool ok = adaptiveFound[speed] >= fixedFound[speed];
+    Serial.printf("settle_check band=%s speed=%s fixed=%u adaptive=%u ok=%d\n",
+                  label,
+                  kSpeedNames[speed],
+                  fixedFound[speed],
+                  adaptiveFound[speed],
+                  ok ? 1 : 0);
+    if (!ok) {
+      ++g_failedChecks;
+    }
+  }
+}
+
+// Squelch closed over the whole FM band (UI maximum): the radio is silent without a user mute.
+constexpr uint8_t kHostSquelchShut = 63;
+
+void setHostSquelch(uint8_t squelch) {
+  g_state.global.squelch = squelch;
+  services::radio::applyRuntimeSettings(g_state);
+}
+
+enum class RefreshAudio : uint8_t { Audible, Muted, Squelched };
+
+// Scan FM, then take one transmitter off air and keep listening: background refresh should age it
+// out of ETM memory. Every probe retunes away and back, so slices = probe tunes / 2. A user mute keeps
+// the audible cadence (rds_ps: the listening station's PS was acquired and kept), a closed squelch the
+// silent one.
+void runRefresh(uint32_t minutes, RefreshAudio audio) {
+  const sim::SimScenario& base = sim::defaultFmScenario();
+  static sim::SimCarrier faded[16];
+  uint8_t fadedCount = 0;
+  for (uint8_t i = 0; i < base.carrierCount && fadedCount < 16; ++i) {
+    if (base.carriers[i].frequencyKhz != 10210) {
+      faded[fadedCount++] = base.carriers[i];
+    }
+  }
+  sim::SimScenario offAir = base;
+  offAir.carriers = faded;
+  offAir.carrierCount = fadedCount;
+
+  sim::loadScenario(base);
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  g_state.global.scanSpeed = app::ScanSpeed::Thorough;
+  if (!services::etm::requestScan(g_state)) {
+    return;
+  }
+  while (services::etm::busy()) {
+    stepLoop();
+  }
+  const uint8_t before = g_state.seekScan.foundCount;
+  const uint16_t listenKhz = g_state.radio.frequencyKhz;
+
+  sim::loadScenario(offAir);
+  g_state.ui.muted = audio == RefreshAudio::Muted;
+  services::radio::setMuted(g_state.ui.muted);
+  if (audio == RefreshAudio::Squelched) {
+    setHostSquelch(kHostSquelchShut);
+  }
+  const uint32_t startMs = millis();
+  uint32_t agedOutMs = 0;
+  while (millis() - startMs < minutes * 60000UL) {
+    stepLoop();
+    if (agedOutMs == 0 && g_state.seekScan.foundCount < before) {
+      agedOutMs = millis() - startMs;
+    }
+  }
+  const bool psKept = g_state.rds.hasPs != 0;
+  g_state.ui.muted = false;
+  services::radio::setMuted(false);
+  if (audio == RefreshAudio::Squelched) {
+    setHostSquelch(0);
+  }
+  const sim::SimStats& st = sim::stats();
+  Serial.printf("refresh band=FM audio=%s minutes=%lu listen=%u found_before=%u found_after=%u aged_out_ms=%lu "
+                "slices=%lu rds_ps=%u\n",
+                audio == RefreshAudio::Muted ? "muted" : (audio == RefreshAudio::Squelched ? "squelched" : "audible"),
+                static_cast<unsigned long>(minutes),
+                listenKhz,
+                before,
+                g_state.seekScan.foundCount,
+                static_cast<unsigned long>(agedOutMs),
+                static_cast<unsigned long>(st.tunes / 2),
+                psKept ? 1U : 0U);
+}
+
+// Flip one byte of a cache file in place (host path under $ATS_HOST_FS).
+// Bandscope after one FM scan: columns covered and the strongest column against the station the scan
+// settled on, then a squelched listen during which background refresh walks the band into the scope.
+void runBandscope(uint32_t listenSeconds) {
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  g_state.global.scanSpeed = app::ScanSpeed::Fast;
+  if (!services::etm::requestScan(g_state)) {
+    return;
+  }
+  while (services::etm::busy()) {
+    stepLoop();
+  }
+  const app::EtmBandscope* scope = services::etm::bandscope();
+  if (scope == nullptr) {
+    Serial.printf("bandscope band=FM columns=0\n");
+    return;
+  }
+  uint16_t peak = 0;
+  for (uint16_t c = 1; c < app::kBandscopeColumns; ++c) {
+    if (scope->rssi[c] != app::kBandscopeUnmeasured && scope->rssi[c] > scope->rssi[peak]) {
+      peak = c;
+    }
+  }
+  const uint32_t span = static_cast<uint32_t>(scope->maxKhz - scope->minKhz);
+  const uint16_t peakKhz = static_cast<uint16_t>(scope->minKhz + (peak * span + span / 2) / app::kBandscopeColumns);
+  const uint16_t columns = scope->measuredColumns;
+  const uint16_t scanKhz = g_state.radio.frequencyKhz;
+
+  const uint16_t generation = scope->generation;
+  sim::resetStats();
+  setHostSquelch(kHostSquelchShut);
+  const uint32_t startMs = millis();
+  while (millis() - startMs < listenSeconds * 1000UL) {
+    stepLoop();
+  }
+  setHostSquelch(0);
+  Serial.printf("bandscope band=FM columns=%u/%u peak_khz=%u tuned_khz=%u listen_s=%lu updates=%u probes=%lu\n",
+                columns,
+                static_cast<unsigned>(app::kBandscopeColumns),
+                peakKhz,
+                scanKhz,
+                static_cast<unsigned long>(listenSeconds),
+                static_cast<unsigned>(static_cast<uint16_t>(scope->generation - generation)),
+                static_cast<unsigned long>(sim::stats().tunes / 2));
+}
+
+// Batch scan of FM and every broadcast band against one scenario holding the FM, MW and 49m carriers (the
+// FM table also reads as wide 31m carriers around 9580/9600 kHz). Reports tuner reconfigurations against
+// bands scanned, the ETA published early and half way, and whether next/prev cross band edges in the index.
+// FM, MW and SW default carriers in one scenario, for the batch runs.
+void loadMixedScenario() {
+  static sim::SimCarrier carriers[32];
+  uint8_t count = 0;
+  const sim::SimScenario* parts[] = {&sim::defaultFmScenario(), &sim::defaultMwScenario(), &sim::defaultSwScenario()};
+  for (const sim::SimScenario* part : parts) {
+    for (uint8_t i = 0; i < part->carrierCount && count < 32; ++i) carriers[count++] = part->carriers[i];
+  }
+  sim::SimScenario mixed = sim::defaultSwScenario();
+  mixed.carriers = carriers;
+  mixed.carrierCount = count;
+  sim::loadScenario(mixed);
+}
+
+void runBatch() {
+  loadMixedScenario();
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  g_state.global.scanSpeed = app::ScanSpeed::Fast;
+  const uint8_t startBand = g_state.radio.bandIndex;
+  const uint16_t startKhz = g_state.radio.frequencyKhz;
+  services::radio::resetWorkerStats();
+  const uint32_t startMs = millis();
+  const uint32_t mask = app::broadcastBandMask() | app::bandMaskBit(bandIndexFor(app::BandId::FM));
+  if (!services::etm::requestBatchScan(g_state, mask)) {
+    Serial.printf("batch started=0\n");
+    return;
+  }
+  uint8_t bands = 0;
+  uint32_t etaEarlyMs = 0;
+  uint32_t etaHalfMs = 0;
+  uint32_t halfAtMs = 0;
+  while (services::etm::busy()) {
+    stepLoop();
+    const uint16_t total = g_state.seekScan.batchTotalPoints;
+    if (g_state.seekScan.batchBandCount > bands) bands = g_state.seekScan.batchBandCount;
+    if (total == 0) continue;
+    if (etaEarlyMs == 0 && g_state.seekScan.batchPointsVisited >= total / 10) etaEarlyMs = g_state.seekScan.batchEtaMs;
+    if (halfAtMs == 0 && g_state.seekScan.batchPointsVisited >= total / 2) {
+      halfAtMs = millis() - startMs;
+      etaHalfMs = g_state.seekScan.batchEtaMs;
+    }
+  }
+  const uint32_t virtualMs = millis() - startMs;
+  services::radio::WorkerStats ws{};
+  services::radio::workerStats(&ws);
+  const app::EtmGlobalIndex* index = services::etm::stationIndex();
+  const uint16_t indexed = index != nullptr ? index->entries.size() : 0;
+  const bool restored = g_state.radio.bandIndex == startBand && g_state.radio.frequencyKhz == startKhz;
+
+  // Walk next from the first entry through the whole index; every band change must land on that band.
+  uint16_t crossings = 0;
+  uint16_t misses = 0;
+  uint16_t wrapped = 0;
+  if (index != nullptr) {
+    const app::EtmIndexEntry first = index->entries[0];
+    g_state.radio.bandIndex = first.bandIndex;
+    g_state.radio.modulation = first.modulation;
+    g_state.radio.frequencyKhz = first.frequencyKhz;
+    services::radio::apply(g_state);
+    services::etm::syncContext(g_state);
+    for (uint16_t i = 1; i <= index->entries.size(); ++i) {
+      const uint8_t bandBefore = g_state.radio.bandIndex;
+      services::etm::navigateNext(g_state);
+      const app::EtmIndexEntry& want = index->entries[i % index->entries.size()];
+      if (g_state.radio.bandIndex != want.bandIndex || g_state.radio.frequencyKhz != want.frequencyKhz) ++misses;
+      if (g_state.radio.bandIndex != bandBefore) ++crossings;
+    }
+    services::etm::navigatePrev(g_state);
+    wrapped = g_state.radio.frequencyKhz == index->entries[index->entries.size() - 1].frequencyKhz ? 1 : 0;
+  }
+  Serial.printf("batch bands=%u points=%u indexed=%u band_configs=%lu virtual_ms=%lu eta_early_ms=%lu "
+                "eta_half_ms=%lu half_at_ms=%lu restored=%u crossings=%u nav_misses=%u prev_wrap=%u\n",
+                bands,
+                g_state.seekScan.batchTotalPoints,
+                indexed,
+                static_cast<unsigned long>(ws.bandConfigs),
+                static_cast<unsigned long>(virtualMs),
+                static_cast<unsigned long>(etaEarlyMs),
+                static_cast<unsigned long>(etaHalfMs),
+                static_cast<unsigned long>(halfAtMs),
+                restored ? 1 : 0,
+                crossings,
+                misses,
+                wrapped);
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+}
+
+// Cancels a batch in its middle band and resumes it with resumeBatchScan(): the resumed batch must start at
+// the cancelled band with the finished bands' index rebuilt from the flash cache as the cancel left it, then
+// cover the rest. Fails the run otherwise.
+void runBatchResume() {
+  static app::EtmIndexEntry cancelledEntries[256];
+  loadMixedScenario();
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  g_state.global.scanSpeed = app::ScanSpeed::Fast;
+  const uint32_t mask = app::broadcastBandMask() | app::bandMaskBit(bandIndexFor(app::BandId::FM));
+  services::etm::requestBatchScan(g_state, mask);
+  while (services::etm::busy() && g_state.seekScan.batchBand <= g_state.seekScan.batchBandCount / 2) {
+    stepLoop();
+  }
+  const uint8_t cancelledBand = g_state.seekScan.batchBand;
+  services::etm::requestCancel();
+  while (services::etm::busy()) {
+    stepLoop();
+  }
+  const bool saved = services::etm::hasBatchCheckpoint(g_state, mask);
+  const app::EtmGlobalIndex* index = services::etm::stationIndex();
+  uint16_t cancelledCount = 0;
+  for (uint16_t i = 0; index != nullptr && i < index->entries.size() && cancelledCount < 256; ++i) {
+    cancelledEntries[cancelledCount++] = index->entries[i];
+  }
+
+  const uint32_t startMs = millis();
+  const bool resumed = services::etm::resumeBatchScan(g_state, mask);
+  index = services::etm::stationIndex();
+  bool rebuilt = index != nullptr ? index->entries.size() == cancelledCount : cancelledCount == 0;
+  for (uint16_t i = 0; rebuilt && i < cancelledCount; ++i) {
+    rebuilt = index->entries[i].bandIndex == cancelledEntries[i].bandIndex &&
+              index->entries[i].frequencyKhz == cancelledEntries[i].frequencyKhz;
+  }
+  uint8_t firstBand = 0;
+  uint32_t rescanned = 0;
+  while (services::etm::busy()) {
+    stepLoop();
+    if (firstBand == 0) firstBand = g_state.seekScan.batchBand;
+    rescanned = g_state.seekScan.batchPointsVisited;
+  }
+  const uint32_t resumeMs = millis() - startMs;
+  index = services::etm::stationIndex();
+  const bool cleared = !services::etm::hasBatchCheckpoint(g_state, mask);
+  const bool ok = saved && resumed && rebuilt && firstBand == cancelledBand && cleared;
+  if (!ok) ++g_failedChecks;
+  Serial.printf("batch_resume cancelled_band=%u checkpoint=%u cancelled_indexed=%u resumed=%u rebuilt=%u "
+                "first_band=%u points=%lu/%u indexed=%u resume_ms=%lu cleared=%u ok=%d\n",
+                cancelledBand,
+                saved ? 1U : 0U,
+                cancelledCount,
+                resumed ? 1U : 0U,
+                rebuilt ? 1U : 0U,
+                firstBand,
+                static_cast<unsigned long>(rescanned),
+                g_state.seekScan.batchTotalPoints,
+                index != nullptr ? index->entries.size() : 0,
+                static_cast<unsigned long>(resumeMs),
+                cleared ? 1U : 0U,
+                ok ? 1 : 0);
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+}
+
+// Station store at scale: ALL-band scans of scenarios with carriers spread over the SW broadcast segments,
+// at most one on every other coarse raster point (the coarse pass needs floor between carriers). finalize_us is host time of the loop step that ran tickFinalize
+// (commit, cursor pick, cache write), best of three scans; before the PSRAM store both lists stopped at 120/128 entries.
+void runStore() {
+  static sim::SimCarrier carriers[1024];
+  static const uint16_t kCarrierCounts[] = {60, 120, 240, 480};
+  uint16_t points[1024];
+  uint16_t pointCount = 0;
+  for (size_t i = 0; i < app::kBroadcastRedLineAllCount && pointCount < 1024; ++i) {
+    const app::SubBandDef& sub = app::kBroadcastRedLineAll[i];
+    if (sub.maxKhz <= 1800) continue;
+    for (uint32_t khz = sub.minKhz; khz <= sub.maxKhz && pointCount < 1024; khz += app::kEtmProfileSw.coarseStepKhz) {
+      points[pointCount++] = static_cast<uint16_t>(khz);
+    }
+  }
+  g_state.global.scanSpeed = app::ScanSpeed::Fast;
+  for (uint16_t wanted : kCarrierCounts) {
+    const uint16_t count = wanted < pointCount / 2 ? wanted : static_cast<uint16_t>(pointCount / 2);
+    for (uint16_t i = 0; i < count; ++i) {
+      const uint16_t khz = points[static_cast<uint32_t>(i) * pointCount / count];
+      carriers[i] = {khz, static_cast<uint8_t>(30 + (i * 7) % 30), static_cast<uint8_t>(12 + (i * 5) % 15), 0, 0,
+                     false, 0, 0, 0, nullptr, nullptr};
+    }
+    sim::SimScenario dense = sim::defaultSwScenario();
+    dense.carriers = carriers;
+    dense.carrierCount = count;
+    sim::loadScenario(dense);
+    selectBand(app::BandId::All, app::Modulation::AM, 9400);
+    long long finalizeUs = -1;
+    for (uint8_t run = 0; run < 3; ++run) {
+      if (!services::etm::requestScan(g_state)) {
+        return;
+      }
+      while (services::etm::busy()) {
+        const auto stepStart = std::chrono::steady_clock::now();
+        stepLoop();
+        if (!services::etm::busy()) {
+          const long long us =
+              std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - stepStart).count();
+          if (finalizeUs < 0 || us < finalizeUs) finalizeUs = us;
+        }
+      }
+    }
+    Serial.printf("store band=ALL carriers=%u found=%u finalize_us=%lld\n",
+                  count,
+                  g_state.seekScan.foundCount,
+                  finalizeUs);
+  }
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+}
+
+// Station list of the scan that just finished, as etm stored it in the flash cache.
+bool loadScanResult(app::EtmMemory& memory) {
+  return services::etmcache::load(g_state.radio.bandIndex, g_state.radio.modulation, g_state.global.fmRegion, memory);
+}
+
+// Coarse peak interpolation on SW: carriers 1-2 kHz off the 5 kHz raster (halfWidth 6, so both raster
+// neighbours see the skirt). raster_err_hz is the mean distance of each carrier to its nearest raster point,
+// fit_err_hz the mean distance to the station the scan stored; both without any fine retune.
+void runPeakFit() {
+  static const int8_t kOffsetsKhz[] = {0, 1, -1, 2, -2};
+  static sim::SimCarrier carriers[16];
+  uint16_t count = 0;
+  for (uint16_t khz = 5900; khz <= 6200 && count < 16; khz += 20) {
+    const int8_t offset = kOffsetsKhz[count % sizeof(kOffsetsKhz)];
+    carriers[count] = {static_cast<uint16_t>(khz + offset), static_cast<uint8_t>(30 + (count * 7) % 20),
+                       static_cast<uint8_t>(12 + (count * 5) % 10), 6, 0, false, 0, 0, 0, nullptr, nullptr};
+    ++count;
+  }
+  sim::SimScenario offRaster = sim::defaultSwScenario();
+  offRaster.carriers = carriers;
+  offRaster.carrierCount = count;
+  sim::loadScenario(offRaster);
+  selectBand(app::BandId::BC49m, app::Modulation::AM, 6000);
+  g_state.global.scanSpeed = app::ScanSpeed::Fast;
+  if (!services::etm::requestScan(g_state)) {
+    return;
+  }
+  while (services::etm::busy()) {
+    stepLoop();
+  }
+
+  app::EtmMemory memory;
+  loadScanResult(memory);
+  uint16_t found = 0;
+  uint32_t rasterErrHz = 0;
+  uint32_t fitErrHz = 0;
+  for (uint16_t i = 0; i < count; ++i) {
+    const int16_t at = app::findStationNear(memory, carriers[i].frequencyKhz, 3);
+    if (at < 0) continue;
+    ++found;
+    const int32_t rasterOff = carriers[i].frequencyKhz % app::kEtmProfileSw.coarseStepKhz;
+    rasterErrHz += static_cast<uint32_t>(rasterOff <= 2 ? rasterOff : 5 - rasterOff) * 1000U;
+    const int32_t fitOff = static_cast<int32_t>(memory.stations[at].frequencyKhz) - carriers[i].frequencyKhz;
+    fitErrHz += static_cast<uint32_t>(fitOff >= 0 ? fitOff : -fitOff) * 1000U;
+  }
+  Serial.printf("peakfit band=SW49 carriers=%u found=%u raster_err_hz=%lu fit_err_hz=%lu\n",
+                count,
+                found,
+                static_cast<unsigned long>(found > 0 ? rasterErrHz / found : 0),
+                static_cast<unsigned long>(found > 0 ? fitErrHz / found : 0));
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+}
+
+// Cancels a scan halfway, checks the checkpoint it leaves, and resumes it with resumeScan(). The resumed scan
+// should find what an uninterrupted one finds, for about the tunes the cancelled half skipped. A last
+// cancelled scan checks that requestScan() starts over and that a checkpoint expires after
+// kEtmCheckpointMaxAgeMs.
+void runResume() {
+  static const char* kSpeedNames[] = {"fast", "thorough", "hybrid"};
+  sim::loadScenario(sim::urbanFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9800);
+  for (uint8_t speed = 0; speed <= static_cast<uint8_t>(app::ScanSpeed::Hybrid); ++speed) {
+    g_state.global.scanSpeed = static_cast<app::ScanSpeed>(speed);
+    sim::resetStats();
+    if (!services::etm::requestScan(g_state)) {
+      return;
+    }
+    while (services::etm::busy()) {
+      stepLoop();
+    }
+    const uint32_t fullMs = g_state.seekScan.scanDurationMs;
+    const uint32_t fullTunes = sim::stats().tunes;
+    app::EtmMemory full;
+    loadScanResult(full);
+
+    sim::resetStats();
+    services::etm::requestScan(g_state);
+    const uint32_t cancelAt = millis() + fullMs / 2;
+    while (services::etm::busy() && millis() < cancelAt) {
+      stepLoop();
+    }
+    services::etm::requestCancel();
+    while (services::etm::busy()) {
+      stepLoop();
+    }
+    const uint32_t cancelledTunes = sim::stats().tunes;
+    const bool saved = services::etm::hasCheckpoint(g_state);
+
+    sim::resetStats();
+    services::etm::resumeScan(g_state);
+    while (services::etm::busy()) {
+      stepLoop();
+    }
+    app::EtmMemory resumed;
+    loadScanResult(resumed);
+    uint16_t same = 0;
+    for (uint16_t i = 0; i < resumed.stations.size(); ++i) {
+      if (app::findStationNear(full, resumed.stations[i].frequencyKhz, 0) >= 0) ++same;
+    }
+    Serial.printf("resume speed=%s full_stations=%u full_tunes=%lu cancelled_tunes=%lu checkpoint=%u "
+                  "resumed_stations=%u same=%u resumed_tunes=%lu scan_ms=%lu full_ms=%lu cleared=%u\n",
+                  kSpeedNames[speed],
+                  full.stations.size(),
+                  static_cast<unsigned long>(fullTunes),
+                  static_cast<unsigned long>(cancelledTunes),
+                  saved ? 1U : 0U,
+                  resumed.stations.size(),
+                  same,
+                  static_cast<unsigned long>(sim::stats().tunes),
+                  static_cast<unsigned long>(g_state.seekScan.scanDurationMs),
+                  static_cast<unsigned long>(fullMs),
+                  services::etm::hasCheckpoint(g_state) ? 0U : 1U);
+  }
+
+  g_state.global.scanSpeed = app::ScanSpeed::Fast;
+  bool dropped = false;
+  for (uint8_t pass = 0; pass < 2; ++pass) {
+    services::etm::requestScan(g_state);
+    if (pass == 1) {
+      app::EtmCheckpoint checkpoint{};
+      dropped = !services::etmcache::loadCheckpoint(checkpoint, nullptr, nullptr);
+    }
+    const uint32_t cancelAt = millis() + 2000;
+    while (services::etm::busy() && millis() < cancelAt) {
+      stepLoop();
+    }
+    services::etm::requestCancel();
+    while (services::etm::busy()) {
+      stepLoop();
+    }
+  }
+  const bool saved = services::etm::hasCheckpoint(g_state);
+  host::advanceMs(app::kEtmCheckpointMaxAgeMs + 1);
+  const bool expired = !services::etm::hasCheckpoint(g_state);
+  if (!dropped || !saved || !expired) ++g_failedChecks;
+  Serial.printf("resume_fresh dropped=%u checkpoint=%u expired=%u\n", dropped ? 1U : 0U, saved ? 1U : 0U,
+                expired ? 1U : 0U);
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+}
+
+// Seeks up through the FM band from 87.5 MHz until the seek wraps. "memory" runs right after a scan, so each
+// seek can jump to the next known station; "memory_gone" switches one carrier off first, so its seek falls
+// back to the hardware seek; "hardware" repeats the walk once the list is older than kEtmSeekMaxAgeMs.
+// on_carrier = stops on a simulated carrier, instant = seeks that ran no hardware seek step.
+void walkSeeks(const char* mode, const sim::SimScenario& scenario) {
+  constexpr uint8_t kMaxStops = 32;
+  selectBand(app::BandId::FM, app::Modulation::FM, 8750);
+  sim::resetStats();
+  uint32_t totalMs = 0;
+  uint32_t instantMs = 0;
+  uint8_t stops = 0;
+  uint8_t onCarrier = 0;
+  uint8_t instant = 0;
+  uint16_t lastKhz = 0;
+  while (stops < kMaxStops) {
+    const uint32_t startMs = millis();
+    const uint32_t startSteps = sim::stats().seekSteps;
+    services::seekscan::requestSeek(1);
+    while (services::seekscan::busy()) {
+      stepLoop();
+    }
+    const uint32_t elapsedMs = millis() - startMs;
+    if (g_state.seekScan.foundCount == 0 || g_state.radio.frequencyKhz <= lastKhz) break;
+    lastKhz = g_state.radio.frequencyKhz;
+    ++stops;
+    totalMs += elapsedMs;
+    if (sim::stats().seekSteps == startSteps) {
+      ++instant;
+      instantMs += elapsedMs;
+    }
+    for (uint16_t i = 0; i < scenario.carrierCount; ++i) {
+      if (scenario.carriers[i].frequencyKhz == lastKhz) ++onCarrier;
+    }
+  }
+  Serial.printf("seek mode=%s stops=%u on_carrier=%u instant=%u instant_mean_ms=%lu mean_ms=%lu seek_steps=%lu\n",
+                mode,
+                stops,
+                onCarrier,
+                instant,
+                static_cast<unsigned long>(instant > 0 ? instantMs / instant : 0),
+                static_cast<unsigned long>(stops > 0 ? totalMs / stops : 0),
+                static_cast<unsigned long>(sim::stats().seekSteps));
+}
+
+void runSeek() {
+  const sim::SimScenario& base = sim::defaultFmScenario();
+  sim::loadScenario(base);
+  selectBand(app::BandId::FM, app::Modulation::FM, 8750);
+  g_state.global.scanSpeed = app::ScanSpeed::Fast;
+  if (!services::etm::requestScan(g_state)) {
+    return;
+  }
+  while (services::etm::busy()) {
+    stepLoop();
+  }
+  walkSeeks("memory", base);
+
+  static sim::SimCarrier thinned[32];
+  uint16_t thinnedCount = 0;
+  for (uint16_t i = 0; i < base.carrierCount && thinnedCount < 32; ++i) {
+    if (i != 2) thinned[thinnedCount++] = base.carriers[i];
+  }
+  sim::SimScenario gone = base;
+  gone.carriers = thinned;
+  gone.carrierCount = thinnedCount;
+  sim::loadScenario(gone);
+  walkSeeks("memory_gone", gone);
+
+  sim::loadScenario(base);
+  host::advanceMs(app::kEtmSeekMaxAgeMs + 1);
+  walkSeeks("hardware", base);
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+}
+
+struct BenchScenario {
+  const char* name;
+  const sim::SimScenario& (*scenario)();
+  app::BandId band;
+  app::Modulation modulation;
+  uint16_t tuneKhz;
+};
+
+// Scan benchmark: every library scenario at every scan speed (adaptive settle, the firmware default), scored
+// against the scenario's carriers. A station within half a coarse step of a carrier matches it, each side at
+// most once; recall = matched/carriers, precision = matched/stations, freq_err_hz = mean distance of the
+// matched pairs, scan_ms = simulated scan time. One line per run; diff two builds with
+// `program bench | grep ^bench`.
+void runBench() {
+  static const BenchScenario kScenarios[] = {
+      {"fm_urban", sim::urbanFmScenario, app::BandId::FM, app::Modulation::FM, 9800},
+      {"fm_dx", sim::dxFmScenario, app::BandId::FM, app::Modulation::FM, 9800},
+      {"fm_splatter", sim::splatterFmScenario, app::BandId::FM, app::Modulation::FM, 9800},
+      {"sw_evening", sim::swEveningScenario, app::BandId::BC49m, app::Modulation::AM, 6000},
+  };
+  static const char* kSpeedNames[] = {"fast", "thorough", "hybrid"};
+  services::etm::setAdaptiveSettle(true);
+  for (const BenchScenario& bench : kScenarios) {
+    const sim::SimScenario& scenario = bench.scenario();
+    sim::loadScenario(scenario);
+    selectBand(bench.band, bench.modulation, bench.tuneKhz);
+    const bool fm = bench.modulation == app::Modulation::FM;
+    const uint16_t stepUnits = fm ? app::kEtmProfileFm.coarseStepKhz : app::kEtmProfileSw.coarseStepKhz;
+    const uint16_t unitHz = fm ? 10000 : 1000;
+    for (uint8_t speed = 0; speed <= static_cast<uint8_t>(app::ScanSpeed::Hybrid); ++speed) {
+      g_state.global.scanSpeed = static_cast<app::ScanSpeed>(speed);
+      sim::resetStats();
+      if (!services::etm::requestScan(g_state)) {
+        return;
+      }
+      while (services::etm::busy()) {
+        stepLoop();
+      }
+
+      app::EtmMemory memory;
+      loadScanResult(memory);
+      static bool taken[app::kEtmMaxStations];
+      memset(taken, 0, sizeof(taken));
+      uint16_t matched = 0;
+      uint32_t errHz = 0;
+      for (uint16_t i = 0; i < scenario.carrierCount; ++i) {
+        const uint16_t khz = scenario.carriers[i].frequencyKhz;
+        int32_t best = -1;
+        uint16_t bestDelta = 0;
+        for (uint16_t k = 0; k < memory.stations.size(); ++k) {
+          const uint16_t f = memory.stations[k].frequencyKhz;
+          const uint16_t delta = static_cast<uint16_t>(f >= khz ? f - khz : khz - f);
+          if (taken[k] || delta > stepUnits / 2) continue;
+          if (best < 0 || delta < bestDelta) {
+            best = k;
+            bestDelta = delta;
+          }
+        }
+        if (best < 0) continue;
+        taken[best] = true;
+        ++matched;
+        errHz += static_cast<uint32_t>(bestDelta) * unitHz;
+      }
+      const uint16_t stations = memory.stations.size();
+      const sim::SimStats& st = sim::stats();
+      Serial.printf("bench scenario=%s speed=%s carriers=%u stations=%u matched=%u recall=%.3f precision=%.3f "
+                    "freq_err_hz=%lu scan_ms=%lu tunes=%lu rsq_reads=%lu\n",
+                    bench.name,
+                    kSpeedNames[speed],
+                    scenario.carrierCount,
+                    stations,
+                    matched,
+                    static_cast<double>(matched) / static_cast<double>(scenario.carrierCount),
+                    stations > 0 ? static_cast<double>(matched) / static_cast<double>(stations) : 0.0,
+                    static_cast<unsigned long>(matched > 0 ? errHz / matched : 0),
+                    static_cast<unsigned long>(g_state.seekScan.scanDurationMs),
+                    static_cast<unsigned long>(st.tunes),
+                    static_cast<unsigned long>(st.rsqReads));
+    }
+  }
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+}
+
+void patchCacheByte(const char* path, long offset, uint8_t value) {
+  char hostPath[256];
+  snprintf(hostPath, sizeof(hostPath), "%s%s", getenv("ATS_HOST_FS"), path);
+  FILE* fp = fopen(hostPath, "r+b");
+  if (fp == nullptr) {
+    return;
+  }
+  fseek(fp, offset, SEEK_SET);
+  fputc(value, fp);
+  fclose(fp);
+}
+
+uint8_t foundAfterSwitchBack(app::BandId away, uint16_t awayKhz, uint16_t homeKhz) {
+  selectBand(away, app::Modulation::AM, awayKhz);
+  selectBand(app::BandId::FM, app::Modulation::FM, homeKhz);
+  services::etm::publishState(g_state);
+  return g_state.seekScan.foundCount;
+}
+
+// ETM flash cache: FM list survives FM -> MW -> FM, and damaged or foreign-version files are ignored.
+void runCache() {
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  g_state.global.scanSpeed = app::ScanSpeed::Thorough;
+  if (!services::etm::requestScan(g_state)) {
+    return;
+  }
+  while (services::etm::busy()) {
+    stepLoop();
+  }
+  const uint8_t scanned = g_state.seekScan.foundCount;
+  const uint8_t restored = foundAfterSwitchBack(app::BandId::MW, 999, 9040);
+
+  char path[32];
+  snprintf(path,
+           sizeof(path),
+           "/etm/b%02u-m%u-r%u.bin",
+           static_cast<unsigned>(g_state.radio.bandIndex),
+           static_cast<unsigned>(g_state.radio.modulation),
+           static_cast<unsigned>(g_state.global.fmRegion));
+  File file = LittleFS.open(path, "r");
+  const size_t bytes = file ? file.size() : 0;
+  file.close();
+
+  patchCacheByte(path, 18, 0xFF);  // first record's rssi: checksum must catch it
+  const uint8_t corrupted = foundAfterSwitchBack(app::BandId::MW, 999, 9040);
+  services::etm::requestScan(g_state);
+  while (services::etm::busy()) {
+    stepLoop();
+  }
+  patchCacheByte(path, 4, 0x7F);  // format version
+  const uint8_t foreignVersion = foundAfterSwitchBack(app::BandId::MW, 999, 9040);
+
+  Serial.printf("cache band=FM scanned=%u restored=%u file_bytes=%lu corrupted=%u foreign_version=%u\n",
+                scanned,
+                restored,
+                static_cast<unsigned long>(bytes),
+                corrupted,
+                foreignVersion);
+}
+
+// One detent every periodMs through requestApply(), as main.cpp's changeFrequency() does, then idles until
+// the tuner has caught up. settle_lag_ms is the time from the last detent to the final retune.
+void runSpin(uint16_t windowMs, uint16_t detents, uint32_t periodMs) {
+  services::radio::setTuneSettleWindowMs(windowMs);
+  selectBand(app::BandId::FM, app::Modulation::FM, 8760);
+  for (uint8_t i = 0; i < 200; ++i) {
+    stepLoop();
+  }
+  services::radio::resetWorkerStats();
+  sim::resetStats();
+  uint32_t callerMs = 0;
+  uint32_t lastDetentMs = 0;
+  for (uint16_t i = 0; i < detents; ++i) {
+    g_state.radio.frequencyKhz = static_cast<uint16_t>(g_state.radio.frequencyKhz + 10);
+    const uint32_t beforeMs = millis();
+    lastDetentMs = beforeMs;
+    services::radio::requestApply(g_state);
+    callerMs += millis() - beforeMs;
+    for (uint32_t t = 0; t < periodMs; ++t) {
+      stepLoop();
+    }
+  }
+  const uint16_t targetKhz = g_state.radio.frequencyKhz;
+  for (uint16_t t = 0; t < 500; ++t) {
+    stepLoop();
+  }
+  const sim::SimStats& st = sim::stats();
+  const long settleLagMs = st.lastTuneKhz == targetKhz ? static_cast<long>(st.lastTuneMs - lastDetentMs) : -1;
+  services::radio::WorkerStats ws{};
+  services::radio::workerStats(&ws);
+  Serial.printf("worker spin window_ms=%u detents=%u posted=%lu coalesced=%lu tunes=%lu deferred=%lu rds_resets=%lu "
+                "rds_resets_skipped=%lu caller_ms=%lu max_queue_ms=%lu settle_lag_ms=%ld\n",
+                windowMs,
+                detents,
+                static_cast<unsigned long>(ws.posted),
+                static_cast<unsigned long>(ws.coalesced),
+                static_cast<unsigned long>(ws.tunes),
+                static_cast<unsigned long>(ws.deferredTunes),
+                static_cast<unsigned long>(ws.rdsResets),
+                static_cast<unsigned long>(ws.rdsResetsSkipped),
+                static_cast<unsigned long>(callerMs),
+                static_cast<unsigned long>(ws.maxQueueMs),
+                settleLagMs);
+}
+
+// Radio worker queue on the host: there is no second core, so radio::tick() drains the queue once per
+// loop pass and caller-side cost is what the UI loop would see on the device.
+void runWorker() {
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+
+  // Fast encoder spin (one detent every 5 ms for 1 s), with and without the tune settle window.
+  static const uint16_t kWindows[] = {0, app::kTuneSettleWindowMs};
+  for (uint16_t windowMs : kWindows) {
+    runSpin(windowMs, 200, 5);
+  }
+  services::radio::setTuneSettleWindowMs(app::kTuneSettleWindowMs);
+
+  // Band switch: configureModeAndBand sleeps for the amp, which the synchronous path charges to the caller.
+  g_state.radio.bandIndex = bandIndexFor(app::BandId::MW);
+  g_state.radio.modulation = app::Modulation::AM;
+  g_state.radio.frequencyKhz = 999;
+  uint32_t beforeMs = millis();
+  services::radio::apply(g_state);
+  const uint32_t syncMs = millis() - beforeMs;
+  g_state.radio.bandIndex = bandIndexFor(app::BandId::FM);
+  g_state.radio.modulation = app::Modulation::FM;
+  g_state.radio.frequencyKhz = 9040;
+  beforeMs = millis();
+  services::radio::requestApply(g_state);
+  const uint32_t asyncMs = millis() - beforeMs;
+  stepLoop();
+  Serial.printf("worker band_switch sync_caller_ms=%lu async_caller_ms=%lu\n",
+                static_cast<unsigned long>(syncMs),
+                static_cast<unsigned long>(asyncMs));
+
+  // User seek through seekscan: posted to the worker, result picked up by seekscan::tick.
+  g_state.radio.frequencyKhz = 9200;
+  services::radio::apply(g_state);
+  services::seekscan::requestSeek(1);
+  const uint32_t seekStartMs = millis();
+  uint32_t passes = 0;
+  do {
+    stepLoop();
+    ++passes;
+  } while (services::seekscan::busy() && passes < 100000);
+  Serial.printf("worker seek from=9200 to=%u found=%u seek_ms=%lu loop_passes=%lu\n",
+                g_state.radio.frequencyKhz,
+                g_state.seekScan.foundCount,
+                static_cast<unsigned long>(millis() - seekStartMs),
+                static_cast<unsigned long>(passes));
+
+  // Cancel mid-seek: the seek is polled from the loop, so the cancel lands on the next pass.
+  g_state.radio.frequencyKhz = 9200;
+  services::radio::apply(g_state);
+  services::seekscan::requestSeek(1);
+  for (uint8_t i = 0; i < 50; ++i) stepLoop();
+  const uint32_t cancelAtMs = millis();
+  services::seekscan::requestCancel();
+  passes = 0;
+  while (services::seekscan::busy() && passes < 100000) {
+    stepLoop();
+    ++passes;
+  }
+  Serial.printf("worker seek_cancel stopped_at=%u cancel_ms=%lu loop_passes=%lu\n",
+                g_state.radio.frequencyKhz,
+                static_cast<unsigned long>(millis() - cancelAtMs),
+                static_cast<unsigned long>(passes));
+}
+
+// Idle listening with squelch armed and a UI-rate meter poll: the steady-state RSQ and lock traffic.
+void runListen(uint16_t frequencyKhz, uint32_t seconds) {
+  selectBand(app::BandId::FM, app::Modulation::FM, frequencyKhz);
+  g_state.global.squelch = 10;
+  services::radio::applyRuntimeSettings(g_state);
+  services::rds::reset(g_state);
+  sim::resetStats();
+  const uint32_t takesBefore = host::semaphoreTakes();
+  const uint32_t startMs = millis();
+  uint32_t lastUiPollMs = startMs;
+  while (millis() - startMs < seconds * 1000U) {
+    stepLoop();
+    if (millis() - lastUiPollMs >= kUiSignalPollMs) {
+      lastUiPollMs = millis();
+      uint8_t rssi = 0, snr = 0;
+      services::radio::readSignalQuality(&rssi, &snr);
+    }
+  }
+  services::radio::RsqSample history[8];
+  const uint8_t historyCount = services::radio::signalHistory(history, 8, 1000);
+  const sim::SimStats& st = sim::stats();
+  Serial.printf("listen freq=%u seconds=%lu rsq_reads=%lu rsq_reads_per_s=%.1f lock_takes=%lu history_1s=%u squelched=%u\n",
+                frequencyKhz,
+                static_cast<unsigned long>(seconds),
+                static_cast<unsigned long>(st.rsqReads),
+                static_cast<double>(st.rsqReads) / seconds,
+                static_cast<unsigned long>(host::semaphoreTakes() - takesBefore),
+                historyCount,
+                services::radio::audioMuted() ? 1 : 0);
+  g_state.global.squelch = 0;
+  services::radio::applyRuntimeSettings(g_state);
+}
+
+void runRds(uint16_t frequencyKhz) {
+  selectBand(app::BandId::FM, app::Modulation::FM, frequencyKhz);
+  services::rdscache::clear();  // time live voting, not a name cached by the listen run
+  services::rds::reset(g_state);
+  sim::resetStats();
+  const uint32_t startMs = millis();
+  uint32_t firstPsMs = 0;
+  uint32_t firstRtMs = 0;
+  while (millis() - startMs < kRdsRunMs) {
+    stepLoop();
+    if (firstPsMs == 0 && g_state.rds.hasPs) {
+      firstPsMs = millis() - startMs;
+    }
+    if (firstRtMs == 0 && g_state.rds.hasRt) {
+      firstRtMs = millis() - startMs;
+    }
+  }
+  const sim::SimStats& st = sim::stats();
+  Serial.printf("rds freq=%u pi=%04X ps=\"%s\" first_ps_ms=%lu first_rt_ms=%lu groups=%lu lost=%lu reads=%lu\n",
+                frequencyKhz,
+                g_state.rds.pi,
+                g_state.rds.ps,
+                static_cast<unsigned long>(firstPsMs),
+                static_cast<unsigned long>(firstRtMs),
+                static_cast<unsigned long>(st.rdsGroups),
+                static_cast<unsigned long>(st.rdsGroupsLost),
+                static_cast<unsigned long>(st.rdsReads));
+}
+
+void printAfList(char* out, size_t outSize, const app::RdsAfList& af) {
+  size_t used = 0;
+  out[0] = '\0';
+  for (uint8_t i = 0; i < af.count && used + 7 < outSize; ++i) {
+    used += static_cast<size_t>(snprintf(out + used, outSize - used, "%s%u%s", i == 0 ? "" : ",",
+                                         app::rdsAfCodeToFrequency(af.codes[i]),
+                                         (af.regionalMask & (1UL << i)) != 0 ? "r" : ""));
+  }
+}
+
+// Groups beyond PS/RT on the RDS network scenario: the AF list of the strong transmitter (method A, then
+// method B), the other programmes heard through EON, and the RT+ title/artist of the music station.
+void runRdsNetwork() {
+  sim::loadScenario(sim::rdsNetworkFmScenario());
+  const app::RdsMode savedMode = g_state.global.rdsMode;
+  g_state.global.rdsMode = app::RdsMode::All;
+
+  for (uint8_t methodB = 0; methodB < 2; ++methodB) {
+    sim::setAfMethodB(methodB != 0);
+    selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+    services::rds::reset(g_state);
+    const uint32_t startMs = millis();
+    uint32_t afMs = 0;
+    while (millis() - startMs < 60000) {
+      stepLoop();
+      const app::RdsAfList& af = g_state.rds.af;
+      if (afMs == 0 && af.expected > 0 && af.count >= af.expected) {
+        afMs = millis() - startMs;
+      }
+    }
+    char list[96];
+    printAfList(list, sizeof(list), g_state.rds.af);
+    char eon[64];
+    size_t used = 0;
+    eon[0] = '\0';
+    for (uint8_t i = 0; i < g_state.rds.eonCount; ++i) {
+      const app::RdsEonEntry& e = g_state.rds.eon[i];
+      used += static_cast<size_t>(snprintf(eon + used, sizeof(eon) - used, "%s%04X:%s@%u", i == 0 ? "" : ",", e.pi,
+                                           e.psMask == 0x0F ? e.ps : "?",
+                                           e.afCount > 0 ? app::rdsAfCodeToFrequency(e.afCodes[0]) : 0));
+    }
+    Serial.printf("rds_net af method=%s list=%s count=%u/%u af_ms=%lu eon=%u [%s]\n",
+                  g_state.rds.af.methodB ? "B" : "A",
+                  list,
+                  g_state.rds.af.count,
+                  g_state.rds.af.expected,
+                  static_cast<unsigned long>(afMs),
+                  g_state.rds.eonCount,
+                  eon);
+  }
+  sim::setAfMethodB(false);
+
+  selectBand(app::BandId::FM, app::Modulation::FM, 9580);
+  services::rds::reset(g_state);
+  const uint32_t startMs = millis();
+  uint32_t tagMs = 0;
+  char title[65];
+  char artist[65];
+  while (millis() - startMs < 30000) {
+    stepLoop();
+    if (tagMs == 0 && app::rdsRtPlusText(g_state.rds, app::kRdsRtPlusItemTitle, title, sizeof(title))) {
+      tagMs = millis() - startMs;
+    }
+  }
+  app::rdsRtPlusText(g_state.rds, app::kRdsRtPlusItemTitle, title, sizeof(title));
+  app::rdsRtPlusText(g_state.rds, app::kRdsRtPlusItemArtist, artist, sizeof(artist));
+  Serial.printf("rds_net rtplus freq=9580 title=\"%s\" artist=\"%s\" running=%u tag_ms=%lu\n",
+                title,
+                artist,
+                g_state.rds.rtPlusRunning,
+                static_cast<unsigned long>(tagMs));
+
+  g_state.global.rdsMode = savedMode;
+  sim::loadScenario(sim::defaultFmScenario());
+}
+
+// AF following on the RDS network scenario: listen to the strong transmitter until its AF list and PI are
+// known, then fade it out. wrongAf lists the music station in the AF list too, so the first switch fails the
+// PI check and goes back before the engine settles on a transmitter of the same programme. eon decodes EON and
+// listens long enough for the music station's EON AF, so the engine knows its PI and never tries it.
+void runAf(bool wrongAf, bool eon = false) {
+  const app::RdsMode savedMode = g_state.global.rdsMode;
+  if (eon) {
+    g_state.global.rdsMode = app::RdsMode::All;
+  }
+  const uint32_t listenMs = eon ? 30000 : 10000;
+  sim::loadScenario(sim::rdsNetworkFmScenario());
+  sim::setAfExtra(wrongAf ? 9580 : 0);
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  services::rds::reset(g_state);
+  services::af::reset();
+  services::af::resetStats();
+  uint32_t startMs = millis();
+  while (millis() - startMs < listenMs) {
+    stepLoop();
+  }
+  const uint8_t afCount = g_state.rds.af.count;
+
+  sim::setCarrierFade(9040, 40);
+  startMs = millis();
+  uint32_t followMs = 0;
+  services::af::AfStats st{};
+  while (millis() - startMs < 30000) {
+    stepLoop();
+    services::af::stats(&st);
+    if (followMs == 0 && st.switches > 0) {
+      followMs = millis() - startMs;
+    }
+  }
+  uint16_t pi = 0;
+  services::rds::votedPi(&pi);
+  Serial.printf("af wrong_af=%u eon=%u list=%u from=9040 to=%u pi=%04X follow_ms=%lu attempts=%lu probes=%lu switches=%lu "
+                "reverts=%lu max_mute_ms=%lu\n",
+                wrongAf ? 1 : 0,
+                g_state.rds.eonCount,
+                afCount,
+                g_state.radio.frequencyKhz,
+                pi,
+                static_cast<unsigned long>(followMs),
+                static_cast<unsigned long>(st.attempts),
+                static_cast<unsigned long>(st.probes),
+                static_cast<unsigned long>(st.switches),
+                static_cast<unsigned long>(st.reverts),
+                static_cast<unsigned long>(st.maxMuteMs));
+
+  sim::setCarrierFade(0, 0);
+  sim::setAfExtra(0);
+  sim::loadScenario(sim::defaultFmScenario());
+  g_state.global.rdsMode = savedMode;
+}
+
+// Station name cache on the RDS network scenario: time from a retune to a PS with an empty cache, then again
+// after the cache has been flushed and read back from flash. 8830 shares 9040's PI but was never heard
+// itself, so its cached name waits for the PI lock instead of the first clean block A.
+uint32_t timeToPs(uint16_t frequencyKhz, uint32_t* confirmMs) {
+  selectBand(app::BandId::FM, app::Modulation::FM, frequencyKhz);
+  services::rds::reset(g_state);
+  const uint32_t startMs = millis();
+  uint32_t psMs = 0;
+  *confirmMs = 0;
+  while (millis() - startMs < 8000) {
+    stepLoop();
+    if (psMs == 0 && g_state.rds.hasPs) {
+      psMs = millis() - startMs;
+    }
+    if (*confirmMs == 0 && g_state.rds.hasPs && !g_state.rds.psCached) {
+      *confirmMs = millis() - startMs;
+    }
+  }
+  return psMs;
+}
+
+void runRdsNames() {
+  sim::loadScenario(sim::rdsNetworkFmScenario());
+  services::rdscache::clear();
+  const uint32_t writesBefore = services::rdscache::flashWrites();
+  const app::RdsMode savedMode = g_state.global.rdsMode;
+  g_state.global.rdsMode = app::RdsMode::Ps;
+
+  const uint16_t cold[] = {9040, 9580, 10210};
+  char coldText[64] = "";
+  size_t used = 0;
+  for (uint16_t khz : cold) {
+    uint32_t confirmMs = 0;
+    const uint32_t psMs = timeToPs(khz, &confirmMs);
+    used += static_cast<size_t>(snprintf(coldText + used, sizeof(coldText) - used, "%s%u:%lu", used ? "," : "", khz,
+                                         static_cast<unsigned long>(psMs)));
+  }
+  const uint32_t idleMs = millis();
+  while (millis() - idleMs < 12000) {
+    stepLoop();
+  }
+  services::rdscache::begin();  // drop RAM, read the flushed file back
+
+  const uint16_t warm[] = {9580, 10210, 9040, 8830};
+  char warmText[96] = "";
+  used = 0;
+  for (uint16_t khz : warm) {
+    uint32_t confirmMs = 0;
+    const uint32_t psMs = timeToPs(khz, &confirmMs);
+    used += static_cast<size_t>(snprintf(warmText + used, sizeof(warmText) - used, "%s%u:%lu/%lu", used ? "," : "", khz,
+                                         static_cast<unsigned long>(psMs), static_cast<unsigned long>(confirmMs)));
+  }
+  Serial.printf("rds_names cold_ps_ms=%s warm_ps_ms/confirm_ms=%s ps=\"%s\" cached=%u flash_writes=%lu\n",
+                coldText,
+                warmText,
+                g_state.rds.ps,
+                services::rdscache::size(),
+                static_cast<unsigned long>(services::rdscache::flashWrites() - writesBefore));
+
+  g_state.global.rdsMode = savedMode;
+  sim::loadScenario(sim::defaultFmScenario());
+}
+
+// RDS FIFO poller on the music station of the network scenario (PS, 64-character RT): time to PS/RT, the
+// decoder's groups and overflow reports per second, FIFO reads and the cadence it settles on. stallMs adds a
+// blocked loop after every pass, like a long flash write or redraw, to show the FIFO drained by its fill.
+void runRdsPoll(uint32_t stallMs) {
+  sim::loadScenario(sim::rdsNetworkFmScenario());
+  const app::RdsMode savedMode = g_state.global.rdsMode;
+  g_state.global.rdsMode = app::RdsMode::All;
+  selectBand(app::BandId::FM, app::Modulation::FM, 9580);
+  services::rdscache::clear();
+  services::rds::reset(g_state);
+  services::rds::resetStats();
+  sim::resetStats();
+  const uint32_t startMs = millis();
+  uint32_t firstPsMs = 0;
+  uint32_t firstRtMs = 0;
+  while (millis() - startMs < 30000) {
+    stepLoop();
+    if (stallMs != 0) {
+      host::advanceMs(stallMs);
+    }
+    if (firstPsMs == 0 && g_state.rds.hasPs) {
+      firstPsMs = millis() - startMs;
+    }
+    if (firstRtMs == 0 && g_state.rds.hasRt) {
+      firstRtMs = millis() - startMs;
+    }
+  }
+  services::rds::RdsStats rs{};
+  services::rds::stats(&rs);
+  const sim::SimStats& st = sim::stats();
+  Serial.printf("rds_poll stall_ms=%lu first_ps_ms=%lu first_rt_ms=%lu groups_per_s=%u.%u lost_per_s=%u.%u "
+                "groups=%lu lost_reports=%lu polls=%lu reads=%lu fifo_max=%u poll_ms=%u sim_lost=%lu\n",
+                static_cast<unsigned long>(stallMs),
+                static_cast<unsigned long>(firstPsMs),
+                static_cast<unsigned long>(firstRtMs),
+                rs.groupsPerSecX10 / 10U,
+                rs.groupsPerSecX10 % 10U,
+                rs.lostPerSecX10 / 10U,
+                rs.lostPerSecX10 % 10U,
+                static_cast<unsigned long>(rs.groups),
+                static_cast<unsigned long>(rs.lost),
+                static_cast<unsigned long>(rs.polls),
+                static_cast<unsigned long>(st.rdsReads),
+                rs.maxFifo,
+                rs.pollMs,
+                static_cast<unsigned long>(st.rdsGroupsLost));
+
+  g_state.global.rdsMode = savedMode;
+  sim::loadScenario(sim::defaultFmScenario());
+}
+
+// RadioText assembly on a marginal signal: the music station of the network scenario with a share of its C/D
+// blocks damaged (most uncorrectable, some miscorrected into wrong characters that pass the BLE gate). Time to
+// the first RT, to the exact RT, and how many wrong texts were shown on the way.
+void runRtVoting(uint8_t errorPercent) {
+  sim::loadScenario(sim::rdsNetworkFmScenario());
+  const app::RdsMode savedMode = g_state.global.rdsMode;
+  g_state.global.rdsMode = app::RdsMode::All;
+  const char* truth = "";
+  const sim::SimScenario& sc = sim::scenario();
+  for (uint16_t i = 0; i < sc.carrierCount; ++i) {
+    if (sc.carriers[i].frequencyKhz == 9580 && sc.carriers[i].rdsRt != nullptr) {
+      truth = sc.carriers[i].rdsRt;
+    }
+  }
+  sim::setRdsBlockErrors(errorPercent);
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  selectBand(app::BandId::FM, app::Modulation::FM, 9580);
+  services::rdscache::clear();
+  services::rds::reset(g_state);
+  const uint32_t startMs = millis();
+  uint32_t firstRtMs = 0;
+  uint32_t cleanRtMs = 0;
+  uint32_t wrong = 0;
+  char shown[app::kRdsRtCapacity] = "";
+  while (millis() - startMs < 40000) {
+    stepLoop();
+    if (!g_state.rds.hasRt || strcmp(shown, g_state.rds.rt) == 0) {
+      continue;
+    }
+    app::copyText(shown, g_state.rds.rt);
+    if (firstRtMs == 0) {
+      firstRtMs = millis() - startMs;
+    }
+    if (strcmp(shown, truth) == 0) {
+      if (cleanRtMs == 0) {
+        cleanRtMs = millis() - startMs;
+      }
+    } else {
+      ++wrong;
+    }
+  }
+  Serial.printf("rt_vote block_errors=%u%% first_rt_ms=%lu clean_rt_ms=%lu wrong_rt=%lu final_ok=%u\n",
+                errorPercent,
+                static_cast<unsigned long>(firstRtMs),
+                static_cast<unsigned long>(cleanRtMs),
+                static_cast<unsigned long>(wrong),
+                strcmp(g_state.rds.rt, truth) == 0 ? 1 : 0);
+
+  sim::setRdsBlockErrors(0);
+  g_state.global.rdsMode = savedMode;
+  sim::loadScenario(sim::defaultFmScenario());
+}
+
+// ETM identify pass on the default FM scenario (Thorough): after the stations are committed, each one gets up
+// to dwellMs of RDS. 9110 and 10590 carry no RDS and are skipped once kEtmIdentifySyncMs passes without a
+// group. coldCache clears the PI-keyed name cache first, so every PS is decoded live; with it warm, a dwell
+// ends at the PI lock. list is frequency:PI:PS of the stored (flash cache) result.
+void runIdentify(uint16_t dwellMs, bool coldCache) {
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  g_state.global.scanSpeed = app::ScanSpeed::Thorough;
+  if (coldCache) {
+    services::rdscache::clear();
+  }
+  g_state.global.scanIdentifyDwellMs = dwellMs;
+  if (!services::etm::requestScan(g_state)) {
+    return;
+  }
+  while (services::etm::busy()) {
+    stepLoop();
+  }
+  g_state.global.scanIdentifyDwellMs = app::kEtmIdentifyDwellDefaultMs;
+
+  app::EtmMemory memory{};
+  loadScanResult(memory);
+  uint16_t identified = 0;
+  uint16_t named = 0;
+  char list[160] = "";
+  size_t used = 0;
+  for (uint16_t i = 0; i < memory.stations.size(); ++i) {
+    const app::EtmStation& st = memory.stations[i];
+    identified = static_cast<uint16_t>(identified + (st.rdsPi != 0 ? 1 : 0));
+    named = static_cast<uint16_t>(named + (st.rdsPs[0] != '\0' ? 1 : 0));
+    if (st.rdsPi != 0 && used < sizeof(list)) {
+      used += static_cast<size_t>(snprintf(list + used, sizeof(list) - used, "%s%u:%04X:%s", used ? "," : "",
+                                           st.frequencyKhz, st.rdsPi, st.rdsPs));
+    }
+  }
+  Serial.printf("etm_identify dwell_ms=%u cache=%s stations=%u identified=%u named=%u scan_ms=%lu list=%s\n",
+                dwellMs,
+                coldCache ? "cold" : "warm",
+                static_cast<unsigned>(memory.stations.size()),
+                identified,
+                named,
+                static_cast<unsigned long>(g_state.seekScan.scanDurationMs),
+                list);
+}
+
+// RDS trace replay: a recorded trace (services::rdstrace) goes through the simulator's playback FIFO at its
+// recorded times, so rds_service.cpp reads and decodes the same groups it did on air. One result per tuned
+// segment: time from the retune to the first PS/RT, and what was shown at the end.
+struct RdsSegment {
+  uint16_t frequencyKhz;
+  uint32_t startMs;
+  uint32_t groups;
+  uint32_t firstPsMs;
+  uint32_t firstRtMs;
+  uint16_t pi;
+  char ps[9];
+  char rt[65];
+};
+
+void openSegment(RdsSegment& segment, uint16_t frequencyKhz) {
+  segment = RdsSegment{};
+  segment.frequencyKhz = frequencyKhz;
+  segment.startMs = millis();
+}
+
+void trackSegment(RdsSegment* segment) {
+  if (segment == nullptr) {
+    return;
+  }
+  if (segment->firstPsMs == 0 && g_state.rds.hasPs && !g_state.rds.psCached) {
+    segment->firstPsMs = millis() - segment->startMs;
+  }
+  if (segment->firstRtMs == 0 && g_state.rds.hasRt) {
+    segment->firstRtMs = millis() - segment->startMs;
+  }
+}
+
+void closeSegment(RdsSegment* segment) {
+  if (segment == nullptr) {
+    return;
+  }
+  segment->pi = g_state.rds.pi;
+  snprintf(segment->ps, sizeof(segment->ps), "%s", g_state.rds.ps);
+  snprintf(segment->rt, sizeof(segment->rt), "%s", g_state.rds.rt);
+}
+
+void stepLoopFor(uint32_t ms, RdsSegment* segment) {
+  const uint32_t startMs = millis();
+  while (millis() - startMs < ms) {
+    stepLoop();
+    trackSegment(segment);
+  }
+}
+
+uint8_t replayTrace(const uint8_t* data, size_t size, RdsSegment* segments, uint8_t maxSegments) {
+  size_t offset = 0;
+  if (!services::rdstrace::checkHeader(data, size, &offset)) {
+    return 0;
+  }
+  const app::RdsMode savedMode = g_state.global.rdsMode;
+  g_state.global.rdsMode = app::RdsMode::All;
+  services::rdscache::clear();  // decode every segment from its groups alone
+  sim::setRdsPlayback(true);
+
+  uint8_t count = 0;
+  RdsSegment* segment = nullptr;
+  const uint32_t baseMs = millis();
+  uint32_t clockMs = 0;
+  services::rdstrace::TraceRecord record{};
+  while (services::rdstrace::decodeRecord(data, size, &offset, &clockMs, &record)) {
+    if (millis() - baseMs < record.atMs) {
+      stepLoopFor(record.atMs - (millis() - baseMs), segment);
+    }
+    switch (record.type) {
+      case services::rdstrace::TraceRecordType::Tune:
+        closeSegment(segment);
+        segment = count < maxSegments ? &segments[count++] : nullptr;
+        selectBand(app::BandId::FM, app::Modulation::FM, record.frequencyKhz);
+        services::rds::reset(g_state);
+        if (segment != nullptr) {
+          openSegment(*segment, record.frequencyKhz);
+        }
+        break;
+      case services::rdstrace::TraceRecordType::Rsq:
+        sim::setPlaybackRsq(record.rssi, record.snr);
+        break;
+      case services::rdstrace::TraceRecordType::Group:
+        sim::queueRdsGroup(record.blocks, record.ble, record.syncFound, record.groupLost);
+        if (segment != nullptr) {
+          ++segment->groups;
+        }
+        break;
+    }
+  }
+  stepLoopFor(1000, segment);  // read out what is still queued
+  closeSegment(segment);
+
+  sim::setRdsPlayback(false);
+  g_state.global.rdsMode = savedMode;
+  return count;
+}
+
+// A trace file as written to flash, or a serial capture of "rdstrace dump" (':'-prefixed hex lines, anything
+// else ignored). Returns a malloc'd buffer.
+uint8_t* loadTraceFile(const char* path, size_t* size) {
+  FILE* fp = fopen(path, "rb");
+  if (fp == nullptr) {
+    return nullptr;
+  }
+  fseek(fp, 0, SEEK_END);
+  const long length = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  uint8_t* data = static_cast<uint8_t*>(malloc(length > 0 ? static_cast<size_t>(length) : 1));
+  *size = data != nullptr && length > 0 ? fread(data, 1, static_cast<size_t>(length), fp) : 0;
+  fclose(fp);
+  size_t offset = 0;
+  if (data == nullptr || services::rdstrace::checkHeader(data, *size, &offset)) {
+    return data;
+  }
+
+  size_t used = 0;
+  bool inLine = false;
+  bool hex = false;
+  int high = -1;
+  for (size_t i = 0; i < *size; ++i) {
+    const char c = static_cast<char>(data[i]);
+    if (c == '\n' || c == '\r') {
+      inLine = false;
+      hex = false;
+      high = -1;
+      continue;
+    }
+    if (!inLine) {
+      inLine = true;
+      hex = c == ':';
+      continue;
+    }
+    if (!hex || !isxdigit(static_cast<unsigned char>(c))) {
+      continue;
+    }
+    const int nibble = isdigit(static_cast<unsigned char>(c)) ? c - '0' : (tolower(c) - 'a' + 10);
+    if (high < 0) {
+      high = nibble;
+    } else {
+      data[used++] = static_cast<uint8_t>((high << 4) | nibble);  // never overtakes the text being read
+      high = -1;
+    }
+  }
+  *size = used;
+  return data;
+}
+
+void printSegment(const char* prefix, const RdsSegment& segment) {
+  Serial.printf("%s freq=%u pi=%04X ps=\"%s\" rt=\"%s\" first_ps_ms=%lu first_rt_ms=%lu groups=%lu\n",
+                prefix,
+                segment.frequencyKhz,
+                segment.pi,
+                segment.ps,
+                segment.rt,
+                static_cast<unsigned long>(segment.firstPsMs),
+                static_cast<unsigned long>(segment.firstRtMs),
+                static_cast<unsigned long>(segment.groups));
+}
+
+// "program replay <trace>": one replay line per tuned segment of a captured trace.
+int runReplayFile(const char* path) {
+  size_t size = 0;
+  uint8_t* data = loadTraceFile(path, &size);
+  if (data == nullptr) {
+    Serial.printf("replay: cannot read %s\n", path);
+    return 1;
+  }
+  RdsSegment segments[16];
+  const uint8_t count = replayTrace(data, size, segments, 16);
+  free(data);
+  if (count == 0) {
+    Serial.printf("replay: %s is not an RDS trace\n", path);
+    return 1;
+  }
+  for (uint8_t i = 0; i < count; ++i) {
+    printSegment("replay", segments[i]);
+  }
+  return 0;
+}
+
+// Record/replay round trip on the RDS network scenario: the firmware recorder captures the news station and
+// then the music station (AF, EON, CT and RT+ groups in the stream), and the replay has to reach the same PS,
+// RT and PI at about the same times.
+void runRdsTrace() {
+  sim::loadScenario(sim::rdsNetworkFmScenario());
+  const app::RdsMode savedMode = g_state.global.rdsMode;
+  g_state.global.rdsMode = app::RdsMode::All;
+  services::rdscache::clear();
+
+  RdsSegment live[2];
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  services::rds::reset(g_state);
+  sim::resetStats();
+  services::rdstrace::start(9040);
+  openSegment(live[0], 9040);
+  stepLoopFor(15000, &live[0]);
+  closeSegment(&live[0]);
+  selectBand(app::BandId::FM, app::Modulation::FM, 9580);  // the decoder's own reset records the retune
+  openSegment(live[1], 9580);
+  stepLoopFor(20000, &live[1]);
+  closeSegment(&live[1]);
+  services::rdstrace::stop();
+  const sim::SimStats& st = sim::stats();
+  const uint32_t liveGroups = st.rdsGroups;
+
+  size_t size = 0;
+  uint8_t* data = nullptr;
+  File file = LittleFS.open("/rds/trace.bin", "r");
+  if (file) {
+    size = file.size();
+    data = static_cast<uint8_t*>(malloc(size));
+    size = data != nullptr ? file.read(data, size) : 0;
+    file.close();
+  }
+  RdsSegment replayed[2] = {};
+  sim::resetStats();
+  const uint8_t count = data != nullptr ? replayTrace(data, size, replayed, 2) : 0;
+  free(data);
+
+  for (uint8_t i = 0; i < 2; ++i) {
+    const bool match = i < count && replayed[i].frequencyKhz == live[i].frequencyKhz && replayed[i].pi == live[i].pi &&
+                       strcmp(replayed[i].ps, live[i].ps) == 0 && strcmp(replayed[i].rt, live[i].rt) == 0;
+    Serial.printf("rds_trace freq=%u ps=\"%s\" live_ps_ms=%lu replay_ps_ms=%lu live_rt_ms=%lu replay_rt_ms=%lu "
+                  "replay_groups=%lu match=%u\n",
+                  live[i].frequencyKhz,
+                  live[i].ps,
+                  static_cast<unsigned long>(live[i].firstPsMs),
+                  static_cast<unsigned long>(replayed[i].firstPsMs),
+                  static_cast<unsigned long>(live[i].firstRtMs),
+                  static_cast<unsigned long>(replayed[i].firstRtMs),
+                  static_cast<unsigned long>(replayed[i].groups),
+                  match ? 1 : 0);
+    if (!match) {
+      ++g_failedChecks;
+    }
+  }
+  Serial.printf("rds_trace bytes=%lu bytes_per_group=%lu.%lu live_groups=%lu segments=%u\n",
+                static_cast<unsigned long>(size),
+                static_cast<unsigned long>(liveGroups != 0 ? size / liveGroups : 0),
+                static_cast<unsigned long>(liveGroups != 0 ? (size * 10 / liveGroups) % 10 : 0),
+                static_cast<unsigned long>(liveGroups),
+                count);
+
+  services::rdstrace::clear();
+  g_state.global.rdsMode = savedMode;
+  sim::loadScenario(sim::defaultFmScenario());
+}
+
+// One loop pass with rendering; counts passes where the panel differs from the sprite. With
+// ATS_UI_VERIFY_PARTIAL the sprite holds a full redraw of the current state after every partial frame.
+uint32_t g_panelMismatches = 0;
+
+void stepLoopWithUi() {
+  stepLoop();
+  services::ui::render(g_state);
+  const uint16_t* sprite = host::tftSpriteFrame();
+  if (sprite != nullptr &&
+      memcmp(sprite, host::tftPanel(), sizeof(uint16_t) * host::kTftWidth * host::kTftHeight) != 0) {
+    ++g_panelMismatches;
+  }
+}
+
+void stepLoopWithUiFor(uint32_t ms) {
+  const uint32_t startMs = millis();
+  while (millis() - startMs < ms) {
+    stepLoopWithUi();
+  }
+}
+
+// Scripted UI session: FM listen while RDS arrives, a tuning run, volume and transient HUDs, then MW
+// with the RSSI/SNR text line. Run with partial redraws on and off to compare panel traffic.
+void runUi(bool partial) {
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  services::rds::reset(g_state);
+  services::ui::setPartialRedraw(partial);
+  services::ui::resetRenderStats();
+  g_panelMismatches = 0;
+  const uint32_t pushedBefore = host::tftPixelsPushed();
+
+  stepLoopWithUiFor(10000);
+  for (uint8_t i = 0; i < 20; ++i) {
+    g_state.radio.frequencyKhz = static_cast<uint16_t>(g_state.radio.frequencyKhz + 10);
+    services::radio::requestApply(g_state);
+    stepLoopWithUiFor(150);
+  }
+  for (uint8_t i = 0; i < 5; ++i) {
+    g_state.radio.volume = static_cast<uint8_t>(g_state.radio.volume + 1);
+    services::ui::notifyVolumeAdjust(g_state.radio.volume);
+    stepLoopWithUiFor(200);
+  }
+  stepLoopWithUiFor(1500);
+  services::ui::notifyTransient("Memory saved");
+  stepLoopWithUiFor(2000);
+
+  sim::loadScenario(sim::defaultMwScenario());
+  selectBand(app::BandId::MW, app::Modulation::AM, 999);
+  stepLoopWithUiFor(5000);
+
+  services::ui::RenderStats rs{};
+  services::ui::renderStats(&rs);
+  const uint32_t frames = rs.fullFrames + rs.partialFrames;
+  const uint32_t pushed = host::tftPixelsPushed() - pushedBefore;
+  Serial.printf("ui partial=%u frames=%lu full=%lu partial_frames=%lu regions=%lu pushed_kpx=%lu px_per_frame=%lu "
+                "verified=%lu mismatched=%lu panel_mismatch=%lu async_push=%u\n",
+                partial ? 1 : 0,
+                static_cast<unsigned long>(frames),
+                static_cast<unsigned long>(rs.fullFrames),
+                static_cast<unsigned long>(rs.partialFrames),
+                static_cast<unsigned long>(rs.regions),
+                static_cast<unsigned long>(pushed / 1000),
+                static_cast<unsigned long>(frames > 0 ? pushed / frames : 0),
+                static_cast<unsigned long>(rs.verifiedFrames),
+                static_cast<unsigned long>(rs.mismatchedFrames),
+                static_cast<unsigned long>(g_panelMismatches),
+                rs.asyncPush ? 1 : 0);
+  if (rs.mismatchedFrames > 0 || g_panelMismatches > 0) {
+    ++g_failedChecks;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const bool benchOnly = argc > 1 && strcmp(argv[1], "bench") == 0;
+  const bool replayOnly = argc > 2 && strcmp(argv[1], "replay") == 0;
+  const uint32_t scans =
+      argc > 1 && !benchOnly && !replayOnly ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 20;
+
+  // ETM cache files go to a fresh directory unless the caller points ATS_HOST_FS somewhere.
+  static char fsDir[] = "/tmp/ats-native-XXXXXX";
+  if (getenv("ATS_HOST_FS") == nullptr && mkdtemp(fsDir) != nullptr) {
+    setenv("ATS_HOST_FS", fsDir, 1);
+  }
+  services::etmcache::begin();
+  services::rdscache::begin();
+
+  services::settings::load(g_state);
+  services::radio::prepareBootPower();
+  if (!services::radio::begin()) {
+    Serial.printf("radio init failed: %s\n", services::radio::lastError());
+    return 1;
+  }
+  services::radio::apply(g_state);
+  services::radio::applyRuntimeSettings(g_state);
+  services::aie::begin();
+  services::aie::setTargetVolume(g_state.radio.volume);
+
+  if (benchOnly) {
+    runBench();
+    return 0;
+  }
+  if (replayOnly) {
+    return runReplayFile(argv[2]);
+  }
+
+  sim::loadScenario(sim::defaultFmScenario());
+  selectBand(app::BandId::FM, app::Modulation::FM, 9040);
+  runSettleScans("FM", scans);
+
+  sim::loadScenario(sim::defaultMwScenario());
+  selectBand(app::BandId::MW, app::Modulation::AM, 999);
+  runSettleScans("MW", scans);
+
+  sim::loadScenario(sim::defaultSwScenario());
+  selectBand(app::BandId::BC49m, app::Modulation::AM, 6000);
+  runSettleScans("SW49", scans);
+
+  runCache();
+  runRefresh(15, RefreshAudio::Audible);
+  runRefresh(5, RefreshAudio::Squelched);
+  runRefresh(5, RefreshAudio::Muted);
+  runBandscope(60);
+  runBatch();
+  runBatchResume();
+  runStore();
+  runPeakFit();
+  runResume();
+  runSeek();
+  runBench();
+
+  sim::loadScenario(sim::defaultFmScenario());
+  runListen(9040, 60);
+  runRds(9040);
+  runWorker();
+  runRdsNetwork();
+  runAf(false);
+  runAf(true);
+  runAf(true, true);
+  runRdsNames();
+  runRdsPoll(0);
+  runRdsPoll(400);
+  runRdsTrace();
+  for (uint8_t errorPercent : {0, 10, 20, 30}) {
+    runRtVoting(errorPercent);
+  }
+  runIdentify(0, true);
+  runIdentify(1000, true);
+  runIdentify(3000, true);
+  runIdentify(3000, false);
+
+  services::ui::begin();
+  runUi(false);
+  runUi(true);
+  if (g_failedChecks > 0) {
+    Serial.printf("host checks failed=%lu\n", static_cast<unsigned long>(g_failedChecks));
+    return 1;
+  }
+  return 0;
+}
@@ -22,6 +22,15 @@ void begin();
 // Call once per loop iteration. Syncs cached state (muted, active); resets envelope when leaving Tune+NowPlaying.
 void tick(const app::AppState& state);
 
+// Mute slice for background work that retunes away from the listening channel (ETM refresh).
+// beginMuteSlice() drops like notifyTuning() and holds the envelope in DWELL; endMuteSlice()
+// restarts the dwell so BLOOM only begins once the original channel has settled again.
+// beginMuteSlice() returns false (and does nothing) when AIE is not active.
+// dwellMs shortens the dwell after the slice for callers that budget the whole interruption (AF following);
+// 0 keeps the normal dwell.
+bool beginMuteSlice();
+void endMuteSlice(uint16_t dwellMs = 0);
+
 // Call from main when about to change frequency (Tune + NowPlaying).
 // Updates last-move timestamp and performs synchronous instant mute (DROP).
 // Must be called *before* changeFrequency() so volume is down before setFrequency().
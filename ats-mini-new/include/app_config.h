@@ -18,4 +18,6 @@ inline constexpr uint32_t kSettingsSaveDebounceMs = 1500;
 inline constexpr uint32_t kSeekTimeoutMs = 45000;
 inline constexpr uint16_t kScanSettleMs = 85;
 inline constexpr uint32_t kSi473xPowerSettleMs = 100;
+/// Minimum spacing between frequency-only retunes while the encoder spins; later targets collapse into one.
+inline constexpr uint16_t kTuneSettleWindowMs = 40;
 }  // namespace app
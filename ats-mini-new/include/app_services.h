@@ -1,8 +1,10 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "app_state.h"
+#include "rsq_ring.h"
 
 namespace services {
 
@@ -29,6 +31,24 @@ struct RdsGroupSnapshot {
   uint8_t bleD;
 };
 
+// Radio worker counters: posts that were merged into an already queued command of the same type,
+// queued applies dropped because a synchronous apply() overtook them, and the worst post-to-start delay.
+// tunes counts setFrequency/band switches actually issued; deferredTunes the bursts held for the settle
+// window; rdsResets the RDS reconfigures issued and rdsResetsSkipped the ones a retune already covered.
+// bandConfigs counts full mode/band configurations (setFM/setAM/setSSB with amp off/on).
+struct WorkerStats {
+  uint32_t posted;
+  uint32_t coalesced;
+  uint32_t executed;
+  uint32_t superseded;
+  uint32_t maxQueueMs;
+  uint32_t tunes;
+  uint32_t deferredTunes;
+  uint32_t rdsResets;
+  uint32_t rdsResetsSkipped;
+  uint32_t bandConfigs;
+};
+
 void prepareBootPower();
 bool begin();
 bool ready();
@@ -37,12 +57,41 @@ void apply(const app::AppState& state);
 void applyVolumeOnly(uint8_t volume);
 void setAieMuted(bool muted);
 void applyRuntimeSettings(const app::AppState& state);
-bool seek(app::AppState& state, int8_t direction);
-bool seekForScan(app::AppState& state, int8_t direction);
+// Asynchronous apply + runtime settings for the UI loop; superseded requests collapse into the newest.
+void requestApply(const app::AppState& state);
+// Incremental hardware seek, driven by its owner's tick: start*() issues SEEK_START and returns, pollSeek()
+// reads the tuner at most every 10 ms and returns true once with the result. Input abort requests and
+// cancelSeek() end it at the next call. startSeek() is the user seek over the band (edge retry, hold aborts).
+bool startSeek(const app::AppState& state, int8_t direction);
+bool startScanSeek(const app::AppState& state, int8_t direction, uint16_t minKhz, uint16_t maxKhz, uint8_t spacingKhz);
+bool pollSeek(bool* found, uint16_t* frequencyKhz);
+void cancelSeek();
+uint16_t seekProgressKhz();
+void workerStats(WorkerStats* stats);
+void resetWorkerStats();
+void setTuneSettleWindowMs(uint16_t windowMs);
 bool lastSeekAborted();
+// Batch scans: configure once for [minKhz, maxKhz] so apply() on any band inside it in the same modulation
+// only retunes. Dropped by an apply() outside the span or by releaseTunerSpan().
+void holdTunerSpan(const app::AppState& state, uint16_t minKhz, uint16_t maxKhz);
+void releaseTunerSpan();
 void setMuted(bool muted);
 bool readSignalQuality(uint8_t* rssi, uint8_t* snr);
+bool readSignalQualityFresh(uint8_t* rssi, uint8_t* snr);
 bool readFullRsqFm(uint8_t* rssi, uint8_t* snr, int8_t* freqOff, bool* pilotPresent, uint8_t* multipath);
+// Measures another channel of the applied band without holding the radio across the settle: startProbe()
+// tunes away and returns, pollProbe() returns true once, settleMs later, with the reading and the tuner back
+// on the applied channel (*measured false when the read failed or an apply/seek cut the probe short).
+// cancelProbe() tunes back at once and drops the result. The caller keeps audio muted in between.
+bool startProbe(uint16_t frequencyKhz, uint16_t settleMs);
+bool pollProbe(bool* measured, uint8_t* rssi, uint8_t* snr);
+void cancelProbe();
+bool probeRunning();
+bool audioMuted();
+bool squelchClosed();
+bool latestSignalSample(RsqSample* sample);
+uint8_t signalHistory(RsqSample* samples, uint8_t maxSamples, uint32_t windowMs);
+void setSamplerPaused(bool paused);
 bool pollRdsGroup(RdsGroupSnapshot* snapshot);
 void resetRdsDecoder();
 void tick();
@@ -66,11 +115,38 @@ bool consumeAbortEventRequest();
 }  // namespace input
 
 namespace ui {
+// Render counters: frames drawn and pushed whole vs as dirty regions, regions pushed and panel pixels
+// sent. verifiedFrames/mismatchedFrames only move in ATS_UI_VERIFY_PARTIAL builds, where each partial
+// frame is compared with a full redraw of the same state.
+// Frame times: render is what render() spent composing and handing off a frame, push the panel transfer
+// (on the display task when asyncPush), fenceWaits the frames that had to wait for the previous transfer.
+struct RenderStats {
+  uint32_t fullFrames;
+  uint32_t partialFrames;
+  uint32_t regions;
+  uint32_t pushedPixels;
+  uint32_t verifiedFrames;
+  uint32_t mismatchedFrames;
+  uint32_t lastRenderUs;
+  uint32_t maxRenderUs;
+  uint32_t lastPushUs;
+  uint32_t maxPushUs;
+  uint32_t fenceWaits;
+  uint32_t maxFenceWaitUs;
+  bool asyncPush;
+};
+
 bool begin();
 void showBoot(const char* message);
 void notifyVolumeAdjust(uint8_t volume);
 void notifyTransient(const char* text);
 void render(const app::AppState& state);
+// Partial redraws are on by default; off pushes every frame whole. Either way the next frame is full.
+void setPartialRedraw(bool enabled);
+// Spectrum trace of etm::bandscope() above the bottom scale; on by default.
+void setBandscope(bool enabled);
+void renderStats(RenderStats* out);
+void resetRenderStats();
 }  // namespace ui
 
 namespace clock {
@@ -91,26 +167,164 @@ void requestSeek(int8_t direction);
 void requestCancel();
 bool busy();
 void syncContext(app::AppState& state);
-void notifySeekProgress(uint16_t frequencyKhz);
 bool tick(app::AppState& state);
 }  // namespace seekscan
 
 namespace etm {
+// Starts over; a checkpoint of this band is dropped.
 bool requestScan(const app::AppState& state);
+// Continues the checkpointed scan of this band/modulation/region/speed; false when there is none.
+bool resumeScan(const app::AppState& state);
+// Scans the bands in bandMask (app::bandMaskBit) back-to-back into one global index; busy() until done.
+bool requestBatchScan(const app::AppState& state, uint32_t bandMask);
+// Continues a cancelled batch over the same bandMask at its first unfinished band; false when there is none.
+bool resumeBatchScan(const app::AppState& state, uint32_t bandMask);
 bool tick(app::AppState& state);
 void requestCancel();
 bool busy();
+// A cancelled or interrupted scan of this band/modulation/region/speed is waiting in the checkpoint slot.
+bool hasCheckpoint(const app::AppState& state);
+// Same for a batch over bandMask at this region/speed.
+bool hasBatchCheckpoint(const app::AppState& state, uint32_t bandMask);
+// Next station above (direction > 0) or below the current frequency when ETM memory covers the current
+// band and that station was seen within maxAgeMs; 0 otherwise.
+uint16_t knownStationFrom(const app::AppState& state, int8_t direction, uint32_t maxAgeMs);
 void syncContext(app::AppState& state);
 void publishState(app::AppState& state);
 void addSeekResult(uint16_t frequencyKhz, uint8_t rssi, uint8_t snr);
+void setAdaptiveSettle(bool enabled);
+void setBackgroundRefresh(bool enabled);
+// True while the identify pass dwells on a station; rds::tick decodes it although a scan is running.
+bool identifying();
+bool tickBackgroundRefresh(app::AppState& state);
+// RSSI/SNR sweep of the band last passed to syncContext(); nullptr while nothing is measured.
+const app::EtmBandscope* bandscope();
+// Frequency-sorted stations of the last batch scan across its bands; nullptr while empty.
+const app::EtmGlobalIndex* stationIndex();
 void navigateNext(app::AppState& state);
 void navigatePrev(app::AppState& state);
 void navigateNearest(app::AppState& state);
 }  // namespace etm
 
+// Flash cache of ETM station lists (LittleFS), one file per (band, modulation, region).
+namespace etmcache {
+bool begin();
+bool load(uint8_t bandIndex, app::Modulation modulation, app::FmRegion region, app::EtmMemory& memory);
+bool store(const app::EtmMemory& memory, app::FmRegion region);
+// Single-slot scan checkpoint (/etm/resume.bin). loadCheckpoint() with null arrays reads the header only.
+bool storeCheckpoint(const app::EtmCheckpoint& checkpoint,
+                     const app::PsramArray<app::EtmCandidate>& candidates,
+                     const app::PsramArray<app::EtmCoarseSample>& samples);
+bool loadCheckpoint(app::EtmCheckpoint& checkpoint,
+                    app::PsramArray<app::EtmCandidate>* candidates,
+                    app::PsramArray<app::EtmCoarseSample>* samples);
+void clearCheckpoint();
+}  // namespace etmcache
+
+// Flash cache of RDS station names keyed by PI (LittleFS /rds/names.bin), so a retune can show a known
+// station's PS before live voting has confirmed it.
+namespace rdscache {
+struct StationName {
+  uint16_t pi;
+  uint16_t frequencyKhz;  // where the name was last heard
+  uint8_t pty;
+  uint8_t dynamicPs;      // PS changed within one listening session: not shown from the cache
+  char ps[app::kRdsPsCapacity];
+};
+
+// Mounts through etmcache::begin() and (re)loads the cache from flash.
+bool begin();
+bool lookup(uint16_t pi, StationName* out);
+void remember(const StationName& name);
+// Writes the cache once it has been unchanged for a while.
+void tick();
+void clear();
+uint16_t size();
+uint32_t flashWrites();
+}  // namespace rdscache
+
+// RDS group trace (LittleFS /rds/trace.bin): the raw groups rds::tick reads, with read times, the RSQ levels
+// it used and retunes, so PS/RT decoding can be replayed off air through the unmodified decoder on the host.
+namespace rdstrace {
+enum class TraceRecordType : uint8_t { Tune = 1, Rsq = 2, Group = 3 };
+
+struct TraceRecord {
+  TraceRecordType type;
+  uint32_t atMs;  // since start()
+  uint16_t frequencyKhz;
+  uint8_t rssi;
+  uint8_t snr;
+  uint16_t blocks[4];
+  uint8_t ble[4];
+  bool syncFound;
+  bool groupLost;
+  uint8_t fifoUsed;
+};
+
+// Truncates the trace and records from frequencyKhz on; stops by itself when the file reaches its cap.
+bool start(uint16_t frequencyKhz);
+void stop();
+bool recording();
+// Hooks for rds::tick; no-ops while not recording.
+void noteTune(uint16_t frequencyKhz);
+void noteRsq(uint8_t rssi, uint8_t snr);
+void noteGroup(const radio::RdsGroupSnapshot& group);
+// Prints the trace as ':'-prefixed hex lines between "[rdstrace] begin" and "[rdstrace] end".
+void dump();
+void clear();
+uint32_t bytes();
+// Reader shared with the host replay: checkHeader() positions *offset at the first record, decodeRecord()
+// returns the next one with its time in *clockMs (start at 0); false at the end or on a malformed record.
+bool checkHeader(const uint8_t* data, size_t size, size_t* offset);
+bool decodeRecord(const uint8_t* data, size_t size, size_t* offset, uint32_t* clockMs, TraceRecord* out);
+}  // namespace rdstrace
+
 namespace rds {
+// FIFO poller counters: groups read from the tuner, GRPLOST reports (the FIFO overflowed and dropped at least
+// one group before it was read), poll passes and the deepest FIFO seen; the per-second rates (x10) are averaged
+// over the last ~5 s window; pollMs is the cadence currently chosen.
+struct RdsStats {
+  uint32_t groups;
+  uint32_t lost;
+  uint32_t polls;
+  uint16_t groupsPerSecX10;
+  uint16_t lostPerSecX10;
+  uint16_t pollMs;
+  uint8_t maxFifo;
+};
+
 void tick(app::AppState& state);
 void reset(app::AppState& state);
+// PI the decoder has locked on for the tuned channel, whatever the RDS display mode; false while unlocked.
+bool votedPi(uint16_t* pi);
+// True while the tuned FM station is synced but its PS (or RT, when shown) is not complete yet; a retune
+// now would throw the acquisition away.
+bool acquiring(const app::AppState& state);
+void stats(RdsStats* out);
+void resetStats();
 }  // namespace rds
 
+// AF following: once the tuned programme's RDS quality stays weak, probe its AF list in short AIE mute
+// slices and move to the strongest transmitter whose RDS carries the same PI; the audio stays muted until the
+// PI check keeps or reverts the switch.
+namespace af {
+// attempts: mute windows spent probing or switching; probes: AFs measured; switches: retunes kept after a PI
+// match; reverts: retunes undone (other PI or no PI in time); maxMuteMs/lastMuteMs: audio interruption of
+// one window, PI check and revert retune and AIE dwell included.
+struct AfStats {
+  uint32_t attempts;
+  uint32_t probes;
+  uint32_t switches;
+  uint32_t reverts;
+  uint32_t maxMuteMs;
+  uint32_t lastMuteMs;
+};
+
+// Returns true when it retuned (state.radio.frequencyKhz changed).
+bool tick(app::AppState& state);
+void reset();
+void stats(AfStats* out);
+void resetStats();
+}  // namespace af
+
 }  // namespace services
@@ -17,6 +17,12 @@ inline constexpr size_t kWifiSsidCapacity = 33;
 inline constexpr size_t kWifiPasswordCapacity = 65;
 inline constexpr size_t kRdsPsCapacity = 9;
 inline constexpr size_t kRdsRtCapacity = 65;
+inline constexpr uint8_t kRdsAfCapacity = 25;  // longest AF list RDS can announce
+inline constexpr uint8_t kRdsEonCapacity = 4;
+inline constexpr uint8_t kRdsEonAfCapacity = 4;
+inline constexpr uint8_t kRdsRtPlusTagCount = 2;
+inline constexpr uint8_t kRdsRtPlusItemTitle = 1;
+inline constexpr uint8_t kRdsRtPlusItemArtist = 4;
 
 enum class OperationMode : uint8_t {
   Tune = 0,
@@ -124,11 +130,20 @@ struct SeekScanState {
   uint16_t bestFrequencyKhz;
   uint8_t bestRssi;
   uint16_t pointsVisited;
-  uint8_t foundCount;
+  uint16_t foundCount;
   int16_t foundIndex;
   bool fineScanActive;
   uint8_t cursorScanPass;
+  uint16_t cursorRdsPi;             // identity of the cursor station (ETM identify pass), 0 = none
+  char cursorRdsPs[kRdsPsCapacity];
   uint16_t totalPoints;
+  uint32_t scanDurationMs;  // elapsed time of the running ETM scan, or of the last completed one
+  uint8_t batchBand;        // 1-based band of a running batch scan, 0 when none runs
+  uint8_t batchBandCount;
+  uint16_t batchPointsVisited;  // coarse points over the whole batch
+  uint16_t batchTotalPoints;
+  uint32_t batchEtaMs;          // 0 until the first band has reported progress
+  uint16_t indexCount;          // stations in the global index
 };
 
 struct ClockState {
@@ -142,6 +157,34 @@ struct ClockState {
   uint32_t rdsBaseUptimeMs;
 };
 
+// AF entries are RDS carrier codes: code n is 87.5 MHz + n x 100 kHz (rdsAfCodeToFrequency()).
+struct RdsAfList {
+  uint8_t codes[kRdsAfCapacity];
+  uint32_t regionalMask;  // method B: bit i set when codes[i] carries a regional variant
+  uint8_t count;
+  uint8_t expected;       // announced length; method B counts alternatives only
+  uint8_t methodB;
+};
+
+// Other network (EON, group 14A) as last heard from the tuned station.
+struct RdsEonEntry {
+  uint16_t pi;
+  char ps[kRdsPsCapacity];
+  uint8_t psMask;  // PS segments received, bit per 2-char segment
+  uint8_t pty;
+  uint8_t hasPty;
+  uint8_t afCodes[kRdsEonAfCapacity];
+  uint8_t afCount;
+  uint32_t lastSeenMs;
+};
+
+// RadioText+ tag: a content-typed slice of the committed RT.
+struct RdsRtPlusTag {
+  uint8_t contentType;  // RT+ class, 0 = unused
+  uint8_t start;
+  uint8_t length;
+};
+
 struct RdsState {
   char ps[kRdsPsCapacity];
   char rt[kRdsRtCapacity];
@@ -149,6 +192,7 @@ struct RdsState {
   uint8_t pty;
   uint8_t quality;
   uint8_t hasPs;
+  uint8_t psCached;  // ps comes from the station name cache and live voting has not confirmed it yet
   uint8_t hasRt;
   uint8_t hasPi;
   uint8_t hasPty;
@@ -163,6 +207,12 @@ struct RdsState {
   uint32_t lastPiCommitMs;
   uint32_t lastPtyCommitMs;
   uint32_t lastCtCommitMs;
+  RdsAfList af;
+  RdsEonEntry eon[kRdsEonCapacity];
+  uint8_t eonCount;
+  RdsRtPlusTag rtPlus[kRdsRtPlusTagCount];
+  uint8_t hasRtPlus;
+  uint8_t rtPlusRunning;  // item running flag of the last RT+ group
 };
 
 struct GlobalSettings {
@@ -194,6 +244,8 @@ struct GlobalSettings {
 
   ScanSensitivity scanSensitivity;
   ScanSpeed scanSpeed;
+  uint16_t scanIdentifyDwellMs;  // FM scan identify pass budget per station (0 = off)
+  uint32_t scanBandMask;         // Scan on ALL: batch bands (app::bandMaskBit); 0 = one pass over ALL
 
   uint8_t memoryWriteIndex;
 };
@@ -272,6 +324,7 @@ inline void resetRdsState(RdsState& rds) {
   rds.pty = 0;
   rds.quality = 0;
   rds.hasPs = 0;
+  rds.psCached = 0;
   rds.hasRt = 0;
   rds.hasPi = 0;
   rds.hasPty = 0;
@@ -286,6 +339,52 @@ inline void resetRdsState(RdsState& rds) {
   rds.lastPiCommitMs = 0;
   rds.lastPtyCommitMs = 0;
   rds.lastCtCommitMs = 0;
+  memset(&rds.af, 0, sizeof(rds.af));
+  memset(rds.eon, 0, sizeof(rds.eon));
+  rds.eonCount = 0;
+  memset(rds.rtPlus, 0, sizeof(rds.rtPlus));
+  rds.hasRtPlus = 0;
+  rds.rtPlusRunning = 0;
+}
+
+// FM frequency (10 kHz units) of an RDS AF code, 0 for filler, count and LF/MF codes.
+inline constexpr uint16_t rdsAfCodeToFrequency(uint8_t code) {
+  return (code >= 1 && code <= 204) ? static_cast<uint16_t>(8750 + code * 10U) : 0;
+}
+
+inline constexpr uint8_t rdsAfCodeFromFrequency(uint16_t frequency) {
+  return (frequency > 8750 && frequency <= 10790 && (frequency - 8750) % 10 == 0)
+             ? static_cast<uint8_t>((frequency - 8750) / 10)
+             : 0;
+}
+
+// Copies the RT slice tagged with contentType into out; false when no such tag is held.
+inline bool rdsRtPlusText(const RdsState& rds, uint8_t contentType, char* out, size_t outSize) {
+  if (out == nullptr || outSize == 0) {
+    return false;
+  }
+  out[0] = '\0';
+  if (!rds.hasRtPlus || !rds.hasRt) {
+    return false;
+  }
+  const size_t rtLen = strlen(rds.rt);
+  for (uint8_t i = 0; i < kRdsRtPlusTagCount; ++i) {
+    const RdsRtPlusTag& tag = rds.rtPlus[i];
+    if (tag.contentType != contentType || tag.start >= rtLen) {
+      continue;
+    }
+    size_t len = tag.length;
+    if (tag.start + len > rtLen) {
+      len = rtLen - tag.start;
+    }
+    if (len > outSize - 1) {
+      len = outSize - 1;
+    }
+    memcpy(out, rds.rt + tag.start, len);
+    out[len] = '\0';
+    return true;
+  }
+  return false;
 }
 
 inline constexpr bool isSsb(Modulation modulation) {
@@ -533,7 +632,16 @@ inline AppState makeDefaultState() {
   state.seekScan.foundIndex = -1;
   state.seekScan.fineScanActive = false;
   state.seekScan.cursorScanPass = 0;
+  state.seekScan.cursorRdsPi = 0;
+  state.seekScan.cursorRdsPs[0] = '\0';
   state.seekScan.totalPoints = 0;
+  state.seekScan.scanDurationMs = 0;
+  state.seekScan.batchBand = 0;
+  state.seekScan.batchBandCount = 0;
+  state.seekScan.batchPointsVisited = 0;
+  state.seekScan.batchTotalPoints = 0;
+  state.seekScan.batchEtaMs = 0;
+  state.seekScan.indexCount = 0;
   resetClockState(state.clock);
   resetRdsState(state.rds);
 
@@ -563,6 +671,8 @@ inline AppState makeDefaultState() {
   state.global.usbMode = UsbMode::Auto;
   state.global.scanSensitivity = ScanSensitivity::High;
   state.global.scanSpeed = ScanSpeed::Thorough;
+  state.global.scanIdentifyDwellMs = kEtmIdentifyDwellDefaultMs;
+  state.global.scanBandMask = etmBatchPresetMask(kEtmBatchPresetDefault);
   state.global.memoryWriteIndex = 0;
 
   for (uint8_t i = 0; i < kBandCount; ++i) {
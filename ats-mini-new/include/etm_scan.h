@@ -3,6 +3,7 @@
 #include <stdint.h>
 
 #include "bandplan.h"
+#include "psram_array.h"
 
 namespace app {
 
@@ -16,6 +17,7 @@ enum class ScanSensitivity : uint8_t {
 enum class ScanSpeed : uint8_t {
   Fast = 0,
   Thorough = 1,
+  Hybrid = 2,  // native seek on SW broadcast segments, point stepping elsewhere and in dense stretches
 };
 
 struct EtmSensitivity {
@@ -44,12 +46,18 @@ constexpr uint8_t kScanPassFine = 2;    // fine-confirmed, highest confidence
 
 // --- Capacity constants ---
 
-constexpr uint8_t kEtmMaxStations = 120;
-constexpr uint8_t kEtmMaxCandidates = 128;
+// Stations and candidates live in PSRAM-backed arrays (psram_array.h) that grow on demand. Without PSRAM
+// they stay within the internal-RAM limits the fixed arrays used to have.
+constexpr uint16_t kEtmMaxStations = 2048;
+constexpr uint16_t kEtmMaxCandidates = 2048;
+constexpr uint16_t kEtmMaxStationsInternal = 120;
+constexpr uint16_t kEtmMaxCandidatesInternal = 128;
 constexpr uint8_t kEtmMaxFineWindows = 64;
 
 // --- Station memory (persistent, per band-context) ---
 
+constexpr uint8_t kEtmPsChars = 8;  // RDS PS length
+
 struct EtmStation {
   uint16_t frequencyKhz;
   uint8_t rssi;
@@ -57,17 +65,58 @@ struct EtmStation {
   uint8_t bandIndex;
   Modulation modulation;
   uint8_t scanPass;  // 0=seek-found, 1=coarse, 2=fine-confirmed
-  uint32_t lastSeenMs;
+  uint32_t lastSeenMs;   // last reading above the threshold (scan, seek or refresh hit)
+  uint32_t lastProbeMs;  // last background refresh probe, hit or miss
+  uint8_t misses;    // consecutive background refreshes below threshold
+  uint16_t rdsPi;    // FM identity from the identify pass: 0 = none
+  char rdsPs[kEtmPsChars + 1];  // "" = none
 };
 
 struct EtmMemory {
-  EtmStation stations[kEtmMaxStations];
-  uint8_t count;
+  PsramArray<EtmStation> stations{kEtmMaxStations, kEtmMaxStationsInternal};  // sorted by frequencyKhz
   int16_t cursor;     // -1 = none selected
   uint8_t bandIndex;  // memory is per band-context
   Modulation modulation;
 };
 
+// First station at or above frequencyKhz (stations.size() if none).
+inline uint16_t stationLowerBound(const EtmMemory& memory, uint16_t frequencyKhz) {
+  uint16_t lo = 0;
+  uint16_t hi = memory.stations.size();
+  while (lo < hi) {
+    const uint16_t mid = static_cast<uint16_t>(lo + (hi - lo) / 2);
+    if (memory.stations[mid].frequencyKhz < frequencyKhz) {
+      lo = static_cast<uint16_t>(mid + 1);
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// Station closest to frequencyKhz within maxDeltaKhz, or -1.
+inline int16_t findStationNear(const EtmMemory& memory, uint16_t frequencyKhz, uint16_t maxDeltaKhz) {
+  const uint16_t at = stationLowerBound(memory, frequencyKhz);
+  int16_t best = -1;
+  uint16_t bestDelta = 0;
+  if (at < memory.stations.size()) {
+    bestDelta = static_cast<uint16_t>(memory.stations[at].frequencyKhz - frequencyKhz);
+    if (bestDelta <= maxDeltaKhz) best = static_cast<int16_t>(at);
+  }
+  if (at > 0) {
+    const uint16_t delta = static_cast<uint16_t>(frequencyKhz - memory.stations[at - 1].frequencyKhz);
+    if (delta <= maxDeltaKhz && (best < 0 || delta < bestDelta)) best = static_cast<int16_t>(at - 1);
+  }
+  return best;
+}
+
+// Inserts at the sorted position (after equal frequencies); index, or -1 when the store is full.
+inline int16_t insertStation(EtmMemory& memory, const EtmStation& station) {
+  uint16_t at = stationLowerBound(memory, station.frequencyKhz);
+  while (at < memory.stations.size() && memory.stations[at].frequencyKhz == station.frequencyKhz) ++at;
+  return memory.stations.insert(at, station) ? static_cast<int16_t>(at) : -1;
+}
+
 // --- Segment (scan range with steps) ---
 
 struct EtmSegment {
@@ -83,19 +132,255 @@ struct EtmBandProfile {
   uint16_t coarseStepKhz;
   uint16_t fineStepKhz;
   uint16_t fineWindowKhz;   // ±window around each coarse candidate
-  uint16_t coarseSettleMs;   // settle time for coarse pass
+  uint16_t coarseSettleMs;   // settle time for coarse pass (upper bound in adaptive mode)
   uint16_t verifySettleMs;   // settle for FM verification pass (0 = no verify)
   uint16_t mergeDistanceKhz;
+  uint16_t adaptiveFirstReadMs;  // adaptive coarse: first RSQ read after tune
+  uint16_t adaptivePollMs;       // adaptive coarse: re-read interval until two samples agree
 };
 
 // All values in kHz for AM bands (MW/LW/SW). For FM, band limits are in 10 kHz units
 // (8750 = 87.5 MHz), so FM profile steps are also in 10 kHz units: 10 = 100 kHz.
 // FM: 30 ms coarse (permissive), 100 ms verify for Thorough; AM-family: no verify.
-inline constexpr EtmBandProfile kEtmProfileFm = {10, 0, 0, 30, 100, 9};   // coarse 30ms, verify 100ms, 90 kHz merge
-inline constexpr EtmBandProfile kEtmProfileMw9 = {9, 0, 0, 90, 0, 8};     // 9 kHz region
-inline constexpr EtmBandProfile kEtmProfileMw10 = {10, 0, 0, 90, 0, 9};  // 10 kHz region
-inline constexpr EtmBandProfile kEtmProfileLw = {9, 0, 0, 90, 0, 8};
-inline constexpr EtmBandProfile kEtmProfileSw = {5, 0, 0, 90, 0, 4};
+inline constexpr EtmBandProfile kEtmProfileFm = {10, 0, 0, 30, 100, 9, 10, 5};   // coarse 30ms, verify 100ms, 90 kHz merge
+inline constexpr EtmBandProfile kEtmProfileMw9 = {9, 0, 0, 90, 0, 8, 30, 10};     // 9 kHz region
+inline constexpr EtmBandProfile kEtmProfileMw10 = {10, 0, 0, 90, 0, 9, 30, 10};  // 10 kHz region
+inline constexpr EtmBandProfile kEtmProfileLw = {9, 0, 0, 90, 0, 8, 30, 10};
+inline constexpr EtmBandProfile kEtmProfileSw = {5, 0, 0, 90, 0, 4, 30, 10};
+
+// --- Adaptive coarse settle ---
+// Instead of always waiting coarseSettleMs, the coarse pass reads RSQ from adaptiveFirstReadMs
+// every adaptivePollMs and decides as soon as two consecutive samples agree. A stable reading is
+// rejected early only when it sits on the segment's noise floor; anything between the floor and
+// the threshold (a weak carrier still ramping) gets the full coarseSettleMs.
+
+inline constexpr bool kEtmAdaptiveSettleDefault = true;
+inline constexpr uint8_t kEtmSettleRssiToleranceDb = 3;  // two samples "agree" within this
+inline constexpr uint8_t kEtmSettleSnrToleranceDb = 2;
+inline constexpr uint8_t kEtmSettleFloorMarginDb = 2;    // "on the floor" = within this of the segment minimum
+
+// Per-band learned settle times of carrier points; caps the wait for readings that never agree.
+inline constexpr uint8_t kEtmSettleBucketMs = 5;
+inline constexpr uint8_t kEtmSettleBuckets = 24;          // covers 0..119 ms
+inline constexpr uint16_t kEtmSettleLearnMinSamples = 8;
+inline constexpr uint16_t kEtmSettleHistogramCap = 1024;  // halve counts past this to keep adapting
+inline constexpr uint8_t kEtmSettleLearnPercentile = 90;
+
+struct EtmSettleHistogram {
+  uint16_t buckets[kEtmSettleBuckets];
+  uint16_t samples;
+};
+
+// --- Hybrid scan (ScanSpeed::Hybrid) ---
+// Only SW broadcast segments seek; FM, LW, MW and utility segments are stepped as in Fast.
+// Native seek covers empty spectrum; a run of seek stops on adjacent raster points switches the
+// segment to point stepping until enough consecutive empty points go by.
+
+inline constexpr uint8_t kEtmHybridDenseStops = 2;
+inline constexpr uint8_t kEtmHybridQuietPoints = 3;
+
+// --- Background refresh (idle Tune + NowPlaying, no scan/seek running) ---
+// Revisits the stalest ETM station in one short probe: AIE mute slice, tune away, settle, read
+// RSQ, tune back. While audio plays a slice costs one AIE drop/dwell/bloom, so they are rare;
+// with the squelch closed there is nothing to hide and they run often. A user mute counts as audible:
+// the RDS on screen would lose sync on every slice.
+
+inline constexpr bool kEtmRefreshDefault = true;
+inline constexpr uint32_t kEtmRefreshIdleMs = 5000;           // listening channel unchanged this long
+inline constexpr uint32_t kEtmRefreshIntervalMs = 30000;      // one slice per interval while audible
+inline constexpr uint32_t kEtmRefreshSilentIntervalMs = 1000; // squelch closed
+inline constexpr uint32_t kEtmRefreshMinAgeMs = 60000;        // stations seen more recently are left alone
+inline constexpr uint8_t kEtmRefreshMaxMisses = 3;            // consecutive misses before a station ages out
+
+// --- Station identity (FM, optional, after Finalize has committed the stations) ---
+// Tunes each committed station and lets the RDS decoder run on it. A dwell ends as soon as PI is locked
+// and a PS is known (live, or from the PI-keyed name cache), at the per-station budget with whatever was
+// locked by then, or after kEtmIdentifySyncMs without a single group: no RDS, the station is skipped.
+
+inline constexpr uint16_t kEtmIdentifyDwellDefaultMs = 0;  // per-station budget; 0 = pass off
+inline constexpr uint16_t kEtmIdentifySyncMs = 500;
+inline constexpr uint16_t kEtmIdentifyPollMs = 20;
+// Budgets offered by the Scan ID setting (GlobalSettings::scanIdentifyDwellMs).
+inline constexpr uint16_t kEtmIdentifyDwellOptionsMs[] = {0, 1000, 2000, 3000, 5000};
+inline constexpr uint8_t kEtmIdentifyDwellOptionCount =
+    sizeof(kEtmIdentifyDwellOptionsMs) / sizeof(kEtmIdentifyDwellOptionsMs[0]);
+
+inline constexpr bool isEtmIdentifyDwellOption(uint16_t dwellMs) {
+  for (uint8_t i = 0; i < kEtmIdentifyDwellOptionCount; ++i) {
+    if (kEtmIdentifyDwellOptionsMs[i] == dwellMs) return true;
+  }
+  return false;
+}
+
+// --- Memory seek (Seek mode, services::seekscan) ---
+// A seek whose next station in that direction is in ETM memory and was seen recently (scan, seek or
+// refresh; stations loaded from the flash cache are never recent) tunes straight to it and confirms it
+// with one RSQ read after the coarse settle time. Only a station that fails the scan sensitivity falls
+// back to the hardware seek, which continues from there.
+
+inline constexpr uint32_t kEtmSeekMaxAgeMs = 1800000;
+
+// --- Bandscope (one per band, drawn above the bottom scale) ---
+// RSSI/SNR per scale pixel column. Scan passes write each measured point into the columns its raster
+// cell covers; background refresh keeps the listening channel and probed stations current and, while
+// audio is already silent, walks the band one raster point per slice.
+
+inline constexpr uint16_t kBandscopeColumns = 280;  // bottom scale x0=20 .. x1=300
+inline constexpr uint8_t kBandscopeUnmeasured = 0xFF;
+
+struct EtmBandscope {
+  uint8_t rssi[kBandscopeColumns];  // kBandscopeUnmeasured until a point in the column is read
+  uint8_t snr[kBandscopeColumns];
+  uint16_t minKhz;  // band limits the columns were laid out for; other limits (FM region) start over
+  uint16_t maxKhz;
+  uint16_t measuredColumns;
+  uint16_t sweepKhz;    // next point of the silent background walk
+  uint16_t generation;  // bumped on every write
+};
+
+// Same mapping as the bottom scale marker, folded onto the last column at maxKhz.
+inline constexpr uint16_t bandscopeColumnFor(uint16_t frequencyKhz, uint16_t minKhz, uint16_t maxKhz) {
+  if (maxKhz <= minKhz || frequencyKhz <= minKhz) return 0;
+  if (frequencyKhz >= maxKhz) return kBandscopeColumns - 1;
+  const uint32_t column = static_cast<uint32_t>(frequencyKhz - minKhz) * kBandscopeColumns / (maxKhz - minKhz);
+  return static_cast<uint16_t>(column < kBandscopeColumns ? column : kBandscopeColumns - 1);
+}
+
+// --- Batch scan and global station index ---
+// A batch walks a set of bands back-to-back (FM first, then AM bands by frequency), holding one tuner
+// configuration per modulation family so band changes inside it only retune. Each finished band is
+// folded into one frequency-sorted index that scan-mode navigation walks across bands.
+
+static_assert(kBandCount <= 32, "batch band masks are 32-bit");
+
+inline constexpr uint32_t bandMaskBit(uint8_t bandIndex) {
+  return 1UL << bandIndex;
+}
+
+inline constexpr bool isBroadcastBandId(BandId id) {
+  return id == BandId::MW || (id >= BandId::BC120m && id <= BandId::BC11m);
+}
+
+// MW and the broadcast SW bands: what the ALL band covers with its red-line segments.
+inline constexpr uint32_t broadcastBandMask() {
+  uint32_t mask = 0;
+  for (uint8_t i = 0; i < kBandCount; ++i) {
+    if (isBroadcastBandId(kBandPlan[i].id)) mask |= bandMaskBit(i);
+  }
+  return mask;
+}
+
+inline constexpr uint32_t bandIdMask(BandId id) {
+  for (uint8_t i = 0; i < kBandCount; ++i) {
+    if (kBandPlan[i].id == id) return bandMaskBit(i);
+  }
+  return 0;
+}
+
+// Presets of the Scan Bands setting (GlobalSettings::scanBandMask): the bands a long press on ALL batch-scans.
+// Mask 0 keeps the single pass over the ALL band's red-line segments, with no global index.
+inline constexpr uint8_t kEtmBatchPresetCount = 5;
+inline constexpr uint8_t kEtmBatchPresetDefault = 1;
+
+inline constexpr uint32_t etmBatchPresetMask(uint8_t preset) {
+  switch (preset) {
+    case 0:
+      return 0;
+    case 1:
+      return broadcastBandMask();
+    case 2:
+      return broadcastBandMask() & ~bandIdMask(BandId::MW);
+    case 3:
+      return broadcastBandMask() | bandIdMask(BandId::FM);
+    case 4:
+      return bandIdMask(BandId::LW) | bandIdMask(BandId::MW);
+  }
+  return broadcastBandMask();
+}
+
+// kEtmBatchPresetCount when mask is not one of the presets.
+inline constexpr uint8_t etmBatchPresetIndex(uint32_t mask) {
+  for (uint8_t i = 0; i < kEtmBatchPresetCount; ++i) {
+    if (etmBatchPresetMask(i) == mask) return i;
+  }
+  return kEtmBatchPresetCount;
+}
+
+inline constexpr uint16_t kEtmMaxIndexEntries = 4096;
+inline constexpr uint16_t kEtmMaxIndexEntriesInternal = 256;
+
+struct EtmIndexEntry {
+  uint16_t frequencyKhz;  // band units: 10 kHz on FM, kHz otherwise
+  uint8_t bandIndex;
+  Modulation modulation;
+  uint8_t rssi;
+  uint8_t snr;
+};
+
+struct EtmGlobalIndex {
+  PsramArray<EtmIndexEntry> entries{kEtmMaxIndexEntries, kEtmMaxIndexEntriesInternal};  // sorted by indexKeyKhz()
+  int16_t cursor;     // -1 = none selected
+  uint32_t bandMask;  // bands folded in by the last batch
+};
+
+inline constexpr uint32_t indexKeyKhz(const EtmIndexEntry& entry) {
+  return entry.modulation == Modulation::FM ? static_cast<uint32_t>(entry.frequencyKhz) * 10U : entry.frequencyKhz;
+}
+
+// First entry whose key is at or above keyKhz (entries.size() if none).
+inline uint16_t indexLowerBound(const EtmGlobalIndex& index, uint32_t keyKhz) {
+  uint16_t lo = 0;
+  uint16_t hi = index.entries.size();
+  while (lo < hi) {
+    const uint16_t mid = static_cast<uint16_t>(lo + (hi - lo) / 2);
+    if (indexKeyKhz(index.entries[mid]) < keyKhz) {
+      lo = static_cast<uint16_t>(mid + 1);
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// --- Coarse peak interpolation ---
+// Every coarse reading of a scan is kept (EtmCoarseSample). A candidate whose two raster neighbours were
+// both read gets a parabola through the three RSSI values: a clear local maximum is a carrier (Peak) whose
+// offset from the raster point follows from the fit without a retune. Candidates the scanner can explain as a
+// Peak's skirt are dropped. Thorough keeps them as Ambiguous for its follow-up pass (FM verify retune); in
+// Fast/Hybrid a skirt whose test used a reading that left adaptive settle early is a Shoulder until RecheckScan
+// reads it at full settle. Anything else, including segment edges, hybrid gaps and flat tops, stays Ambiguous.
+
+enum class EtmPeakFit : uint8_t {
+  Ambiguous = 0,
+  Peak = 1,
+  Shoulder = 2,
+};
+
+inline constexpr uint8_t kEtmPeakFitMinCurvatureDb = 4;    // left - 2*center + right at most -this for a Peak
+inline constexpr uint8_t kEtmPeakFitSkirtDb = 3;           // skirt vs. the Peak's far-side reading
+inline constexpr int16_t kEtmPeakFitLeanMilliSteps = 300;  // Peak fit this far towards a neighbour claims it
+inline constexpr uint16_t kEtmPeakFitShiftMaxStepKhz = 5;  // AM steps up to this (SW) move to the fitted kHz
+inline constexpr uint16_t kEtmMaxCoarseSamples = 4096;
+inline constexpr uint16_t kEtmMaxCoarseSamplesInternal = 512;
+
+struct EtmCoarseSample {
+  uint16_t frequencyKhz;
+  uint8_t rssi;
+  uint8_t segmentIndex;
+  bool early;  // read before the profile's coarseSettleMs (adaptive settle exit)
+};
+
+// Classifies a candidate from its RSSI and its raster neighbours'. For a Peak, *offsetMilliSteps is the
+// fitted carrier position relative to the candidate in 1/1000 coarse steps (|offset| < 500).
+inline constexpr EtmPeakFit fitPeak(uint8_t left, uint8_t center, uint8_t right, int16_t* offsetMilliSteps) {
+  const int16_t curvature = static_cast<int16_t>(left) - 2 * static_cast<int16_t>(center) + static_cast<int16_t>(right);
+  if (center > left && center > right && curvature <= -static_cast<int16_t>(kEtmPeakFitMinCurvatureDb)) {
+    *offsetMilliSteps = static_cast<int16_t>(500 * (static_cast<int16_t>(left) - static_cast<int16_t>(right)) / curvature);
+    return EtmPeakFit::Peak;
+  }
+  *offsetMilliSteps = 0;
+  return center < left || center < right ? EtmPeakFit::Shoulder : EtmPeakFit::Ambiguous;
+}
 
 // --- Working candidate (during scan only) ---
 
@@ -108,6 +393,7 @@ struct EtmCandidate {
   uint8_t multipath;    // MULT from RSQ; 0 if not verified
   uint8_t scanPass;     // 1=coarse, 2=fine-confirmed
   uint8_t segmentIndex;
+  EtmPeakFit peakFit;   // from the coarse samples at the end of the coarse pass
 };
 
 // --- Fine window (for Thorough mode second pass) ---
@@ -129,6 +415,41 @@ enum class EtmPhase : uint8_t {
   Finalize = 3,
   Cancelling = 4,
   VerifyScan = 5,  // FM Thorough: re-tune to each candidate, read full RSQ
+  SeekScan = 6,    // Hybrid: chained native seeks across each segment
+  IdentifyScan = 7,  // FM: dwell on each committed station for its RDS PI/PS
+  RecheckScan = 8,   // Fast/Hybrid: settled re-read of each Shoulder before the skirt test drops it
+};
+
+// --- Scan checkpoint (resume after cancel or power loss) ---
+// A standalone scan (not a batch band) saves its progress to flash every kEtmCheckpointIntervalMs of
+// coarse, hybrid or verify work and when it is cancelled; the candidates and coarse samples go with it.
+// A batch saves only its position: the first unfinished band, after every band and when it is cancelled.
+// Nothing resumes on its own: resumeScan()/resumeBatchScan() continue a matching checkpoint on the user's
+// choice, while requestScan() starts over. A finished scan deletes it. There is one checkpoint slot: the
+// newest interrupted scan.
+// The band may have changed since: a checkpoint older than kEtmCheckpointMaxAgeMs of uptime, or one that
+// has already survived kEtmCheckpointMaxPowerCycles restarts, is dropped. A checkpoint carried over a
+// restart counts its age from that boot (there is no wall clock).
+
+inline constexpr uint32_t kEtmCheckpointIntervalMs = 15000;
+inline constexpr uint32_t kEtmCheckpointMaxAgeMs = 30UL * 60UL * 1000UL;
+inline constexpr uint8_t kEtmCheckpointMaxPowerCycles = 1;
+
+struct EtmCheckpoint {
+  uint8_t bandIndex;        // batch: the first unfinished band
+  Modulation modulation;
+  FmRegion region;
+  ScanSpeed scanSpeed;
+  EtmPhase phase;           // CoarseScan, SeekScan or VerifyScan; Idle for a batch
+  uint8_t segmentIndex;
+  bool seekSegmentPrimed;   // SeekScan: segment start measured, currentKhz is the last stop
+  uint16_t currentKhz;      // CoarseScan: next point to measure
+  uint16_t pointsVisited;
+  uint16_t verifyIndex;     // VerifyScan: next candidate to verify
+  uint8_t floorRssi;
+  uint32_t elapsedMs;       // scan time before the checkpoint
+  uint32_t batchMask;       // batch: the bandMask it was started with; 0 for a standalone scan
+  uint8_t batchPos;         // batch: bands finished, in batch order
 };
 
 }  // namespace app
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Little-endian field access for the LittleFS formats (ETM cache, RDS name cache, RDS trace) and the FNV-1a
+// checksum they share with the settings blob. Records are packed byte by byte, independent of struct layout.
+
+namespace services {
+
+inline constexpr uint32_t kChecksumSeed = 2166136261u;
+
+// FNV-1a over bytes, continuing from acc so a file can be checksummed record by record.
+inline uint32_t checksumForBytes(const uint8_t* bytes, size_t length, uint32_t acc = kChecksumSeed) {
+  for (size_t i = 0; i < length; ++i) {
+    acc ^= bytes[i];
+    acc *= 16777619u;
+  }
+  return acc;
+}
+
+inline void put16(uint8_t* out, uint16_t value) {
+  out[0] = static_cast<uint8_t>(value & 0xFF);
+  out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+inline void put32(uint8_t* out, uint32_t value) {
+  put16(out, static_cast<uint16_t>(value & 0xFFFF));
+  put16(out + 2, static_cast<uint16_t>(value >> 16));
+}
+
+inline uint16_t get16(const uint8_t* in) { return static_cast<uint16_t>(in[0] | (static_cast<uint16_t>(in[1]) << 8)); }
+
+inline uint32_t get32(const uint8_t* in) { return get16(in) | (static_cast<uint32_t>(get16(in + 2)) << 16); }
+
+}  // namespace services
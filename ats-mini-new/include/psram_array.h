@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Growable array of trivially copyable records for the loop task. Storage comes from PSRAM (ps_realloc)
+// and grows geometrically up to limit; boards without PSRAM fall back to the internal heap, capped at
+// internalLimit so a large scan cannot starve the stacks and sprites. insert()/erase() shift with memmove,
+// so keeping the contents sorted costs one binary search plus a block move per record.
+
+namespace app {
+
+template <typename T>
+class PsramArray {
+ public:
+  PsramArray(uint16_t limit, uint16_t internalLimit) : limit_(limit), internalLimit_(internalLimit) {}
+  ~PsramArray() { free(data_); }
+  PsramArray(const PsramArray&) = delete;
+  PsramArray& operator=(const PsramArray&) = delete;
+
+  T& operator[](uint16_t index) { return data_[index]; }
+  const T& operator[](uint16_t index) const { return data_[index]; }
+
+  uint16_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  uint16_t capacity() const { return capacity_; }
+  // Entries the array may grow to on this board.
+  uint16_t limit() const { return psramFound() ? limit_ : internalLimit_; }
+  bool full() const { return size_ >= limit(); }
+
+  void clear() { size_ = 0; }
+
+  bool reserve(uint16_t count) {
+    if (count <= capacity_) return true;
+    if (count > limit()) return false;
+    uint32_t grown = capacity_ > 0 ? static_cast<uint32_t>(capacity_) * 2U : kInitialCapacity;
+    if (grown < count) grown = count;
+    if (grown > limit()) grown = limit();
+    void* moved = psramFound() ? ps_realloc(data_, grown * sizeof(T)) : realloc(data_, grown * sizeof(T));
+    if (moved == nullptr) return false;
+    data_ = static_cast<T*>(moved);
+    capacity_ = static_cast<uint16_t>(grown);
+    return true;
+  }
+
+  bool push_back(const T& value) { return insert(size_, value); }
+
+  // False when full or out of memory; the contents are unchanged then.
+  bool insert(uint16_t index, const T& value) {
+    if (index > size_ || !reserve(static_cast<uint16_t>(size_ + 1))) return false;
+    memmove(data_ + index + 1, data_ + index, static_cast<size_t>(size_ - index) * sizeof(T));
+    data_[index] = value;
+    ++size_;
+    return true;
+  }
+
+  void erase(uint16_t index) {
+    if (index >= size_) return;
+    memmove(data_ + index, data_ + index + 1, static_cast<size_t>(size_ - index - 1) * sizeof(T));
+    --size_;
+  }
+
+  // Moves the entry at from to index to, shifting the ones in between by one.
+  void move(uint16_t from, uint16_t to) {
+    if (from >= size_ || to >= size_ || from == to) return;
+    const T value = data_[from];
+    if (from < to) {
+      memmove(data_ + from, data_ + from + 1, static_cast<size_t>(to - from) * sizeof(T));
+    } else {
+      memmove(data_ + to + 1, data_ + to, static_cast<size_t>(from - to) * sizeof(T));
+    }
+    data_[to] = value;
+  }
+
+ private:
+  static constexpr uint16_t kInitialCapacity = 32;
+
+  T* data_ = nullptr;
+  uint16_t size_ = 0;
+  uint16_t capacity_ = 0;
+  uint16_t limit_;
+  uint16_t internalLimit_;
+};
+
+}  // namespace app
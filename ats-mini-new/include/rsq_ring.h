@@ -0,0 +1,104 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+// Timestamped RSSI/SNR samples from radio_service. One writer at a time (every push happens under
+// the radio mutex), any number of lock-free readers on either core. Each slot is a small seqlock:
+// readers copy the payload and accept it only if the slot tag is unchanged afterwards, so a reader
+// racing the writer drops that sample instead of seeing a torn one.
+
+namespace services::radio {
+
+struct RsqSample {
+  uint32_t sequence;     // monotonically increasing push counter
+  uint32_t timestampMs;  // millis() at the read
+  uint8_t rssi;
+  uint8_t snr;
+  uint16_t tuneEpoch;    // bumped on every retune; samples from an older epoch describe another channel
+};
+
+class RsqRing {
+ public:
+  static constexpr uint8_t kCapacity = 32;
+
+  // Producer side. Callers serialize pushes (radio mutex).
+  void push(uint32_t timestampMs, uint8_t rssi, uint8_t snr, uint16_t tuneEpoch) {
+    const uint32_t seq = head_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[seq % kCapacity];
+    slot.tag.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestampMs.store(timestampMs, std::memory_order_relaxed);
+    slot.payload.store(static_cast<uint32_t>(rssi) | (static_cast<uint32_t>(snr) << 8) |
+                           (static_cast<uint32_t>(tuneEpoch) << 16),
+                       std::memory_order_relaxed);
+    slot.tag.store(seq + 1, std::memory_order_release);
+    head_.store(seq + 1, std::memory_order_release);
+  }
+
+  // Number of samples pushed so far; the newest sample has sequence published() - 1.
+  uint32_t published() const { return head_.load(std::memory_order_acquire); }
+
+  // Reads one sample by sequence; false if not yet written, already overwritten, or being rewritten.
+  bool at(uint32_t seq, RsqSample& out) const {
+    const Slot& slot = slots_[seq % kCapacity];
+    if (slot.tag.load(std::memory_order_acquire) != seq + 1) {
+      return false;
+    }
+    const uint32_t timestampMs = slot.timestampMs.load(std::memory_order_relaxed);
+    const uint32_t payload = slot.payload.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.tag.load(std::memory_order_relaxed) != seq + 1) {
+      return false;
+    }
+    out.sequence = seq;
+    out.timestampMs = timestampMs;
+    out.rssi = static_cast<uint8_t>(payload & 0xFF);
+    out.snr = static_cast<uint8_t>((payload >> 8) & 0xFF);
+    out.tuneEpoch = static_cast<uint16_t>(payload >> 16);
+    return true;
+  }
+
+  bool latest(RsqSample& out) const {
+    // A concurrent push can only overwrite the oldest slot, so a retry from the new head succeeds.
+    for (uint8_t attempt = 0; attempt < 3; ++attempt) {
+      const uint32_t head = published();
+      if (head == 0) {
+        return false;
+      }
+      if (at(head - 1, out)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Newest-first copy of up to maxSamples samples of tuneEpoch taken at or after sinceMs.
+  uint8_t window(RsqSample* out, uint8_t maxSamples, uint32_t sinceMs, uint16_t tuneEpoch) const {
+    uint8_t count = 0;
+    const uint32_t head = published();
+    const uint32_t oldest = head > kCapacity ? head - kCapacity : 0;
+    for (uint32_t seq = head; seq > oldest && count < maxSamples; --seq) {
+      RsqSample sample{};
+      if (!at(seq - 1, sample) || sample.tuneEpoch != tuneEpoch ||
+          static_cast<int32_t>(sample.timestampMs - sinceMs) < 0) {
+        break;
+      }
+      out[count++] = sample;
+    }
+    return count;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<uint32_t> tag{0};  // sequence + 1 once complete, 0 while being written
+    std::atomic<uint32_t> timestampMs{0};
+    std::atomic<uint32_t> payload{0};
+  };
+
+  Slot slots_[kCapacity];
+  std::atomic<uint32_t> head_{0};
+};
+
+}  // namespace services::radio
@@ -20,10 +20,12 @@ enum class Item : uint8_t {
   UiLayout = 6,
   ScanSens = 7,
   ScanSpeed = 8,
-  About = 9,
+  ScanId = 9,
+  ScanBands = 10,
+  About = 11,
 };
 
-inline constexpr uint8_t kItemCount = 10;
+inline constexpr uint8_t kItemCount = 12;
 inline constexpr uint8_t kBrightnessMin = 20;   // Never allow 0 so user can always see menu
 inline constexpr uint8_t kBrightnessStep = 10;
 inline constexpr uint8_t kBrightnessMax = 250;
@@ -55,6 +57,10 @@ inline constexpr const char* itemLabel(Item item) {
       return "Scan Sens";
     case Item::ScanSpeed:
       return "Scan Speed";
+    case Item::ScanId:
+      return "Scan ID";
+    case Item::ScanBands:
+      return "Scan Bands";
     case Item::About:
       return "About";
   }
@@ -91,7 +97,11 @@ inline constexpr uint8_t valueCount(Item item) {
     case Item::ScanSens:
       return 2;  // Low, High
     case Item::ScanSpeed:
-      return 2;  // Fast, Thorough
+      return 3;  // Fast, Thorough, Hybrid
+    case Item::ScanId:
+      return kEtmIdentifyDwellOptionCount;  // Off, then the RDS dwell per station
+    case Item::ScanBands:
+      return kEtmBatchPresetCount;  // single ALL pass, then the batch band sets
     case Item::About:
       return 1;
   }
@@ -158,6 +168,31 @@ inline uint8_t clampBrightness(uint8_t brightness) {
   return brightness;
 }
 
+inline uint8_t identifyDwellToIndex(uint16_t dwellMs) {
+  for (uint8_t i = 0; i < kEtmIdentifyDwellOptionCount; ++i) {
+    if (kEtmIdentifyDwellOptionsMs[i] == dwellMs) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+inline constexpr const char* batchPresetLabel(uint8_t preset) {
+  switch (preset) {
+    case 0:
+      return "ALL 1x";
+    case 1:
+      return "MW+SW";
+    case 2:
+      return "SW";
+    case 3:
+      return "FM+MW+SW";
+    case 4:
+      return "LW+MW";
+  }
+  return "?";
+}
+
 inline uint8_t valueIndexForCurrent(const AppState& state, Item item) {
   switch (item) {
     case Item::Rds: {
@@ -191,7 +226,13 @@ inline uint8_t valueIndexForCurrent(const AppState& state, Item item) {
     }
     case Item::ScanSpeed: {
       const uint8_t s = static_cast<uint8_t>(state.global.scanSpeed);
-      return s > 1 ? 1 : s;
+      return s > 2 ? 1 : s;
+    }
+    case Item::ScanId:
+      return identifyDwellToIndex(state.global.scanIdentifyDwellMs);
+    case Item::ScanBands: {
+      const uint8_t preset = etmBatchPresetIndex(state.global.scanBandMask);
+      return preset < kEtmBatchPresetCount ? preset : kEtmBatchPresetDefault;
     }
     case Item::About:
       return 0;
@@ -236,6 +277,12 @@ inline void applyValue(AppState& state, Item item, uint8_t valueIndex) {
     case Item::ScanSpeed:
       state.global.scanSpeed = static_cast<app::ScanSpeed>(valueIndex % valueCount(item));
       break;
+    case Item::ScanId:
+      state.global.scanIdentifyDwellMs = kEtmIdentifyDwellOptionsMs[valueIndex % valueCount(item)];
+      break;
+    case Item::ScanBands:
+      state.global.scanBandMask = etmBatchPresetMask(valueIndex % valueCount(item));
+      break;
     case Item::About:
       break;
   }
@@ -292,9 +339,21 @@ inline void formatValue(const AppState& state, Item item, char* out, size_t outS
       return;
     }
     case Item::ScanSpeed: {
-      snprintf(out, outSize, "%s", state.global.scanSpeed == app::ScanSpeed::Thorough ? "Thorough" : "Fast");
+      static const char* kSpeed[] = {"Fast", "Thorough", "Hybrid"};
+      const uint8_t s = static_cast<uint8_t>(state.global.scanSpeed);
+      snprintf(out, outSize, "%s", kSpeed[s > 2 ? 1 : s]);
       return;
     }
+    case Item::ScanId:
+      if (state.global.scanIdentifyDwellMs == 0) {
+        snprintf(out, outSize, "Off");
+      } else {
+        snprintf(out, outSize, "%us", static_cast<unsigned>(state.global.scanIdentifyDwellMs / 1000));
+      }
+      return;
+    case Item::ScanBands:
+      snprintf(out, outSize, "%s", batchPresetLabel(valueIndexForCurrent(state, item)));
+      return;
     case Item::About:
       snprintf(out, outSize, "%s", app::kFirmwareVersion);
       return;
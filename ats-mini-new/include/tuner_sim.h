@@ -0,0 +1,228 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Deterministic SI4735 stand-in used by the host-native build (APP_TUNER_SIM).
+// radio_service.cpp binds g_rx to SimTuner instead of the PU2CLR driver, so the
+// scan/seek/RDS/squelch logic above it runs unmodified against a synthetic band.
+//
+// Frequencies use the same units as the tuner: kHz on AM, 10 kHz on FM (8750 = 87.5 MHz).
+
+namespace services::radio::sim {
+
+struct SimCarrier {
+  uint16_t frequencyKhz;
+  uint8_t rssi;           // dBuV when tuned exactly on the carrier
+  uint8_t snr;            // dB when tuned exactly on the carrier
+  uint8_t halfWidthKhz;   // falloff to the noise floor, tuner units (0 = single raster point)
+  int8_t freqOffKhz;      // FM only: reported FREQOFF on-carrier (transmitter/LO error)
+  bool pilot;             // FM stereo pilot
+  uint8_t multipath;      // FM MULT, 0..100
+  uint16_t rdsPi;         // 0 = no RDS on this carrier
+  uint8_t rdsPty;
+  const char* rdsPs;      // up to 8 chars, nullptr = none
+  const char* rdsRt;      // up to 64 chars, nullptr = none
+};
+
+struct SimScenario {
+  const SimCarrier* carriers;
+  uint16_t carrierCount;
+  uint8_t noiseRssi;       // floor reported away from any carrier
+  uint8_t noiseSnr;
+  uint8_t jitter;          // +/- dB of deterministic per-read noise
+  uint16_t settleMs;       // AGC/RSQ ramp after each tune
+  uint16_t seekStepMs;     // simulated dwell per raster point during native seek
+  uint8_t rdsMinSnr;       // below this SNR the RDS stream loses sync
+  uint32_t seed;
+};
+
+struct SimStats {
+  uint32_t tunes;
+  uint32_t rsqReads;
+  uint32_t rdsReads;
+  uint32_t rdsGroups;
+  uint32_t rdsGroupsLost;
+  uint32_t seekSteps;
+  uint16_t lastTuneKhz;  // frequency and time of the most recent retune
+  uint32_t lastTuneMs;
+};
+
+struct SimRdsStatus {
+  struct {
+    uint8_t RDSRECV;
+    uint8_t RDSSYNCLOST;
+    uint8_t RDSSYNCFOUND;
+    uint8_t RDSNEWBLOCKA;
+    uint8_t RDSNEWBLOCKB;
+    uint8_t RDSSYNC;
+    uint8_t GRPLOST;
+    uint8_t RDSFIFOUSED;
+    uint8_t BLOCKAH;
+    uint8_t BLOCKAL;
+    uint8_t BLOCKBH;
+    uint8_t BLOCKBL;
+    uint8_t BLOCKCH;
+    uint8_t BLOCKCL;
+    uint8_t BLOCKDH;
+    uint8_t BLOCKDL;
+    uint8_t BLED;
+    uint8_t BLEC;
+    uint8_t BLEB;
+    uint8_t BLEA;
+  } resp;
+};
+
+// Scenario control (host harness side).
+void loadScenario(const SimScenario& scenario);
+const SimScenario& scenario();
+const SimStats& stats();
+void resetStats();
+
+// Built-in scenarios so harnesses do not need to define their own tables.
+const SimScenario& defaultFmScenario();
+const SimScenario& defaultMwScenario();
+const SimScenario& defaultSwScenario();
+// Scan benchmark library: dense urban FM, weak FM DX, strong FM locals with adjacent-channel splatter,
+// crowded SW (49m) evening.
+const SimScenario& urbanFmScenario();
+const SimScenario& dxFmScenario();
+const SimScenario& splatterFmScenario();
+const SimScenario& swEveningScenario();
+// RDS network: one programme on three transmitters (AF list), two more programmes (EON), RT+ on one.
+const SimScenario& rdsNetworkFmScenario();
+// AF lists in the 0A stream use method B (per-transmitter pairs) instead of method A.
+void setAfMethodB(bool methodB);
+// Lists frequencyKhz in every AF list as well (an AF entry carrying another programme); 0 = off.
+void setAfExtra(uint16_t frequencyKhz);
+// The carrier on frequencyKhz loses dropDb of RSSI and SNR (a fading transmitter); 0 dB = off.
+void setCarrierFade(uint16_t frequencyKhz, uint8_t dropDb);
+// Hits each C/D block of the group stream with this probability (0 = off): three in four come out
+// uncorrectable (BLE 3), one in four miscorrected, a wrong character reported with BLE 1.
+void setRdsBlockErrors(uint8_t percent);
+// Trace playback for the RDS replay harness: while enabled, readRdsStatusRaw() serves only the groups queued
+// here (FIFO of the chip's depth, GRPLOST when it overflows, cleared by a retune) and RSQ reads return the
+// levels last set, so recorded groups reach rds_service.cpp through the normal radio path.
+void setRdsPlayback(bool enabled);
+void queueRdsGroup(const uint16_t blocks[4], const uint8_t ble[4], bool syncFound, bool groupLost);
+void setPlaybackRsq(uint8_t rssi, uint8_t snr);
+
+// Subset of the PU2CLR SI4735 API that radio_service.cpp uses, with the same names.
+class SimTuner {
+ public:
+  using RdsStatus = SimRdsStatus;
+
+  void setI2CFastModeCustom(uint32_t) {}
+  int16_t getDeviceI2CAddress(uint8_t) { return 0x11; }
+  void setup(uint8_t, uint8_t) {}
+  void setAudioMuteMcuPin(uint8_t) {}
+  void setMaxSeekTime(uint32_t) {}
+  void loadPatch(const uint8_t*, uint16_t) {}
+
+  void setFM(uint16_t minKhz, uint16_t maxKhz, uint16_t frequencyKhz, uint16_t stepKhz);
+  void setAM(uint16_t minKhz, uint16_t maxKhz, uint16_t frequencyKhz, uint16_t stepKhz);
+  void setSSB(uint16_t minKhz, uint16_t maxKhz, uint16_t frequencyKhz, uint16_t stepKhz, uint8_t usblsb);
+  void setFrequency(uint16_t frequencyKhz);
+  void setFrequencyStep(uint16_t stepKhz) { stepKhz_ = stepKhz; }
+  uint16_t getCurrentFrequency() const { return frequencyKhz_; }
+
+  void setSeekFmLimits(uint16_t minKhz, uint16_t maxKhz) { setSeekLimits(minKhz, maxKhz); }
+  void setSeekAmLimits(uint16_t minKhz, uint16_t maxKhz) { setSeekLimits(minKhz, maxKhz); }
+  void setSeekFmSpacing(uint16_t spacingKhz) { seekSpacingKhz_ = spacingKhz; }
+  void setSeekAmSpacing(uint16_t spacingKhz) { seekSpacingKhz_ = spacingKhz; }
+  void setSeekFmRssiThreshold(uint16_t value) { seekRssiMin_ = static_cast<uint8_t>(value); }
+  void setSeekAmRssiThreshold(uint16_t value) { seekRssiMin_ = static_cast<uint8_t>(value); }
+  void setSeekFmSNRThreshold(uint16_t value) { seekSnrMin_ = static_cast<uint8_t>(value); }
+  void setSeekAmSNRThreshold(uint16_t value) { seekSnrMin_ = static_cast<uint8_t>(value); }
+  // SEEK_START returns at once; the seek then advances one raster point per seekStepMs of virtual time and
+  // getStatus() reports it: READFREQ, STC once it stopped, VALID on a station, BLTF at the seek limit.
+  void seekStation(uint8_t seekUp, uint8_t wrap);
+  void getStatus(uint8_t intAck, uint8_t cancel);
+  uint16_t getFrequency() {
+    getStatus(0, 0);
+    return frequencyKhz_;
+  }
+  bool getTuneCompleteTriggered() const { return statusStc_; }
+  bool getStatusValid() const { return statusValid_; }
+  bool getBandLimit() const { return statusBandLimit_; }
+
+  void getCurrentReceivedSignalQuality();
+  uint8_t getCurrentRSSI() const { return rsqRssi_; }
+  uint8_t getCurrentSNR() const { return rsqSnr_; }
+  int8_t getCurrentSignedFrequencyOffset() const { return rsqFreqOff_; }
+  bool getCurrentPilot() const { return rsqPilot_; }
+  uint8_t getCurrentMultipath() const { return rsqMultipath_; }
+
+  void setRdsConfig(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t) {}
+  void setFifoCount(uint16_t) {}
+  void clearRdsBuffer() {}
+  void flushRdsFifo();
+  bool readRdsStatusRaw(SimRdsStatus& out, uint8_t intAck, uint8_t mtFifo, uint8_t statusOnly);
+
+  void setAudioMute(uint8_t mute) { muted_ = mute != 0; }
+  void setVolume(uint8_t volume) { volume_ = volume; }
+  void setFmBandwidth(uint8_t) {}
+  void setBandwidth(uint8_t, uint8_t) {}
+  void setSSBAudioBandwidth(uint8_t) {}
+  void setSSBSidebandCutoffFilter(uint8_t) {}
+  void setSSBAutomaticVolumeControl(uint8_t) {}
+  void setSSBBfo(int16_t) {}
+  void setAutomaticGainControl(uint8_t, uint8_t) {}
+  void setFmSoftMuteMaxAttenuation(uint8_t) {}
+  void setAmSoftMuteMaxAttenuation(uint8_t) {}
+  void setAMSoftMuteSnrThreshold(uint8_t) {}
+  void setFMDeEmphasis(uint8_t) {}
+  void setAvcAmMaxGain(uint8_t) {}
+
+  bool muted() const { return muted_; }
+  uint8_t volume() const { return volume_; }
+
+ private:
+  void setSeekLimits(uint16_t minKhz, uint16_t maxKhz) {
+    seekMinKhz_ = minKhz;
+    seekMaxKhz_ = maxKhz;
+  }
+  void retune(uint16_t frequencyKhz);
+  void finishSeek(bool valid, bool bandLimit);
+  void sampleAt(uint16_t frequencyKhz, uint32_t sinceTuneMs);
+  const SimCarrier* rdsCarrier() const;
+  bool readPlaybackStatus(SimRdsStatus& out, uint8_t mtFifo, uint8_t statusOnly);
+  void buildGroup(const SimCarrier& carrier, uint16_t blocks[4]);
+
+  bool fm_ = true;
+  uint16_t minKhz_ = 8750;
+  uint16_t maxKhz_ = 10800;
+  uint16_t stepKhz_ = 10;
+  uint16_t frequencyKhz_ = 8750;
+  uint32_t tunedAtMs_ = 0;
+
+  uint16_t seekMinKhz_ = 8750;
+  uint16_t seekMaxKhz_ = 10800;
+  uint16_t seekSpacingKhz_ = 10;
+  uint8_t seekRssiMin_ = 5;
+  uint8_t seekSnrMin_ = 2;
+  bool seeking_ = false;
+  bool seekUp_ = true;
+  uint32_t seekStepsDone_ = 0;
+  uint32_t seekStartMs_ = 0;
+  bool statusStc_ = false;
+  bool statusValid_ = false;
+  bool statusBandLimit_ = false;
+
+  uint8_t rsqRssi_ = 0;
+  uint8_t rsqSnr_ = 0;
+  int8_t rsqFreqOff_ = 0;
+  bool rsqPilot_ = false;
+  uint8_t rsqMultipath_ = 0;
+
+  uint32_t rdsClockMs_ = 0;
+  uint32_t rdsGroupIndex_ = 0;
+  uint8_t rdsFifo_ = 0;
+  bool rdsSync_ = false;
+  bool rdsGroupLost_ = false;
+
+  bool muted_ = false;
+  uint8_t volume_ = 0;
+};
+
+}  // namespace services::radio::sim
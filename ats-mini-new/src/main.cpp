@@ -1,5 +1,7 @@
 #include <Arduino.h>
 
+#include <string.h>
+
 #include "../include/aie_engine.h"
 #include "../include/app_config.h"
 #include "../include/app_services.h"
@@ -18,12 +20,18 @@ bool g_hasQuickEditFocusHistory = false;
 uint32_t g_lastTuneChangeMs = 0;
 bool g_tunePersistPending = false;
 uint32_t g_dialPadLastInputMs = 0;
+bool g_scanChoiceArmed = false;
+uint32_t g_scanChoiceArmedMs = 0;
+char g_serialLine[32];
+uint8_t g_serialLineLength = 0;
 
 constexpr uint32_t kQuickEditTimeoutMs = 10000;
 constexpr uint32_t kQuickEditFocusResumeMs = 8000;
 constexpr uint32_t kTunePersistIdleMs = 1200;
 constexpr uint32_t kDialPadTimeoutMs = 5000;
 constexpr uint32_t kDialPadErrorDisplayMs = 1500;
+constexpr uint32_t kScanChoiceTimeoutMs = 3000;
+constexpr char kScanChoicePrompt[] = "HOLD: RESUME  CLICK: NEW";
 constexpr int16_t kMaxSsbTuneOffsetHz = 14000;
 
 void applyRadioState(bool persistSettings);
@@ -245,8 +253,7 @@ void applyRadioState(bool persistSettings) {
   }
   app::syncPersistentStateFromRadio(g_state);
   services::seekscan::syncContext(g_state);
-  services::radio::apply(g_state);
-  services::radio::applyRuntimeSettings(g_state);
+  services::radio::requestApply(g_state);
 
   if (persistSettings) {
     services::settings::markDirty();
@@ -290,6 +297,33 @@ void setOperation(app::OperationMode operation) {
   setNowPlayingLayer();
 }
 
+// On ALL, Scan mode batch-scans the Scan Bands setting into the global station index instead; with that set
+// to the single pass it scans the ALL band like any other.
+bool scanIsBatch() {
+  return app::kBandPlan[g_state.radio.bandIndex].id == app::BandId::All && !app::isSsb(g_state.radio.modulation) &&
+         g_state.global.scanBandMask != 0;
+}
+
+// A cancelled or interrupted scan that the next Scan-mode long press can continue.
+bool scanResumable() {
+  if (app::isSsb(g_state.radio.modulation)) return false;
+  return scanIsBatch() ? services::etm::hasBatchCheckpoint(g_state, g_state.global.scanBandMask)
+                       : services::etm::hasCheckpoint(g_state);
+}
+
+void startScan(bool resume) {
+  const bool batch = scanIsBatch();
+  const uint32_t mask = g_state.global.scanBandMask;
+  const bool started = batch ? (resume ? services::etm::resumeBatchScan(g_state, mask)
+                                       : services::etm::requestBatchScan(g_state, mask))
+                             : (resume ? services::etm::resumeScan(g_state) : services::etm::requestScan(g_state));
+  if (started) {
+    if (resume) services::ui::notifyTransient("SCAN RESUMED");
+  } else if (app::isSsb(g_state.radio.modulation)) {
+    services::ui::notifyTransient("SCAN N/A IN SSB");
+  }
+}
+
 void cycleOperationMode() {
   const bool ssbMode = app::isSsb(g_state.radio.modulation);
   switch (g_state.ui.operation) {
@@ -298,6 +332,7 @@ void cycleOperationMode() {
       break;
     case app::OperationMode::Seek:
       setOperation(ssbMode ? app::OperationMode::Tune : app::OperationMode::Scan);
+      if (scanResumable()) services::ui::notifyTransient("HOLD: SCAN OR RESUME");
       break;
     case app::OperationMode::Scan:
       setOperation(app::OperationMode::Tune);
@@ -531,7 +566,7 @@ void applyQuickPopupSelection() {
       break;
     case app::QuickEditItem::Bandwidth:
       g_state.perBand[g_state.radio.bandIndex].bandwidthIndex = static_cast<uint8_t>(idx);
-      services::radio::applyRuntimeSettings(g_state);
+      services::radio::requestApply(g_state);
       services::settings::markDirty();
       break;
     case app::QuickEditItem::Agc:
@@ -541,12 +576,12 @@ void applyQuickPopupSelection() {
         g_state.global.agcEnabled = 0;
         g_state.global.avcLevel = app::quickedit::kAgcLevels[idx - 1];
       }
-      services::radio::applyRuntimeSettings(g_state);
+      services::radio::requestApply(g_state);
       services::settings::markDirty();
       break;
     case app::QuickEditItem::Sql:
       g_state.global.squelch = static_cast<uint8_t>(idx);
-      services::radio::applyRuntimeSettings(g_state);
+      services::radio::requestApply(g_state);
       services::settings::markDirty();
       break;
     case app::QuickEditItem::Avc: {
@@ -559,7 +594,7 @@ void applyQuickPopupSelection() {
       } else {
         g_state.global.avcAmLevel = avc;
       }
-      services::radio::applyRuntimeSettings(g_state);
+      services::radio::requestApply(g_state);
       services::settings::markDirty();
       break;
     }
@@ -580,7 +615,7 @@ void applyQuickPopupSelection() {
         g_state.global.sleepTimerMinutes = timers[timerIdx];
         g_state.global.sleepMode = timers[timerIdx] == 0 ? app::SleepMode::Disabled : app::SleepMode::DisplaySleep;
       }
-      services::radio::applyRuntimeSettings(g_state);
+      services::radio::requestApply(g_state);
       services::settings::markDirty();
       break;
     case app::QuickEditItem::Settings:
@@ -698,7 +733,7 @@ void applyActiveSettingsValue(uint8_t valueIndex) {
     return;
   }
 
-  services::radio::applyRuntimeSettings(g_state);
+  services::radio::requestApply(g_state);
   services::settings::markDirty();
 }
 
@@ -821,6 +856,7 @@ void handleRotation(int8_t delta) {
   }
 
   if (cancelActiveSeekOrScanIfBusy()) return;
+  g_scanChoiceArmed = false;
 
   const int8_t direction = delta > 0 ? -1 : 1;
   int8_t repeats = static_cast<int8_t>(abs(delta));
@@ -928,6 +964,13 @@ void handleSingleClick() {
     return;
   }
 
+  if (g_scanChoiceArmed && g_state.ui.operation == app::OperationMode::Scan) {
+    // Resume prompt is up: click starts over.
+    g_scanChoiceArmed = false;
+    startScan(false);
+    return;
+  }
+
   if (g_state.ui.operation == app::OperationMode::Tune ||
       g_state.ui.operation == app::OperationMode::Seek ||
       g_state.ui.operation == app::OperationMode::Scan) {
@@ -962,10 +1005,16 @@ void handleLongPress() {
     case app::UiLayer::NowPlaying:
       if (g_state.ui.operation == app::OperationMode::Scan) {
         (void)services::input::consumeEncoderDelta();
-        if (services::etm::requestScan(g_state)) {
-          // ETM scan started
-        } else if (app::isSsb(g_state.radio.modulation)) {
-          services::ui::notifyTransient("SCAN N/A IN SSB");
+        // With a resumable scan the first long press only asks; a second one resumes, a click starts over.
+        if (g_scanChoiceArmed) {
+          g_scanChoiceArmed = false;
+          startScan(true);
+        } else if (scanResumable()) {
+          g_scanChoiceArmed = true;
+          g_scanChoiceArmedMs = millis();
+          services::ui::notifyTransient(kScanChoicePrompt);
+        } else {
+          startScan(false);
         }
       } else if (g_state.ui.operation == app::OperationMode::Tune || g_state.ui.operation == app::OperationMode::Seek) {
         g_state.ui.layer = app::UiLayer::DialPad;
@@ -1027,6 +1076,36 @@ void handleButtonEvents() {
   }
 }
 
+// Serial console: "rdstrace start|stop|dump|clear" drives the RDS group recorder (start records the tuned
+// station and every retune after it).
+void handleSerialCommand(const char* line) {
+  if (strcmp(line, "rdstrace start") == 0) {
+    services::rdstrace::start(g_state.radio.frequencyKhz);
+  } else if (strcmp(line, "rdstrace stop") == 0) {
+    services::rdstrace::stop();
+  } else if (strcmp(line, "rdstrace dump") == 0) {
+    services::rdstrace::dump();
+  } else if (strcmp(line, "rdstrace clear") == 0) {
+    services::rdstrace::clear();
+    Serial.println("[rdstrace] cleared");
+  } else if (line[0] != '\0') {
+    Serial.printf("[main] unknown command: %s\n", line);
+  }
+}
+
+void pollSerialCommands() {
+  while (Serial.available() > 0) {
+    const int c = Serial.read();
+    if (c == '\r' || c == '\n') {
+      g_serialLine[g_serialLineLength] = '\0';
+      handleSerialCommand(g_serialLine);
+      g_serialLineLength = 0;
+    } else if (g_serialLineLength + 1U < sizeof(g_serialLine)) {
+      g_serialLine[g_serialLineLength++] = static_cast<char>(c);
+    }
+  }
+}
+
 }  // namespace
 
 void setup() {
@@ -1050,6 +1129,8 @@ void setup() {
 
   normalizeRadioStateForBand(g_state.radio, g_state.global.fmRegion);
   app::syncPersistentStateFromRadio(g_state);
+  services::etmcache::begin();
+  services::rdscache::begin();
   services::seekscan::syncContext(g_state);
   services::etm::syncContext(g_state);
   services::clock::tick(g_state);
@@ -1107,6 +1188,15 @@ void loop() {
     }
   }
 
+  if (g_scanChoiceArmed) {
+    if (millis() - g_scanChoiceArmedMs >= kScanChoiceTimeoutMs || g_state.ui.layer != app::UiLayer::NowPlaying ||
+        g_state.ui.operation != app::OperationMode::Scan) {
+      g_scanChoiceArmed = false;
+    } else {
+      services::ui::notifyTransient(kScanChoicePrompt);  // held up for the whole choice window
+    }
+  }
+
   bool seekScanStateChanged = false;
   if (services::etm::busy()) {
     seekScanStateChanged = services::etm::tick(g_state);
@@ -1120,6 +1210,8 @@ void loop() {
       services::etm::addSeekResult(g_state.radio.frequencyKhz, rssi, snr);
       services::etm::publishState(g_state);
     }
+  } else {
+    services::etm::tickBackgroundRefresh(g_state);
   }
   if (seekScanStateChanged && !services::etm::busy() && !services::seekscan::busy()) {
     scheduleTunePersist();
@@ -1129,8 +1221,13 @@ void loop() {
 
   services::radio::tick();
   services::rds::tick(g_state);
+  if (services::af::tick(g_state)) {
+    scheduleTunePersist();
+  }
+  services::rdscache::tick();
   services::clock::tick(g_state);
   services::settings::tick(g_state);
+  pollSerialCommands();
 
   const uint32_t nowMs = millis();
   if (nowMs - g_lastUiRenderMs >= app::kUiRefreshMs) {
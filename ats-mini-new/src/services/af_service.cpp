@@ -0,0 +1,354 @@
+#include <Arduino.h>
+
+#include <string.h>
+
+#include "../../include/aie_engine.h"
+#include "../../include/app_services.h"
+
+namespace services::af {
+namespace {
+
+constexpr uint8_t kAfWeakQuality = 20;           // rolling RDS quality below this counts as fading
+constexpr uint32_t kAfWeakHoldMs = 3000;         // ... for this long before the first attempt
+constexpr uint32_t kAfAttemptIntervalMs = 4000;  // between attempts while still weak
+constexpr uint8_t kAfNetworkMinQuality = 45;     // quality needed to take the AF list as the network's
+constexpr uint16_t kAfProbeSettleMs = 25;        // FM RSSI settle per probe
+constexpr uint16_t kAfTuneCostMs = 2;            // retune + RSQ read overhead per probe
+constexpr uint16_t kAfSliceDwellMs = 30;         // AIE dwell after the slice before audio blooms back
+constexpr uint16_t kAfMuteBudgetMs = 100;        // probe window per attempt, dwell and revert retune included
+constexpr uint8_t kAfSwitchMarginDb = 6;         // an AF must beat the tuned channel by this much
+constexpr uint8_t kAfMinRssi = 20;
+constexpr uint32_t kAfProbeMaxAgeMs = 20000;     // older probe results are measured again before switching
+constexpr uint32_t kAfPiVerifyMs = 2500;         // time the new transmitter gets to show the same PI, muted
+constexpr uint32_t kAfBadHoldMs = 60000;         // an AF that failed the PI check is skipped this long
+
+enum class Phase : uint8_t {
+  Idle = 0,
+  Verify = 1,  // retuned to an AF, audio held muted until its PI matches or the switch is reverted
+  Probe = 2,   // mute window open, one AF probe in flight per tick
+};
+
+struct AfEntry {
+  uint8_t code;
+  uint8_t rssi;
+  uint32_t probedAtMs;  // 0 = not measured yet
+  uint32_t badUntilMs;
+  uint16_t knownPi;  // PI carried on this frequency: from EON or an earlier PI check, 0 = not known
+};
+
+// The programme being followed: its PI and AF list as heard while reception was good.
+struct Network {
+  uint16_t pi;
+  uint16_t homeKhz;
+  AfEntry entries[app::kRdsAfCapacity];
+  uint8_t count;
+};
+
+Network g_net{};
+Phase g_phase = Phase::Idle;
+uint32_t g_weakSinceMs = 0;
+uint32_t g_lastAttemptMs = 0;
+uint8_t g_probeCursor = 0;
+uint16_t g_verifyFromKhz = 0;
+uint16_t g_verifyToKhz = 0;
+uint8_t g_verifyEntry = 0;
+uint32_t g_verifyStartMs = 0;
+uint8_t g_attemptHomeRssi = 0;
+bool g_attemptSlice = false;  // the attempt holds an AIE mute slice
+uint32_t g_sliceStartMs = 0;
+int8_t g_probeEntry = -1;     // entry whose probe is in flight
+AfStats g_stats{};
+
+bool followable(const app::AppState& state) {
+  return services::radio::ready() && state.radio.modulation == app::Modulation::FM &&
+         state.global.rdsMode != app::RdsMode::Off && !services::etm::busy() && !services::seekscan::busy() &&
+         !state.seekScan.active;
+}
+
+// Takes the decoder's AF list as the network's while the PI is locked and reception good. Measurements of
+// entries still in the list are kept.
+void learnNetwork(const app::AppState& state) {
+  uint16_t pi = 0;
+  if (state.rds.af.count == 0 || state.rds.quality < kAfNetworkMinQuality || !services::rds::votedPi(&pi)) {
+    return;
+  }
+  Network next{};
+  next.pi = pi;
+  next.homeKhz = state.radio.frequencyKhz;
+  for (uint8_t i = 0; i < state.rds.af.count; ++i) {
+    AfEntry entry{};
+    entry.code = state.rds.af.codes[i];
+    if (g_net.pi == pi) {
+      for (uint8_t j = 0; j < g_net.count; ++j) {
+        if (g_net.entries[j].code == entry.code) {
+          entry = g_net.entries[j];
+        }
+      }
+    }
+    // The tuned station's EON names the programme on a frequency it lists for another network.
+    for (uint8_t k = 0; k < state.rds.eonCount; ++k) {
+      const app::RdsEonEntry& eon = state.rds.eon[k];
+      for (uint8_t j = 0; j < eon.afCount; ++j) {
+        if (eon.afCodes[j] == entry.code && eon.pi != pi) {
+          entry.knownPi = eon.pi;
+        }
+      }
+    }
+    next.entries[next.count++] = entry;
+  }
+  g_net = next;
+}
+
+// Frequencies known to carry another programme are never probed or switched to.
+bool candidate(const AfEntry& entry, uint32_t nowMs) {
+  const uint16_t khz = app::rdsAfCodeToFrequency(entry.code);
+  return khz != 0 && khz != g_net.homeKhz && (entry.knownPi == 0 || entry.knownPi == g_net.pi) &&
+         (entry.badUntilMs == 0 || static_cast<int32_t>(nowMs - entry.badUntilMs) >= 0);
+}
+
+// True when a should be switched to rather than b: a frequency already known to carry the PI first, then RSSI.
+bool preferred(const AfEntry& a, const AfEntry& b) {
+  const bool aKnown = a.knownPi == g_net.pi;
+  const bool bKnown = b.knownPi == g_net.pi;
+  return aKnown != bKnown ? aKnown : a.rssi > b.rssi;
+}
+
+// Best recently probed candidate that clears the tuned channel by the switch margin; -1 when none.
+int8_t bestEntry(uint8_t homeRssi, uint32_t nowMs) {
+  int8_t best = -1;
+  for (uint8_t i = 0; i < g_net.count; ++i) {
+    const AfEntry& e = g_net.entries[i];
+    if (!candidate(e, nowMs) || e.probedAtMs == 0 || nowMs - e.probedAtMs > kAfProbeMaxAgeMs) {
+      continue;
+    }
+    if (e.rssi < kAfMinRssi || e.rssi < homeRssi + kAfSwitchMarginDb) {
+      continue;
+    }
+    if (best < 0 || preferred(e, g_net.entries[best])) {
+      best = static_cast<int8_t>(i);
+    }
+  }
+  return best;
+}
+
+void retune(app::AppState& state, uint16_t frequencyKhz) {
+  state.radio.frequencyKhz = frequencyKhz;
+  services::radio::apply(state);
+}
+
+// Ends the attempt and reopens the audio. The mute slice is booked as one interruption: probes, a switch and
+// its PI check or revert, the shortened dwell and the bloom pre-charge.
+void closeAttempt() {
+  ++g_stats.attempts;
+  if (!g_attemptSlice) {
+    return;
+  }
+  g_attemptSlice = false;
+  services::aie::endMuteSlice(kAfSliceDwellMs);
+  const uint32_t muteMs = (millis() - g_sliceStartMs) + kAfSliceDwellMs + services::aie::kPrechargeMs;
+  g_stats.lastMuteMs = muteMs;
+  if (muteMs > g_stats.maxMuteMs) {
+    g_stats.maxMuteMs = muteMs;
+  }
+}
+
+// Ends the probe window: switches to the best probed AF if it is clearly stronger than the tuned channel. The
+// audio stays muted across the switch until tickVerify() has the new transmitter's PI.
+bool finishAttempt(app::AppState& state, uint32_t nowMs) {
+  g_phase = Phase::Idle;
+  const int8_t best = bestEntry(g_attemptHomeRssi, nowMs);
+  if (best < 0) {
+    closeAttempt();
+    return false;
+  }
+  g_verifyFromKhz = state.radio.frequencyKhz;
+  g_verifyToKhz = app::rdsAfCodeToFrequency(g_net.entries[best].code);
+  g_verifyEntry = static_cast<uint8_t>(best);
+  g_verifyStartMs = nowMs;
+  g_phase = Phase::Verify;
+  retune(state, g_verifyToKhz);
+  Serial.printf("[af] %u -> %u (rssi %u vs %u), checking PI %04X\n",
+                static_cast<unsigned>(g_verifyFromKhz),
+                static_cast<unsigned>(g_verifyToKhz),
+                static_cast<unsigned>(g_net.entries[best].rssi),
+                static_cast<unsigned>(g_attemptHomeRssi),
+                static_cast<unsigned>(g_net.pi));
+  return true;
+}
+
+// Starts the next probe of the mute window, first the entries with no fresh measurement, round-robin while
+// the budget allows; probes that would overrun it wait for the next attempt. Without one the window ends.
+bool probeNext(app::AppState& state, uint32_t nowMs) {
+  const uint32_t sliceBudgetMs = kAfMuteBudgetMs - kAfSliceDwellMs - services::aie::kPrechargeMs;
+  for (uint8_t n = 0; n < g_net.count; ++n) {
+    const uint8_t i = static_cast<uint8_t>((g_probeCursor + n) % g_net.count);
+    const AfEntry& e = g_net.entries[i];
+    if (!candidate(e, nowMs) || (e.probedAtMs != 0 && nowMs - e.probedAtMs <= kAfProbeMaxAgeMs / 2)) {
+      continue;
+    }
+    // Keep room for the switch retune after the probes and for the retune back if the PI check fails.
+    if (millis() - g_sliceStartMs + kAfProbeSettleMs + 3U * kAfTuneCostMs > sliceBudgetMs) {
+      break;
+    }
+    g_probeCursor = static_cast<uint8_t>(i + 1);
+    if (services::radio::startProbe(app::rdsAfCodeToFrequency(e.code), kAfProbeSettleMs)) {
+      g_probeEntry = static_cast<int8_t>(i);
+      return false;
+    }
+  }
+  return finishAttempt(state, nowMs);
+}
+
+// One mute window over several ticks: probes run on the tuner while the loop keeps going.
+bool attempt(app::AppState& state, uint32_t nowMs) {
+  uint8_t homeSnr = 0;
+  g_attemptHomeRssi = 0;
+  services::radio::readSignalQuality(&g_attemptHomeRssi, &homeSnr);
+
+  const bool silent = state.ui.muted || services::radio::audioMuted();
+  g_attemptSlice = !silent && services::aie::beginMuteSlice();
+  if (!silent && !g_attemptSlice) {
+    return false;
+  }
+  g_sliceStartMs = millis();
+  g_probeEntry = -1;
+  g_phase = Phase::Probe;
+  return probeNext(state, nowMs);
+}
+
+// The programme stopped being followable or the user retuned mid-attempt: call a probe in flight back and
+// reopen the audio with the normal dwell.
+void abandonAttempt() {
+  if (g_phase == Phase::Probe) {
+    services::radio::cancelProbe();
+    g_probeEntry = -1;
+  }
+  if (g_attemptSlice) {
+    services::aie::endMuteSlice();
+    g_attemptSlice = false;
+  }
+  g_phase = Phase::Idle;
+}
+
+// Collects the probe in flight and starts the next one.
+bool tickProbe(app::AppState& state, uint32_t nowMs) {
+  if (state.radio.frequencyKhz != g_net.homeKhz) {
+    abandonAttempt();  // retuned by the user meanwhile
+    return false;
+  }
+  bool measured = false;
+  uint8_t rssi = 0;
+  uint8_t snr = 0;
+  if (!services::radio::pollProbe(&measured, &rssi, &snr)) {
+    return false;
+  }
+  if (measured && g_probeEntry >= 0) {
+    AfEntry& e = g_net.entries[g_probeEntry];
+    e.rssi = rssi;
+    e.probedAtMs = nowMs;
+    ++g_stats.probes;
+  }
+  g_probeEntry = -1;
+  return probeNext(state, nowMs);
+}
+
+// Waits, still muted, for the new transmitter's PI: the same PI keeps the switch and opens the audio, another
+// PI or none in time goes back inside the same mute slice.
+bool tickVerify(app::AppState& state, uint32_t nowMs) {
+  if (state.radio.frequencyKhz != g_verifyToKhz) {
+    abandonAttempt();  // retuned by the user meanwhile
+    return false;
+  }
+  uint16_t pi = 0;
+  const bool locked = services::rds::votedPi(&pi);
+  AfEntry& entry = g_net.entries[g_verifyEntry];
+  if (locked && pi == g_net.pi) {
+    g_phase = Phase::Idle;
+    entry.knownPi = pi;
+    for (uint8_t i = 0; i < g_net.count; ++i) {
+      if (app::rdsAfCodeToFrequency(g_net.entries[i].code) == g_verifyFromKhz) {
+        g_net.entries[i].knownPi = pi;  // the frequency left behind is a proven way back
+      }
+    }
+    g_net.homeKhz = g_verifyToKhz;
+    g_weakSinceMs = 0;
+    ++g_stats.switches;
+    closeAttempt();
+    return false;
+  }
+  if (!locked && nowMs - g_verifyStartMs < kAfPiVerifyMs) {
+    return false;
+  }
+
+  Serial.printf("[af] %u: %s, back to %u\n",
+                static_cast<unsigned>(g_verifyToKhz),
+                locked ? "other PI" : "no PI",
+                static_cast<unsigned>(g_verifyFromKhz));
+  entry.badUntilMs = nowMs + kAfBadHoldMs;
+  if (locked) {
+    entry.knownPi = pi;
+  }
+  g_phase = Phase::Idle;
+  g_lastAttemptMs = nowMs;
+  ++g_stats.reverts;
+  retune(state, g_verifyFromKhz);
+  closeAttempt();
+  return true;
+}
+
+}  // namespace
+
+bool tick(app::AppState& state) {
+  if (!followable(state)) {
+    abandonAttempt();
+    g_weakSinceMs = 0;
+    return false;
+  }
+
+  const uint32_t nowMs = millis();
+  if (g_phase == Phase::Verify) {
+    return tickVerify(state, nowMs);
+  }
+  if (g_phase == Phase::Probe) {
+    return tickProbe(state, nowMs);
+  }
+
+  if (state.radio.frequencyKhz != g_net.homeKhz) {
+    g_net = Network{};  // tuned elsewhere: a new programme, a new list
+    g_weakSinceMs = 0;
+  }
+  learnNetwork(state);
+
+  if (state.rds.quality >= kAfWeakQuality || g_net.count == 0) {
+    g_weakSinceMs = 0;
+    return false;
+  }
+  if (g_weakSinceMs == 0) {
+    g_weakSinceMs = nowMs;
+    return false;
+  }
+  if (nowMs - g_weakSinceMs < kAfWeakHoldMs || nowMs - g_lastAttemptMs < kAfAttemptIntervalMs ||
+      services::aie::isEnvelopeActive()) {
+    return false;
+  }
+  g_lastAttemptMs = nowMs;
+  return attempt(state, nowMs);
+}
+
+void reset() {
+  abandonAttempt();
+  g_net = Network{};
+  g_weakSinceMs = 0;
+  g_lastAttemptMs = 0;
+  g_probeCursor = 0;
+}
+
+void stats(AfStats* out) {
+  if (out != nullptr) {
+    *out = g_stats;
+  }
+}
+
+void resetStats() { g_stats = AfStats{}; }
+
+}  // namespace services::af
@@ -16,6 +16,7 @@ uint8_t g_targetVolume = kMaxVolume;
 uint8_t g_currentVolume = kMaxVolume;
 bool g_initialized = false;
 bool g_bloomUnmuted = false;  // true after pre-charge: we've called setAieMuted(false)
+bool g_sliceHeld = false;     // mute slice in progress: stay in DWELL until endMuteSlice()
 
 // Phase 2: 1 ms envelope driver (Option B)
 esp_timer_handle_t g_envelope_timer = nullptr;
@@ -55,6 +56,9 @@ void runEnvelopeStep() {
       break;
 
     case State::Dwell: {
+      if (g_sliceHeld) {
+        break;
+      }
       const int64_t dwellUs = g_cachedFm ? kDwellFmUs : kDwellUs;
       const int64_t elapsed = now - g_lastMoveTimeUs;
       if (elapsed >= dwellUs) {
@@ -118,6 +122,7 @@ void begin() {
   g_lastMoveTimeUs = 0;
   g_bloomStartTimeUs = 0;
   g_bloomUnmuted = false;
+  g_sliceHeld = false;
   g_cachedActive = false;
   g_cachedMuted = false;
   g_cachedFm = false;
@@ -159,6 +164,26 @@ void notifyTuning() {
   services::radio::setAieMuted(true);
 }
 
+bool beginMuteSlice() {
+  if (!g_initialized || !g_cachedActive) {
+    return false;
+  }
+  g_sliceHeld = true;
+  notifyTuning();
+  return true;
+}
+
+void endMuteSlice(uint16_t dwellMs) {
+  if (!g_sliceHeld) {
+    return;
+  }
+  // Back-date the last move so the dwell that follows lasts dwellMs instead of the full FM/AM dwell.
+  const int64_t dwellUs = g_cachedFm ? kDwellFmUs : kDwellUs;
+  const int64_t shortUs = static_cast<int64_t>(dwellMs) * 1000;
+  g_lastMoveTimeUs = esp_timer_get_time() - ((dwellMs > 0 && shortUs < dwellUs) ? dwellUs - shortUs : 0);
+  g_sliceHeld = false;
+}
+
 void setTargetVolume(uint8_t volume) {
   if (volume > kMaxVolume) {
     volume = kMaxVolume;
@@ -186,6 +211,7 @@ void tick(const app::AppState& state) {
   g_cachedFm = (state.radio.modulation == app::Modulation::FM);
 
   if (!g_cachedActive && g_state != State::Idle) {
+    g_sliceHeld = false;
     g_state = State::Idle;
     services::radio::setAieMuted(false);
     services::radio::applyVolumeOnly(g_targetVolume);
@@ -0,0 +1,460 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../../include/app_services.h"
+#include "../../include/bandplan.h"
+#include "../../include/etm_scan.h"
+#include "../../include/le_bytes.h"
+
+namespace services::etmcache {
+namespace {
+
+// One file per (band, modulation, region) under /etm, little-endian:
+//   u32 magic | u8 version | u8 bandId | u8 modulation | u8 region | u16 count | i16 cursor | u32 checksum
+//   count x { u16 frequencyKhz | u8 rssi | u8 snr | u8 scanPass | u16 rdsPi | 8 x PS char (NUL-padded) }
+// The checksum (FNV-1a) covers the records. lastSeenMs and lastProbeMs are uptime-relative and not stored. Records are
+// streamed through a small chunk buffer, so a list of any length costs no extra RAM.
+// Version 1 had a u8 count; its files fail the version check and are rescanned. Version 2 records stop
+// after scanPass (no identity) and still load.
+constexpr uint32_t kMagic = 0x434D5445;  // ETMC
+constexpr uint8_t kVersion = 3;
+constexpr uint8_t kVersionNoIdentity = 2;
+constexpr size_t kHeaderSize = 16;
+constexpr size_t kRecordSize = 7 + app::kEtmPsChars;
+constexpr size_t kRecordSizeNoIdentity = 5;
+constexpr uint16_t kChunkRecords = 64;
+constexpr char kDir[] = "/etm";
+constexpr char kBasePath[] = "/littlefs";
+constexpr char kPartitionLabel[] = "littlefs";
+constexpr uint8_t kMaxOpenFiles = 4;
+
+// Scan checkpoint, one slot, same integrity rules:
+//   u32 magic | u8 version | u8 bandId | u8 modulation | u8 region | u8 scanSpeed | u8 phase | u8 segment |
+//   u8 flags | u16 currentKhz | u16 pointsVisited | u16 verifyIndex | u8 floorRssi | u8 restarts |
+//   u32 elapsedMs | u16 candidates | u16 samples | u32 checksum | u32 savedAtMs | u32 batchMask | u8 batchPos |
+//   3 x u8 0
+//   candidates x { u16 frequencyKhz | u8 rssi | u8 snr | i8 freqOff | u8 pilot | u8 multipath | u8 scanPass |
+//                  u8 segment | u8 peakFit }
+//   samples x { u16 frequencyKhz | u8 rssi | u8 segment | u8 early }
+// savedAtMs is millis() at the save; begin() rewrites it to 0 and counts the restart, so the age bound runs
+// from that boot. A batch checkpoint has phase Idle, a non-zero batchMask and no records.
+constexpr uint32_t kCheckpointMagic = 0x4B4D5445;  // ETMK
+constexpr uint8_t kCheckpointVersion = 3;
+constexpr size_t kCheckpointHeaderSize = 44;
+constexpr size_t kCandidateRecordSize = 10;
+constexpr size_t kSampleRecordSize = 5;
+constexpr char kCheckpointPath[] = "/etm/resume.bin";
+constexpr char kCheckpointTmpPath[] = "/etm/resume.bin.tmp";
+
+bool g_ready = false;
+uint8_t g_header[kHeaderSize];
+uint8_t g_chunk[kChunkRecords * kRecordSize];
+uint8_t g_checkpointHeader[kCheckpointHeaderSize];
+
+void pathFor(char* out, size_t outSize, uint8_t bandIndex, app::Modulation modulation, app::FmRegion region) {
+  snprintf(out,
+           outSize,
+           "%s/b%02u-m%u-r%u.bin",
+           kDir,
+           static_cast<unsigned>(bandIndex),
+           static_cast<unsigned>(modulation),
+           static_cast<unsigned>(region));
+}
+
+void encodeCandidate(uint8_t* rec, const app::EtmCandidate& c) {
+  put16(rec, c.frequencyKhz);
+  rec[2] = c.rssi;
+  rec[3] = c.snr;
+  rec[4] = static_cast<uint8_t>(c.freqOff);
+  rec[5] = c.pilotPresent ? 1 : 0;
+  rec[6] = c.multipath;
+  rec[7] = c.scanPass;
+  rec[8] = c.segmentIndex;
+  rec[9] = static_cast<uint8_t>(c.peakFit);
+}
+
+app::EtmCandidate decodeCandidate(const uint8_t* rec) {
+  const app::EtmPeakFit fit = rec[9] <= static_cast<uint8_t>(app::EtmPeakFit::Shoulder)
+                                  ? static_cast<app::EtmPeakFit>(rec[9])
+                                  : app::EtmPeakFit::Ambiguous;
+  return {get16(rec), rec[2], rec[3], static_cast<int8_t>(rec[4]), rec[5] != 0, rec[6], rec[7], rec[8], fit};
+}
+
+void encodeSample(uint8_t* rec, const app::EtmCoarseSample& sample) {
+  put16(rec, sample.frequencyKhz);
+  rec[2] = sample.rssi;
+  rec[3] = sample.segmentIndex;
+  rec[4] = sample.early ? 1 : 0;
+}
+
+app::EtmCoarseSample decodeSample(const uint8_t* rec) { return {get16(rec), rec[2], rec[3], rec[4] != 0}; }
+
+void encodeStation(uint8_t* rec, const app::EtmStation& s) {
+  put16(rec, s.frequencyKhz);
+  rec[2] = s.rssi;
+  rec[3] = s.snr;
+  rec[4] = s.scanPass;
+  put16(rec + 5, s.rdsPi);
+  memset(rec + 7, 0, app::kEtmPsChars);
+  memcpy(rec + 7, s.rdsPs, strnlen(s.rdsPs, app::kEtmPsChars));
+}
+
+// Streams count records of recordSize through g_chunk; checksum-only when file is null.
+template <typename Array, typename Encode>
+bool writeRecords(File* file, const Array& records, size_t recordSize, Encode encode, uint32_t* checksum) {
+  const uint16_t perChunk = static_cast<uint16_t>(sizeof(g_chunk) / recordSize);
+  for (uint16_t done = 0; done < records.size();) {
+    const uint16_t left = static_cast<uint16_t>(records.size() - done);
+    const uint16_t n = left < perChunk ? left : perChunk;
+    for (uint16_t i = 0; i < n; ++i) encode(g_chunk + static_cast<size_t>(i) * recordSize, records[done + i]);
+    const size_t bytes = static_cast<size_t>(n) * recordSize;
+    *checksum = checksumForBytes(g_chunk, bytes, *checksum);
+    if (file != nullptr && file->write(g_chunk, bytes) != bytes) return false;
+    done = static_cast<uint16_t>(done + n);
+  }
+  return true;
+}
+
+template <typename Array, typename Decode>
+bool readRecords(File& file, uint16_t count, size_t recordSize, Array* records, Decode decode, uint32_t* checksum) {
+  const uint16_t perChunk = static_cast<uint16_t>(sizeof(g_chunk) / recordSize);
+  for (uint16_t done = 0; done < count;) {
+    const uint16_t left = static_cast<uint16_t>(count - done);
+    const uint16_t n = left < perChunk ? left : perChunk;
+    const size_t bytes = static_cast<size_t>(n) * recordSize;
+    if (file.read(g_chunk, bytes) != bytes) return false;
+    *checksum = checksumForBytes(g_chunk, bytes, *checksum);
+    for (uint16_t i = 0; i < n; ++i) {
+      if (!records->push_back(decode(g_chunk + static_cast<size_t>(i) * recordSize))) return false;
+    }
+    done = static_cast<uint16_t>(done + n);
+  }
+  return true;
+}
+
+void clearMemory(uint8_t bandIndex, app::Modulation modulation, app::EtmMemory& memory) {
+  memory.stations.clear();
+  memory.cursor = -1;
+  memory.bandIndex = bandIndex;
+  memory.modulation = modulation;
+}
+
+// At mount: a checkpoint left by the previous session ages by one restart and its uptime stamp restarts at
+// 0; one past kEtmCheckpointMaxPowerCycles is deleted. The header is patched into a copy (temp-and-rename).
+void ageCheckpointAtBoot() {
+  if (!LittleFS.exists(kCheckpointPath)) {
+    return;
+  }
+  File in = LittleFS.open(kCheckpointPath, "r");
+  if (!in) {
+    return;
+  }
+  uint8_t* h = g_checkpointHeader;
+  const bool headerRead = in.read(h, kCheckpointHeaderSize) == kCheckpointHeaderSize &&
+                          get32(h) == kCheckpointMagic && h[4] == kCheckpointVersion;
+  if (!headerRead || h[19] >= app::kEtmCheckpointMaxPowerCycles) {
+    in.close();
+    LittleFS.remove(kCheckpointPath);
+    Serial.printf("[etmcache] %s: %s, dropped\n", kCheckpointPath, headerRead ? "too old" : "bad header");
+    return;
+  }
+  h[19] = static_cast<uint8_t>(h[19] + 1);
+  put32(h + 32, 0);
+
+  File out = LittleFS.open(kCheckpointTmpPath, "w");
+  bool written = out && out.write(h, kCheckpointHeaderSize) == kCheckpointHeaderSize;
+  for (size_t n = written ? in.read(g_chunk, sizeof(g_chunk)) : 0; written && n > 0;
+       n = in.read(g_chunk, sizeof(g_chunk))) {
+    written = out.write(g_chunk, n) == n;
+  }
+  in.close();
+  out.close();
+  if (!written || !LittleFS.rename(kCheckpointTmpPath, kCheckpointPath)) {
+    LittleFS.remove(kCheckpointTmpPath);
+    LittleFS.remove(kCheckpointPath);
+    Serial.printf("[etmcache] %s: aging failed, dropped\n", kCheckpointPath);
+  }
+}
+
+}  // namespace
+
+bool begin() {
+  if (g_ready) {
+    return true;
+  }
+  if (!LittleFS.begin(true, kBasePath, kMaxOpenFiles, kPartitionLabel)) {
+    Serial.println("[etmcache] LittleFS mount failed");
+    return false;
+  }
+  if (!LittleFS.exists(kDir) && !LittleFS.mkdir(kDir)) {
+    Serial.println("[etmcache] mkdir failed");
+    return false;
+  }
+  ageCheckpointAtBoot();
+  g_ready = true;
+  return true;
+}
+
+bool load(uint8_t bandIndex, app::Modulation modulation, app::FmRegion region, app::EtmMemory& memory) {
+  clearMemory(bandIndex, modulation, memory);
+  if (!g_ready || bandIndex >= app::kBandCount) {
+    return false;
+  }
+
+  char path[32];
+  pathFor(path, sizeof(path), bandIndex, modulation, region);
+  if (!LittleFS.exists(path)) {
+    return false;
+  }
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    return false;
+  }
+  const size_t size = file.size();
+  const size_t headerBytes = file.read(g_header, kHeaderSize);
+
+  const app::BandDef& band = app::kBandPlan[bandIndex];
+  const uint16_t count = headerBytes == kHeaderSize ? get16(g_header + 8) : 0;
+  const size_t recordSize = g_header[4] == kVersionNoIdentity ? kRecordSizeNoIdentity : kRecordSize;
+  if (headerBytes != kHeaderSize || get32(g_header) != kMagic ||
+      (g_header[4] != kVersion && g_header[4] != kVersionNoIdentity) ||
+      g_header[5] != static_cast<uint8_t>(band.id) || g_header[6] != static_cast<uint8_t>(modulation) ||
+      g_header[7] != static_cast<uint8_t>(region) || count > app::kEtmMaxStations ||
+      size != kHeaderSize + static_cast<size_t>(count) * recordSize) {
+    file.close();
+    Serial.printf("[etmcache] %s: bad header, ignored\n", path);
+    return false;
+  }
+
+  // Records are stored in frequency order, so they append; anything the current band plan no longer
+  // covers (firmware update changed limits) is dropped.
+  const uint16_t minKhz = app::bandMinKhzFor(band, region);
+  const uint16_t maxKhz = app::bandMaxKhzFor(band, region);
+  uint32_t checksum = kChecksumSeed;
+  for (uint16_t done = 0; done < count;) {
+    const uint16_t left = static_cast<uint16_t>(count - done);
+    const uint16_t n = left < kChunkRecords ? left : kChunkRecords;
+    const size_t bytes = static_cast<size_t>(n) * recordSize;
+    if (file.read(g_chunk, bytes) != bytes) break;
+    checksum = checksumForBytes(g_chunk, bytes, checksum);
+    for (uint16_t i = 0; i < n; ++i) {
+      const uint8_t* rec = g_chunk + static_cast<size_t>(i) * recordSize;
+      const uint16_t frequencyKhz = get16(rec);
+      if (frequencyKhz < minKhz || frequencyKhz > maxKhz) {
+        continue;
+      }
+      const uint8_t scanPass = rec[4] > app::kScanPassFine ? app::kScanPassCoarse : rec[4];
+      app::EtmStation station{frequencyKhz, rec[2], rec[3], bandIndex, modulation, scanPass, 0, 0, 0, 0, ""};
+      if (recordSize == kRecordSize) {
+        station.rdsPi = get16(rec + 5);
+        memcpy(station.rdsPs, rec + 7, app::kEtmPsChars);
+      }
+      app::insertStation(memory, station);
+    }
+    done = static_cast<uint16_t>(done + n);
+  }
+  file.close();
+  if (checksum != get32(g_header + 12)) {
+    clearMemory(bandIndex, modulation, memory);
+    Serial.printf("[etmcache] %s: checksum mismatch, ignored\n", path);
+    return false;
+  }
+
+  const int16_t cursor = static_cast<int16_t>(get16(g_header + 10));
+  const int16_t stored = static_cast<int16_t>(memory.stations.size());
+  memory.cursor = (cursor >= 0 && cursor < stored) ? cursor : (stored > 0 ? 0 : -1);
+  return true;
+}
+
+bool store(const app::EtmMemory& memory, app::FmRegion region) {
+  if (!g_ready || memory.bandIndex >= app::kBandCount) {
+    return false;
+  }
+
+  char path[32];
+  pathFor(path, sizeof(path), memory.bandIndex, memory.modulation, region);
+  if (memory.stations.empty()) {
+    return !LittleFS.exists(path) || LittleFS.remove(path);
+  }
+
+  const uint16_t count = memory.stations.size();
+  uint32_t checksum = kChecksumSeed;
+  for (uint16_t i = 0; i < count; ++i) {
+    uint8_t rec[kRecordSize];
+    encodeStation(rec, memory.stations[i]);
+    checksum = checksumForBytes(rec, kRecordSize, checksum);
+  }
+  put32(g_header, kMagic);
+  g_header[4] = kVersion;
+  g_header[5] = static_cast<uint8_t>(app::kBandPlan[memory.bandIndex].id);
+  g_header[6] = static_cast<uint8_t>(memory.modulation);
+  g_header[7] = static_cast<uint8_t>(region);
+  put16(g_header + 8, count);
+  put16(g_header + 10, static_cast<uint16_t>(memory.cursor));
+  put32(g_header + 12, checksum);
+
+  // Write a temp file and rename over the old one so a power cut never leaves a torn cache.
+  char tmpPath[36];
+  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+  File file = LittleFS.open(tmpPath, "w");
+  if (!file) {
+    return false;
+  }
+  bool written = file.write(g_header, kHeaderSize) == kHeaderSize;
+  for (uint16_t done = 0; written && done < count;) {
+    const uint16_t left = static_cast<uint16_t>(count - done);
+    const uint16_t n = left < kChunkRecords ? left : kChunkRecords;
+    for (uint16_t i = 0; i < n; ++i) {
+      encodeStation(g_chunk + static_cast<size_t>(i) * kRecordSize, memory.stations[done + i]);
+    }
+    const size_t bytes = static_cast<size_t>(n) * kRecordSize;
+    written = file.write(g_chunk, bytes) == bytes;
+    done = static_cast<uint16_t>(done + n);
+  }
+  file.close();
+  if (!written || !LittleFS.rename(tmpPath, path)) {
+    LittleFS.remove(tmpPath);
+    Serial.printf("[etmcache] %s: write failed\n", path);
+    return false;
+  }
+  return true;
+}
+
+bool storeCheckpoint(const app::EtmCheckpoint& checkpoint,
+                     const app::PsramArray<app::EtmCandidate>& candidates,
+                     const app::PsramArray<app::EtmCoarseSample>& samples) {
+  if (!g_ready || checkpoint.bandIndex >= app::kBandCount) {
+    return false;
+  }
+
+  uint32_t checksum = kChecksumSeed;
+  writeRecords(nullptr, candidates, kCandidateRecordSize, encodeCandidate, &checksum);
+  writeRecords(nullptr, samples, kSampleRecordSize, encodeSample, &checksum);
+  uint8_t* h = g_checkpointHeader;
+  put32(h, kCheckpointMagic);
+  h[4] = kCheckpointVersion;
+  h[5] = static_cast<uint8_t>(app::kBandPlan[checkpoint.bandIndex].id);
+  h[6] = static_cast<uint8_t>(checkpoint.modulation);
+  h[7] = static_cast<uint8_t>(checkpoint.region);
+  h[8] = static_cast<uint8_t>(checkpoint.scanSpeed);
+  h[9] = static_cast<uint8_t>(checkpoint.phase);
+  h[10] = checkpoint.segmentIndex;
+  h[11] = checkpoint.seekSegmentPrimed ? 1 : 0;
+  put16(h + 12, checkpoint.currentKhz);
+  put16(h + 14, checkpoint.pointsVisited);
+  put16(h + 16, checkpoint.verifyIndex);
+  h[18] = checkpoint.floorRssi;
+  h[19] = 0;
+  put32(h + 20, checkpoint.elapsedMs);
+  put16(h + 24, candidates.size());
+  put16(h + 26, samples.size());
+  put32(h + 28, checksum);
+  put32(h + 32, millis());
+  put32(h + 36, checkpoint.batchMask);
+  h[40] = checkpoint.batchPos;
+  h[41] = 0;
+  h[42] = 0;
+  h[43] = 0;
+
+  // Same temp-and-rename as the station lists: a power cut mid-write keeps the previous checkpoint.
+  File file = LittleFS.open(kCheckpointTmpPath, "w");
+  if (!file) {
+    return false;
+  }
+  checksum = kChecksumSeed;
+  bool written = file.write(h, kCheckpointHeaderSize) == kCheckpointHeaderSize &&
+                 writeRecords(&file, candidates, kCandidateRecordSize, encodeCandidate, &checksum) &&
+                 writeRecords(&file, samples, kSampleRecordSize, encodeSample, &checksum);
+  file.close();
+  if (!written || !LittleFS.rename(kCheckpointTmpPath, kCheckpointPath)) {
+    LittleFS.remove(kCheckpointTmpPath);
+    Serial.printf("[etmcache] %s: write failed\n", kCheckpointPath);
+    return false;
+  }
+  return true;
+}
+
+bool loadCheckpoint(app::EtmCheckpoint& checkpoint,
+                    app::PsramArray<app::EtmCandidate>* candidates,
+                    app::PsramArray<app::EtmCoarseSample>* samples) {
+  if (!g_ready || !LittleFS.exists(kCheckpointPath)) {
+    return false;
+  }
+  File file = LittleFS.open(kCheckpointPath, "r");
+  if (!file) {
+    return false;
+  }
+  const size_t size = file.size();
+  const uint8_t* h = g_checkpointHeader;
+  const bool headerRead = file.read(g_checkpointHeader, kCheckpointHeaderSize) == kCheckpointHeaderSize;
+  const uint16_t candidateCount = headerRead ? get16(h + 24) : 0;
+  const uint16_t sampleCount = headerRead ? get16(h + 26) : 0;
+  uint8_t bandIndex = app::kBandCount;
+  for (uint8_t i = 0; headerRead && i < app::kBandCount; ++i) {
+    if (static_cast<uint8_t>(app::kBandPlan[i].id) == h[5]) bandIndex = i;
+  }
+  const bool batch = headerRead && get32(h + 36) != 0;
+  const bool phaseOk = batch ? h[9] == static_cast<uint8_t>(app::EtmPhase::Idle) && candidateCount == 0 && sampleCount == 0
+                             : h[9] == static_cast<uint8_t>(app::EtmPhase::CoarseScan) ||
+                                   h[9] == static_cast<uint8_t>(app::EtmPhase::SeekScan) ||
+                                   h[9] == static_cast<uint8_t>(app::EtmPhase::VerifyScan);
+  if (!headerRead || get32(h) != kCheckpointMagic || h[4] != kCheckpointVersion || bandIndex >= app::kBandCount ||
+      !phaseOk || h[8] > static_cast<uint8_t>(app::ScanSpeed::Hybrid) ||
+      size != kCheckpointHeaderSize + static_cast<size_t>(candidateCount) * kCandidateRecordSize +
+                  static_cast<size_t>(sampleCount) * kSampleRecordSize) {
+    file.close();
+    Serial.printf("[etmcache] %s: bad header, ignored\n", kCheckpointPath);
+    return false;
+  }
+  if (millis() - get32(h + 32) > app::kEtmCheckpointMaxAgeMs) {
+    file.close();
+    LittleFS.remove(kCheckpointPath);
+    Serial.printf("[etmcache] %s: expired, dropped\n", kCheckpointPath);
+    return false;
+  }
+
+  checkpoint.bandIndex = bandIndex;
+  checkpoint.modulation = static_cast<app::Modulation>(h[6]);
+  checkpoint.region = static_cast<app::FmRegion>(h[7]);
+  checkpoint.scanSpeed = static_cast<app::ScanSpeed>(h[8]);
+  checkpoint.phase = static_cast<app::EtmPhase>(h[9]);
+  checkpoint.segmentIndex = h[10];
+  checkpoint.seekSegmentPrimed = h[11] != 0;
+  checkpoint.currentKhz = get16(h + 12);
+  checkpoint.pointsVisited = get16(h + 14);
+  checkpoint.verifyIndex = get16(h + 16);
+  checkpoint.floorRssi = h[18];
+  checkpoint.elapsedMs = get32(h + 20);
+  checkpoint.batchMask = get32(h + 36);
+  checkpoint.batchPos = h[40];
+  if (candidates == nullptr || samples == nullptr) {
+    file.close();
+    return true;
+  }
+
+  const uint32_t expected = get32(h + 28);
+  uint32_t checksum = kChecksumSeed;
+  candidates->clear();
+  samples->clear();
+  const bool read = readRecords(file, candidateCount, kCandidateRecordSize, candidates, decodeCandidate, &checksum) &&
+                    readRecords(file, sampleCount, kSampleRecordSize, samples, decodeSample, &checksum);
+  file.close();
+  if (!read || checksum != expected) {
+    candidates->clear();
+    samples->clear();
+    Serial.printf("[etmcache] %s: checksum mismatch, ignored\n", kCheckpointPath);
+    return false;
+  }
+  return true;
+}
+
+void clearCheckpoint() {
+  if (g_ready && LittleFS.exists(kCheckpointPath)) {
+    LittleFS.remove(kCheckpointPath);
+  }
+}
+
+}  // namespace services::etmcache
@@ -1,5 +1,7 @@
 #include <Arduino.h>
+#include <string.h>
 
+#include "../../include/aie_engine.h"
 #include "../../include/app_services.h"
 #include "../../include/app_state.h"
 #include "../../include/bandplan.h"
@@ -14,6 +16,10 @@ static inline uint16_t absDeltaKhz(uint16_t a, uint16_t b) {
   return a >= b ? static_cast<uint16_t>(a - b) : static_cast<uint16_t>(b - a);
 }
 
+static inline uint8_t absDelta8(uint8_t a, uint8_t b) {
+  return a >= b ? static_cast<uint8_t>(a - b) : static_cast<uint8_t>(b - a);
+}
+
 static const app::EtmBandProfile* profileForBand(const app::AppState& state,
                                                 const app::BandDef& band,
                                                 uint16_t segmentMinKhz,
@@ -109,58 +115,18 @@ class EtmScanner {
  public:
   EtmScanner() = default;
 
-  bool requestScan(const app::AppState& state) {
+  // A fresh scan drops a checkpoint of the same band; resume continues a matching one (see resumeScan()).
+  bool requestScan(const app::AppState& state, bool resume = false) {
     if (app::isSsb(state.radio.modulation)) return false;
 
+    dropRefreshProbe();
     syncContext(state);
-    segmentCount_ = 0;
-    candidateCount_ = 0;
+    candidates_.clear();
+    coarseSamples_.clear();
     restoreKhz_ = state.radio.frequencyKhz;
     bandIndex_ = state.radio.bandIndex;
     modulation_ = state.radio.modulation;
-
-    const app::BandDef& band = app::kBandPlan[state.radio.bandIndex];
-    const uint16_t bandMinKhz = app::bandMinKhzFor(band, state.global.fmRegion);
-    const uint16_t bandMaxKhz = app::bandMaxKhzFor(band, state.global.fmRegion);
-
-    if (state.radio.modulation == app::Modulation::FM) {
-      if (!addSegment(state, bandMinKhz, bandMaxKhz, band)) return false;
-    } else {
-      if (band.id == app::BandId::All) {
-        for (size_t i = 0; i < app::kBroadcastRedLineAllCount; ++i) {
-          const app::SubBandDef& sub = app::kBroadcastRedLineAll[i];
-          uint16_t minKhz = sub.minKhz > bandMinKhz ? sub.minKhz : bandMinKhz;
-          uint16_t maxKhz = sub.maxKhz < bandMaxKhz ? sub.maxKhz : bandMaxKhz;
-          if (minKhz > maxKhz) continue;
-          const bool isMw = sub.minKhz >= 500 && sub.maxKhz <= 1705;
-          if (isMw && !alignMwSegmentToRaster(minKhz, maxKhz, state)) continue;
-          const app::EtmBandProfile* prof = profileForBand(state, band, minKhz, maxKhz);
-          if (!addSegmentWithProfile(state, minKhz, maxKhz, prof)) return false;
-        }
-      } else if (isBroadcastSwBand(band.id)) {
-        bool added = false;
-        for (size_t i = 0; i < app::kBroadcastRedLineSwCount; ++i) {
-          const app::SubBandDef& sub = app::kBroadcastRedLineSw[i];
-          uint16_t minKhz = sub.minKhz > bandMinKhz ? sub.minKhz : bandMinKhz;
-          uint16_t maxKhz = sub.maxKhz < bandMaxKhz ? sub.maxKhz : bandMaxKhz;
-          if (minKhz <= maxKhz && addSegment(state, minKhz, maxKhz, band)) added = true;
-        }
-        if (!added) addSegment(state, bandMinKhz, bandMaxKhz, band);
-      } else if (band.id == app::BandId::MW) {
-        uint16_t minKhz = bandMinKhz, maxKhz = bandMaxKhz;
-        if (alignMwSegmentToRaster(minKhz, maxKhz, state))
-          addSegment(state, minKhz, maxKhz, band);
-        else
-          addSegment(state, bandMinKhz, bandMaxKhz, band);
-      } else {
-        addSegment(state, bandMinKhz, bandMaxKhz, band);
-      }
-    }
-
-    if (segmentCount_ == 0) {
-      addSegment(state, bandMinKhz, bandMaxKhz, band);
-    }
-    if (segmentCount_ == 0) return false;
+    if (!buildSegments(state, bandIndex_, modulation_)) return false;
 
     totalPoints_ = 0;
     for (uint8_t i = 0; i < segmentCount_; ++i)
@@ -172,23 +138,117 @@ class EtmScanner {
     awaitingMeasure_ = false;
     nextActionMs_ = 0;
     settleMs_ = segmentProfiles_[0]->coarseSettleMs;
-    phase_ = app::EtmPhase::CoarseScan;
+    scanStartMs_ = millis();
+    scanDurationMs_ = 0;
+    floorRssi_ = 0xFF;
+    hybrid_ = state.global.scanSpeed == app::ScanSpeed::Hybrid;
+    const app::BandId bandId = app::kBandPlan[bandIndex_].id;
+    hybridSeeksSw_ = hybrid_ && (isBroadcastSwBand(bandId) || bandId == app::BandId::All);
+    seekSegmentPrimed_ = false;
+    seekInFlight_ = false;
+    seekStops_ = 0;
+    verifySettleMs_ = 0;
+    verifyAwaitingMeasure_ = false;
+    recheckIndex_ = 0;
+    recheckAwaitingMeasure_ = false;
+    peakFits_ = 0;
+    shouldersDropped_ = 0;
+    shouldersRechecked_ = 0;
+    identifyRan_ = false;
+    phase_ = seeksSegment(0) ? app::EtmPhase::SeekScan : app::EtmPhase::CoarseScan;
+    scanSpeed_ = state.global.scanSpeed;
+    scanRegion_ = state.global.fmRegion;
+    resumablePhase_ = app::EtmPhase::Idle;
+    lastCheckpointMs_ = scanStartMs_;
+    checkpointed_ = false;
+    resumed_ = false;
+    if (!batchActive_) resume ? resumeFromCheckpoint() : dropSupersededCheckpoint();
+    // The scanner paces its own RSQ reads against the settle time; background samples taken
+    // mid-settle would otherwise be served back to it as current.
+    services::radio::setSamplerPaused(true);
+    return true;
+  }
+
+  // Continues the checkpointed scan of this band, modulation, region and speed; false when there is none.
+  bool resumeScan(const app::AppState& state) { return hasCheckpoint(state) && requestScan(state, true); }
+
+  // Batch scan over the bands in bandMask; the radio is back on its current band/frequency afterwards.
+  // resume continues a cancelled batch over the same bandMask at its first unfinished band.
+  bool requestBatchScan(const app::AppState& state, uint32_t bandMask, bool resume = false) {
+    if (busy() || (resume && !hasBatchCheckpoint(state, bandMask))) return false;
+    dropRefreshProbe();
+    batchCount_ = 0;
+    for (uint8_t i = 0; i < app::kBandCount; ++i) {
+      if ((bandMask & app::bandMaskBit(i)) == 0 || !batchScannable(i)) continue;
+      // FM first, then the AM family by lower band edge: each family is one contiguous run.
+      uint8_t at = batchCount_;
+      while (at > 0 && batchOrderKey(batchBands_[at - 1]) > batchOrderKey(i)) {
+        batchBands_[at] = batchBands_[at - 1];
+        --at;
+      }
+      batchBands_[at] = i;
+      ++batchCount_;
+    }
+    if (batchCount_ == 0) return false;
+
+    uint16_t bandPoints[app::kBandCount] = {};
+    batchTotalPoints_ = 0;
+    for (uint8_t i = 0; i < batchCount_; ++i) {
+      if (!buildSegments(state, batchBands_[i], batchModulation(batchBands_[i]))) continue;
+      for (uint8_t seg = 0; seg < segmentCount_; ++seg) bandPoints[i] += countPointsInSegment(segments_[seg]);
+      batchTotalPoints_ += bandPoints[i];
+    }
+    batchRestore_ = state.radio;
+    batchMask_ = bandMask;
+    batchRegion_ = state.global.fmRegion;
+    batchSpeed_ = state.global.scanSpeed;
+    batchPos_ = 0;
+    batchPointsDone_ = 0;
+    batchBandRunning_ = false;
+    batchCancelled_ = false;
+    batchFamilyHeld_ = false;
+    batchCheckpointed_ = false;
+    batchStartMs_ = millis();
+    // The index is this batch's alone; a resumed batch rebuilds its finished bands from the flash cache.
+    index_.entries.clear();
+    index_.cursor = -1;
+    index_.bandMask = 0;
+    for (uint8_t i = 0; i < batchCount_; ++i) index_.bandMask |= app::bandMaskBit(batchBands_[i]);
+    if (resume) {
+      resumeBatchFromCheckpoint(state, bandPoints);
+    } else {
+      app::EtmCheckpoint checkpoint{};
+      if (services::etmcache::loadCheckpoint(checkpoint, nullptr, nullptr) && checkpoint.batchMask != 0)
+        services::etmcache::clearCheckpoint();
+    }
+    batchActive_ = true;
+    Serial.printf("[etm] batch: %u bands, %u points\n",
+                  static_cast<unsigned>(batchCount_),
+                  static_cast<unsigned>(batchTotalPoints_));
     return true;
   }
 
   bool tick(app::AppState& state) {
-    if (phase_ == app::EtmPhase::Idle) return false;
+    if (phase_ == app::EtmPhase::Idle) return batchActive_ ? tickBatch(state) : false;
     const uint32_t now = millis();
     if (now < nextActionMs_) return true;
+    if (phase_ != app::EtmPhase::Cancelling) resumablePhase_ = isResumablePhase(phase_) ? phase_ : app::EtmPhase::Idle;
+    if (checkpointDue(now)) saveCheckpoint(phase_, now);
     switch (phase_) {
       case app::EtmPhase::CoarseScan:
         return tickCoarse(state, now);
+      case app::EtmPhase::SeekScan:
+        return tickSeek(state, now);
       case app::EtmPhase::FineScan:
         return tickFine(state, now);
       case app::EtmPhase::VerifyScan:
         return tickVerify(state, now);
+      case app::EtmPhase::RecheckScan:
+        return tickRecheck(state, now);
       case app::EtmPhase::Finalize:
         return tickFinalize(state);
+      case app::EtmPhase::IdentifyScan:
+        return tickIdentify(state, now);
       case app::EtmPhase::Cancelling:
         return tickCancelling(state);
       default:
@@ -197,106 +257,352 @@ class EtmScanner {
   }
 
   void requestCancel() {
+    if (batchActive_) batchCancelled_ = true;
     if (phase_ != app::EtmPhase::Idle) phase_ = app::EtmPhase::Cancelling;
   }
 
-  bool busy() const { return phase_ != app::EtmPhase::Idle; }
+  bool busy() const { return phase_ != app::EtmPhase::Idle || batchActive_; }
+
+  bool identifying() const { return phase_ == app::EtmPhase::IdentifyScan; }
+
+  // True when resumeScan(state) would continue a checkpointed scan.
+  bool hasCheckpoint(const app::AppState& state) const {
+    app::EtmCheckpoint checkpoint{};
+    return !busy() && services::etmcache::loadCheckpoint(checkpoint, nullptr, nullptr) &&
+           checkpointMatches(checkpoint, state.radio.bandIndex, state.radio.modulation, state.global.fmRegion,
+                             state.global.scanSpeed);
+  }
+
+  // True when requestBatchScan(state, bandMask, true) would continue a cancelled batch.
+  bool hasBatchCheckpoint(const app::AppState& state, uint32_t bandMask) const {
+    app::EtmCheckpoint checkpoint{};
+    return !busy() && bandMask != 0 && services::etmcache::loadCheckpoint(checkpoint, nullptr, nullptr) &&
+           checkpoint.batchMask == bandMask && checkpoint.region == state.global.fmRegion &&
+           checkpoint.scanSpeed == state.global.scanSpeed;
+  }
+
+  void setAdaptiveSettle(bool enabled) { adaptiveSettle_ = enabled; }
+
+  void setBackgroundRefresh(bool enabled) { refreshEnabled_ = enabled; }
+
+  // Background refresh: at most one station probe per slot, scheduled from the main loop while idle. A slot
+  // starts the probe (radio::startProbe) and a later call collects it once the settle time has passed, so the
+  // loop never waits on the tuner. Returns true when memory_ changed (a station aged out) and state was
+  // republished.
+  bool tickBackgroundRefresh(app::AppState& state) {
+    if (refreshProbeKhz_ != 0) return collectRefreshProbe(state);
+    if (!refreshEnabled_ || busy() || memory_.stations.empty() || app::isSsb(state.radio.modulation) ||
+        memory_.bandIndex != state.radio.bandIndex || memory_.modulation != state.radio.modulation) {
+      return false;
+    }
+    const uint32_t now = millis();
+    if (!services::aie::shouldActivateAIE(state) || state.radio.frequencyKhz != refreshListenKhz_) {
+      refreshListenKhz_ = state.radio.frequencyKhz;
+      refreshIdleSinceMs_ = now;
+      return false;
+    }
+    if (now - refreshIdleSinceMs_ < app::kEtmRefreshIdleMs || services::aie::isEnvelopeActive()) return false;
+
+    // Only a closed squelch means nobody is listening: a user mute still leaves RDS on screen, so it gets the
+    // audible cadence, and no slot is taken while that RDS is still being acquired.
+    const bool silent = services::radio::squelchClosed();
+    const uint32_t interval = silent ? app::kEtmRefreshSilentIntervalMs : app::kEtmRefreshIntervalMs;
+    if (now - refreshLastSliceMs_ < interval) return false;
+    if (!silent && services::rds::acquiring(state)) return false;
+    refreshLastSliceMs_ = now;
+
+    const app::EtmSensitivity& sens = *coarseSensitivity(state);
+    const app::BandDef& band = app::kBandPlan[state.radio.bandIndex];
+    const app::EtmBandProfile* prof = profileForBand(state,
+                                                     band,
+                                                     app::bandMinKhzFor(band, state.global.fmRegion),
+                                                     app::bandMaxKhzFor(band, state.global.fmRegion));
+    uint8_t rssi = 0, snr = 0;
+
+    // The listening channel needs no retune: refresh it from the (cached) RSQ on every slot.
+    const int16_t listening = app::findStationNear(memory_, state.radio.frequencyKhz, mergeDistanceKhz_);
+    const bool listeningRead = services::radio::readSignalQuality(&rssi, &snr);
+    if (listeningRead) recordScope(state.radio.frequencyKhz, prof->coarseStepKhz, rssi, snr);
+    if (listening >= 0 && listeningRead && rssi >= sens.rssiMin && snr >= sens.snrMin) {
+      app::EtmStation& s = memory_.stations[listening];
+      s.rssi = rssi;
+      s.snr = snr;
+      s.lastSeenMs = now;
+      s.misses = 0;
+      memoryDirty_ = true;
+    }
+
+    int16_t stalest = -1;
+    for (uint16_t i = 0; i < memory_.stations.size(); ++i) {
+      if (static_cast<int16_t>(i) == listening) continue;
+      const uint32_t refreshedMs = lastRefreshMs(memory_.stations[i]);
+      if (now - refreshedMs < app::kEtmRefreshMinAgeMs) continue;
+      if (stalest < 0 || now - refreshedMs > now - lastRefreshMs(memory_.stations[stalest]))
+        stalest = static_cast<int16_t>(i);
+    }
+    // Nothing due: a silent slot walks the bandscope instead, an audible one is not worth a slice.
+    refreshProbeStepKhz_ = prof->coarseStepKhz;
+    refreshProbeStation_ = stalest >= 0;
+    refreshProbeSlice_ = false;
+    if (stalest < 0) {
+      const uint16_t sweepKhz = silent ? nextSweepKhz(prof->coarseStepKhz, state.radio.frequencyKhz) : 0;
+      if (sweepKhz != 0 && services::radio::startProbe(sweepKhz, prof->coarseSettleMs)) refreshProbeKhz_ = sweepKhz;
+      return false;
+    }
+
+    refreshProbeSlice_ = !silent && services::aie::beginMuteSlice();
+    if (!silent && !refreshProbeSlice_) return false;
+    const uint16_t probeKhz = memory_.stations[stalest].frequencyKhz;
+    if (services::radio::startProbe(probeKhz, prof->coarseSettleMs)) {
+      refreshProbeKhz_ = probeKhz;
+    } else if (refreshProbeSlice_) {
+      services::aie::endMuteSlice();
+    }
+    return false;
+  }
+
+  // A station is due for a refresh by the later of its last hit and its last probe: a miss does not make it
+  // "seen", but it should not be probed again straight away either.
+  static uint32_t lastRefreshMs(const app::EtmStation& s) {
+    return static_cast<int32_t>(s.lastProbeMs - s.lastSeenMs) > 0 ? s.lastProbeMs : s.lastSeenMs;
+  }
+
+  // Second half of a refresh slot: books the probe's reading once radio::pollProbe() has it.
+  bool collectRefreshProbe(app::AppState& state) {
+    bool measured = false;
+    uint8_t rssi = 0, snr = 0;
+    if (!services::radio::pollProbe(&measured, &rssi, &snr)) return false;
+    const uint16_t probeKhz = refreshProbeKhz_;
+    refreshProbeKhz_ = 0;
+    if (refreshProbeSlice_) services::aie::endMuteSlice();
+    if (!measured) return false;
+
+    recordScope(probeKhz, refreshProbeStepKhz_, rssi, snr);
+    // The list may have changed while the tuner was away: book the reading by frequency.
+    const int16_t index = refreshProbeStation_ ? app::findStationNear(memory_, probeKhz, 0) : -1;
+    if (index < 0) return false;
+    const app::EtmSensitivity& sens = *coarseSensitivity(state);
+    app::EtmStation& s = memory_.stations[index];
+    s.lastProbeMs = millis();
+    memoryDirty_ = true;
+    if (rssi >= sens.rssiMin && snr >= sens.snrMin) {
+      s.rssi = rssi;
+      s.snr = snr;
+      s.lastSeenMs = s.lastProbeMs;
+      s.misses = 0;
+      return false;
+    }
+    if (++s.misses < app::kEtmRefreshMaxMisses) return false;
+
+    Serial.printf("[etm] refresh: %u aged out after %u misses\n",
+                  static_cast<unsigned>(s.frequencyKhz),
+                  static_cast<unsigned>(s.misses));
+    removeStationAt(static_cast<uint16_t>(index));
+    publishState(state);
+    return true;
+  }
+
+  // A scan takes the tuner: a refresh probe still away is called back and its slice closed.
+  void dropRefreshProbe() {
+    if (refreshProbeKhz_ == 0) return;
+    services::radio::cancelProbe();
+    refreshProbeKhz_ = 0;
+    if (refreshProbeSlice_) services::aie::endMuteSlice();
+  }
 
   void syncContext(const app::AppState& state) {
-    if (memory_.bandIndex != state.radio.bandIndex ||
-        memory_.modulation != state.radio.modulation) {
-      memory_.count = 0;
-      memory_.cursor = -1;
-      memory_.bandIndex = state.radio.bandIndex;
-      memory_.modulation = state.radio.modulation;
+    if (!memoryLoaded_ || memory_.bandIndex != state.radio.bandIndex ||
+        memory_.modulation != state.radio.modulation || memoryRegion_ != state.global.fmRegion) {
+      // Write back what changed since the last store, then swap in the cached list for the new context.
+      if (memoryLoaded_ && memoryDirty_) services::etmcache::store(memory_, memoryRegion_);
+      services::etmcache::load(state.radio.bandIndex, state.radio.modulation, state.global.fmRegion, memory_);
+      memoryRegion_ = state.global.fmRegion;
+      memoryLoaded_ = true;
+      memoryDirty_ = false;
     }
     const app::BandDef& band = app::kBandPlan[state.radio.bandIndex];
     const uint16_t bandMinKhz = app::bandMinKhzFor(band, state.global.fmRegion);
     const uint16_t bandMaxKhz = app::bandMaxKhzFor(band, state.global.fmRegion);
     const app::EtmBandProfile* prof = profileForBand(state, band, bandMinKhz, bandMaxKhz);
     mergeDistanceKhz_ = prof != nullptr ? prof->mergeDistanceKhz : app::kEtmProfileFm.mergeDistanceKhz;
+
+    scopeBand_ = state.radio.bandIndex;
+    scopeMinKhz_ = bandMinKhz;
+    scopeMaxKhz_ = bandMaxKhz;
+    uint16_t rasterMinKhz = bandMinKhz, rasterMaxKhz = bandMaxKhz;
+    scopeSweepStartKhz_ =
+        band.id == app::BandId::MW && alignMwSegmentToRaster(rasterMinKhz, rasterMaxKhz, state) ? rasterMinKhz : bandMinKhz;
+  }
+
+  // Bandscope of the synced band, or nullptr until something was measured for its current limits.
+  const app::EtmBandscope* bandscope() const {
+    const app::EtmBandscope& scope = scopes_[scopeBand_ % app::kBandCount];
+    if (scope.measuredColumns == 0 || scope.minKhz != scopeMinKhz_ || scope.maxKhz != scopeMaxKhz_) return nullptr;
+    return &scope;
   }
 
   void publishState(app::AppState& state) {
-    state.seekScan.foundCount = memory_.count;
+    state.seekScan.foundCount = memory_.stations.size();
     state.seekScan.foundIndex = memory_.cursor;
     state.seekScan.totalPoints = totalPoints_;
+    state.seekScan.scanDurationMs = busy() ? static_cast<uint32_t>(millis() - scanStartMs_) : scanDurationMs_;
     state.seekScan.fineScanActive = (phase_ == app::EtmPhase::FineScan || phase_ == app::EtmPhase::VerifyScan);
-    state.seekScan.cursorScanPass =
-        (memory_.cursor >= 0 && static_cast<uint8_t>(memory_.cursor) < memory_.count)
-            ? memory_.stations[memory_.cursor].scanPass
-            : 0;
+    const app::EtmStation* cursor =
+        (memory_.cursor >= 0 && static_cast<uint16_t>(memory_.cursor) < memory_.stations.size())
+            ? &memory_.stations[memory_.cursor]
+            : nullptr;
+    state.seekScan.cursorScanPass = cursor != nullptr ? cursor->scanPass : 0;
+    state.seekScan.cursorRdsPi = cursor != nullptr ? cursor->rdsPi : 0;
+    app::copyText(state.seekScan.cursorRdsPs, cursor != nullptr ? cursor->rdsPs : "");
+    state.seekScan.indexCount = index_.entries.size();
+    if (!batchActive_) {
+      state.seekScan.batchBand = 0;
+      state.seekScan.batchBandCount = 0;
+      state.seekScan.batchEtaMs = 0;
+      return;
+    }
+    const uint32_t done = batchPointsDone_ + (batchBandRunning_ ? pointsVisited_ : 0);
+    const uint32_t elapsedMs = millis() - batchStartMs_;
+    state.seekScan.batchBand = static_cast<uint8_t>(batchPos_ < batchCount_ ? batchPos_ + 1 : batchCount_);
+    state.seekScan.batchBandCount = batchCount_;
+    state.seekScan.batchPointsVisited = static_cast<uint16_t>(done < batchTotalPoints_ ? done : batchTotalPoints_);
+    state.seekScan.batchTotalPoints = batchTotalPoints_;
+    // Linear in points: verify passes and seek-skipped stretches make it an estimate, refined as bands finish.
+    state.seekScan.batchEtaMs =
+        done > 0 && done < batchTotalPoints_ ? static_cast<uint32_t>(static_cast<uint64_t>(elapsedMs) * (batchTotalPoints_ - done) / done) : 0;
   }
 
   void addSeekResult(uint16_t frequencyKhz, uint8_t rssi, uint8_t snr) {
-    const uint16_t mergeKhz = mergeDistanceKhz_;
-    for (uint8_t i = 0; i < memory_.count; ++i) {
-      if (absDeltaKhz(memory_.stations[i].frequencyKhz, frequencyKhz) <= mergeKhz) {
-        memory_.stations[i].rssi = rssi;
-        memory_.stations[i].snr = snr;
-        memory_.stations[i].lastSeenMs = millis();
-        return;
-      }
+    const int16_t found = app::findStationNear(memory_, frequencyKhz, mergeDistanceKhz_);
+    if (found >= 0) {
+      app::EtmStation& s = memory_.stations[found];
+      s.rssi = rssi;
+      s.snr = snr;
+      s.lastSeenMs = millis();
+      s.misses = 0;
+      memoryDirty_ = true;
+      return;
     }
     addStationToMemory(frequencyKhz, rssi, snr, app::kScanPassSeek);
+    memoryDirty_ = true;
   }
 
   void navigateNext(app::AppState& state) {
-    if (memory_.count == 0) {
+    if (indexCovers(state)) {
+      navigateIndex(state, 1);
+      return;
+    }
+    if (memory_.stations.empty()) {
       publishState(state);
       return;
     }
     if (memory_.cursor < 0)
       memory_.cursor = 0;
     else
-      memory_.cursor = (memory_.cursor + 1) % memory_.count;
+      memory_.cursor = static_cast<int16_t>((memory_.cursor + 1) % memory_.stations.size());
     tuneToCursor(state);
     publishState(state);
   }
 
   void navigatePrev(app::AppState& state) {
-    if (memory_.count == 0) {
+    if (indexCovers(state)) {
+      navigateIndex(state, -1);
+      return;
+    }
+    if (memory_.stations.empty()) {
       publishState(state);
       return;
     }
     if (memory_.cursor < 0)
-      memory_.cursor = static_cast<int16_t>(memory_.count - 1);
+      memory_.cursor = static_cast<int16_t>(memory_.stations.size() - 1);
     else
-      memory_.cursor = (memory_.cursor - 1 + memory_.count) % memory_.count;
+      memory_.cursor = static_cast<int16_t>((memory_.cursor - 1 + memory_.stations.size()) % memory_.stations.size());
     tuneToCursor(state);
     publishState(state);
   }
 
   void navigateNearest(app::AppState& state) {
-    if (memory_.count == 0) {
+    if (memory_.stations.empty()) {
       memory_.cursor = -1;
       publishState(state);
       return;
     }
-    const uint16_t freq = state.radio.frequencyKhz;
-    uint8_t lo = 0;
-    uint8_t hi = memory_.count;
-    while (lo + 1 < hi) {
-      uint8_t mid = (lo + hi) / 2;
-      if (memory_.stations[mid].frequencyKhz <= freq)
-        lo = mid;
-      else
-        hi = mid;
-    }
-    uint16_t deltaLo = absDeltaKhz(memory_.stations[lo].frequencyKhz, freq);
-    uint8_t best = lo;
-    if (hi < memory_.count) {
-      uint16_t deltaHi = absDeltaKhz(memory_.stations[hi].frequencyKhz, freq);
-      if (deltaHi < deltaLo) best = hi;
-    }
-    memory_.cursor = static_cast<int16_t>(best);
+    memory_.cursor = app::findStationNear(memory_, state.radio.frequencyKhz, 0xFFFF);
     tuneToCursor(state);
     publishState(state);
   }
 
+  uint16_t knownStationFrom(const app::AppState& state, int8_t direction, uint32_t maxAgeMs) const {
+    if (busy() || !memoryLoaded_ || memory_.bandIndex != state.radio.bandIndex ||
+        memory_.modulation != state.radio.modulation || memoryRegion_ != state.global.fmRegion) {
+      return 0;
+    }
+    const uint16_t fromKhz = state.radio.frequencyKhz;
+    uint16_t at = app::stationLowerBound(memory_, direction > 0 ? static_cast<uint16_t>(fromKhz + 1) : fromKhz);
+    if (direction < 0) {
+      if (at == 0) return 0;
+      --at;
+    } else if (at >= memory_.stations.size()) {
+      return 0;
+    }
+    const app::EtmStation& s = memory_.stations[at];
+    if (s.lastSeenMs == 0 || millis() - s.lastSeenMs > maxAgeMs) return 0;
+    return s.frequencyKhz;
+  }
+
   const app::EtmMemory& memory() const { return memory_; }
 
+  const app::EtmGlobalIndex* stationIndex() const { return index_.entries.empty() ? nullptr : &index_; }
+
  private:
+  // Segments of one band (broadcast sub-bands on SW/ALL, raster-aligned MW), profiles included.
+  // state only supplies the region.
+  bool buildSegments(const app::AppState& state, uint8_t bandIndex, app::Modulation modulation) {
+    segmentCount_ = 0;
+    const app::BandDef& band = app::kBandPlan[bandIndex];
+    const uint16_t bandMinKhz = app::bandMinKhzFor(band, state.global.fmRegion);
+    const uint16_t bandMaxKhz = app::bandMaxKhzFor(band, state.global.fmRegion);
+
+    if (modulation == app::Modulation::FM) {
+      if (!addSegment(state, bandMinKhz, bandMaxKhz, band)) return false;
+    } else {
+      if (band.id == app::BandId::All) {
+        for (size_t i = 0; i < app::kBroadcastRedLineAllCount; ++i) {
+          const app::SubBandDef& sub = app::kBroadcastRedLineAll[i];
+          uint16_t minKhz = sub.minKhz > bandMinKhz ? sub.minKhz : bandMinKhz;
+          uint16_t maxKhz = sub.maxKhz < bandMaxKhz ? sub.maxKhz : bandMaxKhz;
+          if (minKhz > maxKhz) continue;
+          const bool isMw = sub.minKhz >= 500 && sub.maxKhz <= 1705;
+          if (isMw && !alignMwSegmentToRaster(minKhz, maxKhz, state)) continue;
+          const app::EtmBandProfile* prof = profileForBand(state, band, minKhz, maxKhz);
+          if (!addSegmentWithProfile(state, minKhz, maxKhz, prof)) return false;
+        }
+      } else if (isBroadcastSwBand(band.id)) {
+        bool added = false;
+        for (size_t i = 0; i < app::kBroadcastRedLineSwCount; ++i) {
+          const app::SubBandDef& sub = app::kBroadcastRedLineSw[i];
+          uint16_t minKhz = sub.minKhz > bandMinKhz ? sub.minKhz : bandMinKhz;
+          uint16_t maxKhz = sub.maxKhz < bandMaxKhz ? sub.maxKhz : bandMaxKhz;
+          if (minKhz <= maxKhz && addSegment(state, minKhz, maxKhz, band)) added = true;
+        }
+        if (!added) addSegment(state, bandMinKhz, bandMaxKhz, band);
+      } else if (band.id == app::BandId::MW) {
+        uint16_t minKhz = bandMinKhz, maxKhz = bandMaxKhz;
+        if (alignMwSegmentToRaster(minKhz, maxKhz, state))
+          addSegment(state, minKhz, maxKhz, band);
+        else
+          addSegment(state, bandMinKhz, bandMaxKhz, band);
+      } else {
+        addSegment(state, bandMinKhz, bandMaxKhz, band);
+      }
+    }
+
+    if (segmentCount_ == 0) {
+      addSegment(state, bandMinKhz, bandMaxKhz, band);
+    }
+    return segmentCount_ > 0;
+  }
+
   bool addSegment(const app::AppState& state,
                   uint16_t minKhz,
                   uint16_t maxKhz,
@@ -332,6 +638,7 @@ class EtmScanner {
       ++segmentIndex_;
       if (segmentIndex_ >= segmentCount_) return false;
       currentKhz_ = segments_[segmentIndex_].minKhz;
+      floorRssi_ = 0xFF;
       return true;
     }
     currentKhz_ += seg.coarseStepKhz;
@@ -340,37 +647,191 @@ class EtmScanner {
     return true;
   }
 
-  void addCandidate(uint16_t freqKhz, uint8_t rssi, uint8_t snr, uint8_t pass, uint8_t segIdx) {
-    if (candidateCount_ < app::kEtmMaxCandidates) {
-      app::EtmCandidate& c = candidates_[candidateCount_++];
-      c.frequencyKhz = freqKhz;
-      c.rssi = rssi;
-      c.snr = snr;
-      c.freqOff = 0;
-      c.pilotPresent = false;
-      c.multipath = 0;
-      c.scanPass = pass;
-      c.segmentIndex = segIdx;
-      return;
+  // Sorted position for a candidate at freqKhz, after any at the same frequency.
+  uint16_t candidateUpperBound(uint16_t freqKhz) const {
+    uint16_t lo = 0;
+    uint16_t hi = candidates_.size();
+    while (lo < hi) {
+      const uint16_t mid = static_cast<uint16_t>(lo + (hi - lo) / 2);
+      if (candidates_[mid].frequencyKhz <= freqKhz) {
+        lo = static_cast<uint16_t>(mid + 1);
+      } else {
+        hi = mid;
+      }
     }
-    // Evict: scanPass 0 first, then 1; never evict 2. Then weakest RSSI.
+    return lo;
+  }
+
+  // Candidates stay sorted by frequency, so fine windows and FM clustering need no sort pass.
+  void addCandidate(uint16_t freqKhz, uint8_t rssi, uint8_t snr, uint8_t pass, uint8_t segIdx) {
+    const app::EtmCandidate c = {freqKhz, rssi, snr, 0, false, 0, pass, segIdx, app::EtmPeakFit::Ambiguous};
+    if (candidates_.insert(candidateUpperBound(freqKhz), c)) return;
+    // Full: evict scanPass 0 first, then 1; never evict 2. Then weakest RSSI.
     int16_t evict = -1;
-    for (uint8_t i = 0; i < candidateCount_; ++i) {
+    for (uint16_t i = 0; i < candidates_.size(); ++i) {
       if (candidates_[i].scanPass == 2) continue;
       if (evict < 0 || candidates_[i].scanPass < candidates_[evict].scanPass ||
           (candidates_[i].scanPass == candidates_[evict].scanPass && candidates_[i].rssi < candidates_[evict].rssi))
         evict = static_cast<int16_t>(i);
     }
     if (evict >= 0 && (pass > candidates_[evict].scanPass || (pass == candidates_[evict].scanPass && rssi > candidates_[evict].rssi))) {
-      candidates_[evict].frequencyKhz = freqKhz;
-      candidates_[evict].rssi = rssi;
-      candidates_[evict].snr = snr;
-      candidates_[evict].freqOff = 0;
-      candidates_[evict].pilotPresent = false;
-      candidates_[evict].multipath = 0;
-      candidates_[evict].scanPass = pass;
-      candidates_[evict].segmentIndex = segIdx;
+      candidates_[evict] = c;
+      repositionCandidate(static_cast<uint16_t>(evict));
+    }
+  }
+
+  // Coarse readings in frequency order, one per (frequency, segment), for the peak fit. early marks a reading
+  // taken before the profile's fixed coarse settle (adaptive settle exit).
+  void recordCoarseSample(uint16_t freqKhz, uint8_t rssi, uint8_t segIdx, bool early = false) {
+    uint16_t at = coarseSampleLowerBound(freqKhz);
+    while (at < coarseSamples_.size() && coarseSamples_[at].frequencyKhz == freqKhz) {
+      if (coarseSamples_[at].segmentIndex == segIdx) {
+        coarseSamples_[at].rssi = rssi;
+        coarseSamples_[at].early = early;
+        return;
+      }
+      ++at;
+    }
+    coarseSamples_.insert(at, {freqKhz, rssi, segIdx, early});
+  }
+
+  uint16_t coarseSampleLowerBound(uint16_t freqKhz) const {
+    uint16_t lo = 0;
+    uint16_t hi = coarseSamples_.size();
+    while (lo < hi) {
+      const uint16_t mid = static_cast<uint16_t>(lo + (hi - lo) / 2);
+      if (coarseSamples_[mid].frequencyKhz < freqKhz) {
+        lo = static_cast<uint16_t>(mid + 1);
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  const app::EtmCoarseSample* coarseSampleAt(uint16_t freqKhz, uint8_t segIdx) const {
+    for (uint16_t at = coarseSampleLowerBound(freqKhz);
+         at < coarseSamples_.size() && coarseSamples_[at].frequencyKhz == freqKhz;
+         ++at) {
+      if (coarseSamples_[at].segmentIndex == segIdx) return &coarseSamples_[at];
+    }
+    return nullptr;
+  }
+
+  const app::EtmCandidate* candidateAt(uint16_t freqKhz, uint8_t segIdx) const {
+    for (uint16_t at = candidateUpperBound(freqKhz); at > 0 && candidates_[at - 1].frequencyKhz == freqKhz; --at) {
+      if (candidates_[at - 1].segmentIndex == segIdx) return &candidates_[at - 1];
+    }
+    return nullptr;
+  }
+
+  app::EtmPeakFit fitCandidate(const app::EtmCandidate& c, int16_t* offsetMilliSteps) const {
+    const uint16_t step = segments_[c.segmentIndex].coarseStepKhz;
+    const app::EtmCoarseSample* left =
+        c.frequencyKhz > step ? coarseSampleAt(static_cast<uint16_t>(c.frequencyKhz - step), c.segmentIndex) : nullptr;
+    const app::EtmCoarseSample* right = coarseSampleAt(static_cast<uint16_t>(c.frequencyKhz + step), c.segmentIndex);
+    *offsetMilliSteps = 0;
+    if (left == nullptr || right == nullptr) return app::EtmPeakFit::Ambiguous;
+    return app::fitPeak(left->rssi, c.rssi, right->rssi, offsetMilliSteps);
+  }
+
+  // Parabolic peak fit of every candidate against its raster neighbours (etm_scan.h), then skirt removal.
+  // Thorough keeps skirts as Ambiguous for its follow-up pass. Otherwise a skirt fitted on an early adaptive
+  // reading stays as a Shoulder for RecheckScan (a carrier read mid-ramp can look like a neighbour's skirt);
+  // the rest are dropped. Returns true when Shoulders are left. Isolated SW Peaks move to the fitted kHz, which never reorders candidates (the shift stays under half a
+  // step); FM and MW/LW Peaks, and Peaks with a candidate next door, keep their raster point.
+  bool fitCandidatePeaks(bool keepShoulders) {
+    int16_t offset = 0;
+    for (uint16_t i = 0; i < candidates_.size(); ++i)
+      candidates_[i].peakFit = fitCandidate(candidates_[i], &offset);
+
+    shouldersDropped_ = 0;
+    shouldersRechecked_ = 0;
+    for (uint16_t i = candidates_.size(); i > 0; --i) {
+      app::EtmCandidate& c = candidates_[i - 1];
+      if (c.peakFit == app::EtmPeakFit::Peak) continue;
+      if (keepShoulders || !isPeakSkirt(c)) {
+        c.peakFit = app::EtmPeakFit::Ambiguous;
+      } else if (skirtReadEarly(c)) {
+        c.peakFit = app::EtmPeakFit::Shoulder;
+        ++shouldersRechecked_;
+      } else {
+        candidates_.erase(static_cast<uint16_t>(i - 1));
+        ++shouldersDropped_;
+      }
+    }
+
+    peakFits_ = 0;
+    for (uint16_t i = 0; i < candidates_.size(); ++i) {
+      app::EtmCandidate& c = candidates_[i];
+      if (c.peakFit != app::EtmPeakFit::Peak) continue;
+      ++peakFits_;
+      const uint16_t step = segments_[c.segmentIndex].coarseStepKhz;
+      if (modulation_ == app::Modulation::FM || step > app::kEtmPeakFitShiftMaxStepKhz) continue;
+      if (candidateAt(static_cast<uint16_t>(c.frequencyKhz - step), c.segmentIndex) != nullptr ||
+          candidateAt(static_cast<uint16_t>(c.frequencyKhz + step), c.segmentIndex) != nullptr)
+        continue;
+      fitCandidate(c, &offset);
+      const int32_t shiftKhz = (static_cast<int32_t>(offset) * step + (offset >= 0 ? 500 : -500)) / 1000;
+      c.frequencyKhz = static_cast<uint16_t>(c.frequencyKhz + shiftKhz);
+    }
+    return shouldersRechecked_ > 0;
+  }
+
+  // After RecheckScan: Shoulders that still read as a Peak's skirt at full settle go, the rest stay Ambiguous.
+  void dropRecheckedShoulders() {
+    for (uint16_t i = candidates_.size(); i > 0; --i) {
+      app::EtmCandidate& c = candidates_[i - 1];
+      if (c.peakFit != app::EtmPeakFit::Shoulder) continue;
+      if (isPeakSkirt(c)) {
+        candidates_.erase(static_cast<uint16_t>(i - 1));
+        ++shouldersDropped_;
+      } else {
+        c.peakFit = app::EtmPeakFit::Ambiguous;
+      }
+    }
+  }
+
+  // c is a Peak's skirt when the Peak's fit leans towards it (one carrier between two raster points), when
+  // it falls away from a clearly stronger Peak (the near side of that carrier) or, between two stronger
+  // readings, when it is no stronger than the Peak's far side (skirts fall off about evenly).
+  bool isPeakSkirt(const app::EtmCandidate& c) const {
+    const uint16_t step = segments_[c.segmentIndex].coarseStepKhz;
+    for (int8_t side = -1; side <= 1; side += 2) {
+      const uint16_t peakKhz = static_cast<uint16_t>(c.frequencyKhz + side * step);
+      const app::EtmCandidate* peak = candidateAt(peakKhz, c.segmentIndex);
+      if (peak == nullptr || peak->peakFit != app::EtmPeakFit::Peak) continue;
+      int16_t lean = 0;
+      fitCandidate(*peak, &lean);
+      if (-side * lean >= app::kEtmPeakFitLeanMilliSteps) return true;
+      if (peak->rssi < c.rssi + app::kEtmPeakFitMinCurvatureDb) continue;
+      const app::EtmCoarseSample* away = coarseSampleAt(static_cast<uint16_t>(c.frequencyKhz - side * step), c.segmentIndex);
+      if (away != nullptr && away->rssi <= c.rssi) return true;
+      const app::EtmCoarseSample* far = coarseSampleAt(static_cast<uint16_t>(peakKhz + side * step), c.segmentIndex);
+      if (far != nullptr && c.rssi <= far->rssi + app::kEtmPeakFitSkirtDb) return true;
     }
+    return false;
+  }
+
+  // True when any reading isPeakSkirt() may consult for c (two raster points either side) exited settle early.
+  bool skirtReadEarly(const app::EtmCandidate& c) const {
+    const uint16_t step = segments_[c.segmentIndex].coarseStepKhz;
+    for (int8_t k = -2; k <= 2; ++k) {
+      const int32_t freqKhz = static_cast<int32_t>(c.frequencyKhz) + k * step;
+      if (freqKhz <= 0 || freqKhz > 0xFFFF) continue;
+      const app::EtmCoarseSample* sample = coarseSampleAt(static_cast<uint16_t>(freqKhz), c.segmentIndex);
+      if (sample != nullptr && sample->early) return true;
+    }
+    return false;
+  }
+
+  // Restores frequency order after candidates_[index] changed frequency.
+  void repositionCandidate(uint16_t index) {
+    const uint16_t freqKhz = candidates_[index].frequencyKhz;
+    uint16_t to = index;
+    while (to > 0 && candidates_[to - 1].frequencyKhz > freqKhz) --to;
+    while (to + 1 < candidates_.size() && candidates_[to + 1].frequencyKhz < freqKhz) ++to;
+    candidates_.move(index, to);
   }
 
   bool tickCoarse(app::AppState& state, uint32_t now) {
@@ -387,60 +848,299 @@ class EtmScanner {
       state.radio.ssbTuneOffsetHz = 0;
       services::radio::apply(state);
       awaitingMeasure_ = true;
-      nextActionMs_ = now + settleMs_;
+      tunedAtMs_ = now;
+      if (adaptiveSettle_) {
+        const app::EtmBandProfile& prof = *segmentProfiles_[segmentIndex_];
+        havePrevSample_ = false;
+        pointDeadlineMs_ = learnedSettleCapMs(prof);
+        nextActionMs_ = now + (prof.adaptiveFirstReadMs < pointDeadlineMs_ ? prof.adaptiveFirstReadMs : pointDeadlineMs_);
+      } else {
+        nextActionMs_ = now + settleMs_;
+      }
+      return true;
+    }
+
+    const app::EtmSensitivity* sens = coarseSensitivity(state);
+    uint8_t rssi = 0, snr = 0;
+    if (adaptiveSettle_) {
+      if (!readSettledSample(now, *sens, rssi, snr)) return true;
+    } else {
+      services::radio::readSignalQuality(&rssi, &snr);
+    }
+
+    const bool above = (rssi >= sens->rssiMin && snr >= sens->snrMin);
+    if (above)
+      addCandidate(currentKhz_, rssi, snr, app::kScanPassCoarse, segmentIndex_);
+    recordCoarseSample(currentKhz_, rssi, segmentIndex_,
+                       adaptiveSettle_ && now - tunedAtMs_ < segmentProfiles_[segmentIndex_]->coarseSettleMs);
+    recordScope(currentKhz_, segments_[segmentIndex_].coarseStepKhz, rssi, snr);
+
+    ++pointsVisited_;
+    awaitingMeasure_ = false;
+    nextActionMs_ = now;
+
+    if (seeksSegment(segmentIndex_)) {
+      quietPoints_ = above ? 0 : static_cast<uint8_t>(quietPoints_ + 1);
+      // Dense stretch is over: hand the rest of the segment back to native seek.
+      if (quietPoints_ >= app::kEtmHybridQuietPoints && currentKhz_ < segments_[segmentIndex_].maxKhz) {
+        adjacentStops_ = 0;
+        phase_ = app::EtmPhase::SeekScan;
+        return true;
+      }
+    }
+
+    const uint8_t prevSegment = segmentIndex_;
+    if (!advancePoint()) return finishCoarsePass(state, now);
+    if (segmentIndex_ != prevSegment && seeksSegment(segmentIndex_)) {
+      seekSegmentPrimed_ = false;
+      phase_ = app::EtmPhase::SeekScan;
+    }
+    return true;
+  }
+
+  // Hybrid seeks only the SW broadcast segments (SW profile on a broadcast SW band or on ALL): sparse enough
+  // for one seek to cover the gaps. Everywhere else, FM, LW, MW and the AM utility bands, the stations sit so
+  // close that seek stops nearly every raster point, costs more than stepping and skips weak neighbours, so
+  // those segments are stepped as in Fast.
+  bool seeksSegment(uint8_t segIdx) const {
+    return hybridSeeksSw_ && segIdx < segmentCount_ && segmentProfiles_[segIdx] == &app::kEtmProfileSw;
+  }
+
+  // Coarse coverage of all segments is complete: pick the follow-up pass for the scan speed.
+  bool finishCoarsePass(app::AppState& state, uint32_t now) {
+    nextActionMs_ = now;
+    const bool recheck = fitCandidatePeaks(state.global.scanSpeed == app::ScanSpeed::Thorough);
+    if (state.global.scanSpeed != app::ScanSpeed::Thorough) {
+      recheckIndex_ = 0;
+      phase_ = recheck ? app::EtmPhase::RecheckScan : app::EtmPhase::Finalize;
+      return true;
+    }
+    const app::EtmBandProfile* prof = segmentCount_ > 0 ? segmentProfiles_[0] : &app::kEtmProfileFm;
+    if (state.radio.modulation == app::Modulation::FM && prof->verifySettleMs > 0) {
+      verifyCandidateIndex_ = 0;
+      verifySettleMs_ = prof->verifySettleMs;
+      phase_ = app::EtmPhase::VerifyScan;
+      return true;
+    }
+    buildFineWindows();
+    phase_ = app::EtmPhase::FineScan;
+    fineWindowIndex_ = 0;
+    if (fineWindowCount_ == 0) {
+      phase_ = app::EtmPhase::Finalize;
+      return true;
+    }
+    startFineWindow(state, now);
+    return true;
+  }
+
+  // Hybrid pass: let the tuner seek to the next channel above its seek thresholds instead of
+  // stepping every raster point. startScanSeek() hands the span to the worker and each tick polls
+  // pollSeek() once until the tuner stops, so empty spectrum costs one seek instead of one tune +
+  // settle + RSQ read per point while the loop keeps running. Each stop is re-read and filtered
+  // with the scan sensitivity, since the tuner's seek thresholds are fixed.
+  bool tickSeek(app::AppState& state, uint32_t now) {
+    state.seekScan.active = true;
+    state.seekScan.seeking = false;
+    state.seekScan.scanning = true;
+    state.seekScan.pointsVisited = pointsVisited_;
+    state.seekScan.bestFrequencyKhz = state.radio.frequencyKhz;
+    state.seekScan.bestRssi = 0;
+    publishState(state);
+
+    const app::EtmSegment& seg = segments_[segmentIndex_];
+    const app::EtmSensitivity* sens = coarseSensitivity(state);
+    uint8_t rssi = 0, snr = 0;
+
+    // Seek never reports the channel it starts on, so the segment's first point is stepped.
+    if (!seekSegmentPrimed_) {
+      if (!awaitingMeasure_) {
+        currentKhz_ = seg.minKhz;
+        state.radio.frequencyKhz = currentKhz_;
+        state.radio.ssbTuneOffsetHz = 0;
+        services::radio::apply(state);
+        awaitingMeasure_ = true;
+        nextActionMs_ = now + segmentProfiles_[segmentIndex_]->coarseSettleMs;
+        return true;
+      }
+      services::radio::readSignalQualityFresh(&rssi, &snr);
+      if (rssi >= sens->rssiMin && snr >= sens->snrMin)
+        addCandidate(currentKhz_, rssi, snr, app::kScanPassCoarse, segmentIndex_);
+      recordCoarseSample(currentKhz_, rssi, segmentIndex_);
+      recordScope(currentKhz_, seg.coarseStepKhz, rssi, snr);
+      awaitingMeasure_ = false;
+      seekSegmentPrimed_ = true;
+      adjacentStops_ = 0;
+      pointsVisited_ = static_cast<uint16_t>(pointsBeforeSegment(segmentIndex_) + 1);
+      nextActionMs_ = now;
+      return true;
+    }
+
+    if (currentKhz_ >= seg.maxKhz) return nextSeekSegment(state, now);
+
+    // The tuner seeks on its own; each tick polls it once, so the loop keeps running across the span.
+    if (!seekInFlight_) {
+      state.radio.frequencyKhz = currentKhz_;
+      state.radio.ssbTuneOffsetHz = 0;
+      if (!services::radio::startScanSeek(state, 1, seg.minKhz, seg.maxKhz, static_cast<uint8_t>(seg.coarseStepKhz))) {
+        recordScopeSkipped(currentKhz_, seg.maxKhz, seg.coarseStepKhz, true);
+        return nextSeekSegment(state, now);
+      }
+      seekInFlight_ = true;
+      return true;
+    }
+    bool found = false;
+    uint16_t stopKhz = 0;
+    if (!services::radio::pollSeek(&found, &stopKhz)) return true;
+    seekInFlight_ = false;
+    const uint32_t after = millis();
+    if (services::radio::lastSeekAborted()) {
+      phase_ = app::EtmPhase::Cancelling;
+      nextActionMs_ = after;
       return true;
     }
+    state.radio.frequencyKhz = stopKhz;
+    if (!found || stopKhz <= currentKhz_) {
+      recordScopeSkipped(currentKhz_, seg.maxKhz, seg.coarseStepKhz, true);
+      return nextSeekSegment(state, after);
+    }
 
-    uint8_t rssi = 0, snr = 0;
-    services::radio::readSignalQuality(&rssi, &snr);
+    ++seekStops_;
+    recordScopeSkipped(currentKhz_, stopKhz, seg.coarseStepKhz, false);
+    pointsVisited_ = static_cast<uint16_t>(pointsBeforeSegment(segmentIndex_) + pointsCoveredInSegment(seg, stopKhz));
+    services::radio::readSignalQualityFresh(&rssi, &snr);
+    const bool above = (rssi >= sens->rssiMin && snr >= sens->snrMin);
+    if (above)
+      addCandidate(stopKhz, rssi, snr, app::kScanPassCoarse, segmentIndex_);
+    recordCoarseSample(stopKhz, rssi, segmentIndex_);
+    recordScope(stopKhz, seg.coarseStepKhz, rssi, snr);
+
+    adjacentStops_ = (above && stopKhz - currentKhz_ <= seg.coarseStepKhz) ? static_cast<uint8_t>(adjacentStops_ + 1) : 0;
+    currentKhz_ = stopKhz;
+    nextActionMs_ = after;
+
+    // Back-to-back stops: seek gains nothing here and can step over a weak channel next to a
+    // strong one, so step point by point until the stretch goes quiet again.
+    if (adjacentStops_ >= app::kEtmHybridDenseStops && currentKhz_ < seg.maxKhz) {
+      quietPoints_ = 0;
+      advancePoint();
+      phase_ = app::EtmPhase::CoarseScan;
+    }
+    return true;
+  }
+
+  bool nextSeekSegment(app::AppState& state, uint32_t now) {
+    ++segmentIndex_;
+    if (segmentIndex_ >= segmentCount_) {
+      pointsVisited_ = totalPoints_;
+      return finishCoarsePass(state, now);
+    }
+    currentKhz_ = segments_[segmentIndex_].minKhz;
+    floorRssi_ = 0xFF;
+    seekSegmentPrimed_ = false;
+    nextActionMs_ = now;
+    if (!seeksSegment(segmentIndex_)) phase_ = app::EtmPhase::CoarseScan;
+    return true;
+  }
+
+  uint16_t pointsBeforeSegment(uint8_t segIdx) const {
+    uint16_t points = 0;
+    for (uint8_t i = 0; i < segIdx && i < segmentCount_; ++i) points += countPointsInSegment(segments_[i]);
+    return points;
+  }
 
-    const app::EtmSensitivity* sens = nullptr;
+  // Coarse points from seg.minKhz up to and including freqKhz (progress only).
+  static uint16_t pointsCoveredInSegment(const app::EtmSegment& seg, uint16_t freqKhz) {
+    if (freqKhz <= seg.minKhz || seg.coarseStepKhz == 0) return 1;
+    return static_cast<uint16_t>((freqKhz - seg.minKhz + seg.coarseStepKhz - 1) / seg.coarseStepKhz + 1);
+  }
+
+  const app::EtmSensitivity* coarseSensitivity(const app::AppState& state) const {
     if (state.radio.modulation == app::Modulation::FM &&
         state.global.scanSpeed == app::ScanSpeed::Thorough &&
         segmentCount_ > 0 && segmentProfiles_[0]->verifySettleMs > 0) {
-      sens = &app::kEtmCoarseThresholdFm;  // permissive for FM Thorough coarse
-    } else {
-      const uint8_t sensIdx = static_cast<uint8_t>(state.global.scanSensitivity) % 2;
-      sens = (state.radio.modulation == app::Modulation::FM)
-                 ? &app::kEtmSensitivityFm[sensIdx]
-                 : &app::kEtmSensitivityAm[sensIdx];
+      return &app::kEtmCoarseThresholdFm;  // permissive for FM Thorough coarse
     }
-    const bool above = (rssi >= sens->rssiMin && snr >= sens->snrMin);
-    if (above)
-      addCandidate(currentKhz_, rssi, snr, app::kScanPassCoarse, segmentIndex_);
+    const uint8_t sensIdx = static_cast<uint8_t>(state.global.scanSensitivity) % 2;
+    return (state.radio.modulation == app::Modulation::FM)
+               ? &app::kEtmSensitivityFm[sensIdx]
+               : &app::kEtmSensitivityAm[sensIdx];
+  }
 
-    ++pointsVisited_;
+  // Adaptive coarse settle: returns true once rssi/snr hold a reading to decide on,
+  // otherwise schedules the next poll via nextActionMs_.
+  bool readSettledSample(uint32_t now, const app::EtmSensitivity& sens, uint8_t& rssi, uint8_t& snr) {
+    const app::EtmBandProfile& prof = *segmentProfiles_[segmentIndex_];
+    services::radio::readSignalQualityFresh(&rssi, &snr);
+    const uint32_t elapsed = now - tunedAtMs_;
+    const bool above = (rssi >= sens.rssiMin && snr >= sens.snrMin);
+
+    if (elapsed >= pointDeadlineMs_) {
+      if (above) recordSettleSample(elapsed);
+      // Only fully settled readings define the floor, so a ramping carrier never lowers it.
+      if (rssi < floorRssi_) floorRssi_ = rssi;
+      return true;
+    }
 
-    if (!advancePoint()) {
-      if (state.global.scanSpeed == app::ScanSpeed::Fast) {
-        phase_ = app::EtmPhase::Finalize;
-        nextActionMs_ = now;
-        return true;
-      }
-      const app::EtmBandProfile* prof = segmentCount_ > 0 ? segmentProfiles_[0] : &app::kEtmProfileFm;
-      if (state.radio.modulation == app::Modulation::FM && prof->verifySettleMs > 0) {
-        verifyCandidateIndex_ = 0;
-        verifySettleMs_ = prof->verifySettleMs;
-        phase_ = app::EtmPhase::VerifyScan;
-        nextActionMs_ = now;
+    const bool stable = havePrevSample_ &&
+                        absDelta8(rssi, prevRssi_) <= app::kEtmSettleRssiToleranceDb &&
+                        absDelta8(snr, prevSnr_) <= app::kEtmSettleSnrToleranceDb;
+    prevRssi_ = rssi;
+    prevSnr_ = snr;
+    havePrevSample_ = true;
+
+    if (stable) {
+      if (above) {
+        recordSettleSample(elapsed);
         return true;
       }
-      buildFineWindows();
-      phase_ = app::EtmPhase::FineScan;
-      fineWindowIndex_ = 0;
-      if (fineWindowCount_ == 0) {
-        phase_ = app::EtmPhase::Finalize;
-        nextActionMs_ = now;
-        return true;
+      const bool onFloor = floorRssi_ != 0xFF &&
+                           static_cast<uint16_t>(rssi) <= static_cast<uint16_t>(floorRssi_) + app::kEtmSettleFloorMarginDb;
+      if (onFloor) return true;
+      // Stable but above the floor: may be a weak carrier still ramping, give it the full settle.
+      pointDeadlineMs_ = prof.coarseSettleMs;
+      nextActionMs_ = tunedAtMs_ + pointDeadlineMs_;
+      return false;
+    }
+
+    const uint32_t nextPoll = now + prof.adaptivePollMs;
+    const uint32_t deadlineAt = tunedAtMs_ + pointDeadlineMs_;
+    nextActionMs_ = nextPoll < deadlineAt ? nextPoll : deadlineAt;
+    return false;
+  }
+
+  // Upper bound on the adaptive wait: the learned settle percentile of carrier points in this band
+  // plus one poll, never above the profile's fixed settle. Fixed settle until enough samples exist.
+  uint16_t learnedSettleCapMs(const app::EtmBandProfile& prof) const {
+    const app::EtmSettleHistogram& h = settleHistograms_[bandIndex_ % app::kBandCount];
+    if (h.samples < app::kEtmSettleLearnMinSamples) return prof.coarseSettleMs;
+    const uint32_t target = (static_cast<uint32_t>(h.samples) * app::kEtmSettleLearnPercentile + 99U) / 100U;
+    uint32_t acc = 0;
+    uint16_t capMs = prof.coarseSettleMs;
+    for (uint8_t b = 0; b < app::kEtmSettleBuckets; ++b) {
+      acc += h.buckets[b];
+      if (acc >= target) {
+        capMs = static_cast<uint16_t>((b + 1U) * app::kEtmSettleBucketMs + prof.adaptivePollMs);
+        break;
       }
-      startFineWindow(state, now);
-      nextActionMs_ = now;
-      return true;
     }
+    const uint16_t floorMs = static_cast<uint16_t>(prof.adaptiveFirstReadMs + prof.adaptivePollMs);
+    if (capMs < floorMs) capMs = floorMs;
+    return capMs < prof.coarseSettleMs ? capMs : prof.coarseSettleMs;
+  }
 
-    awaitingMeasure_ = false;
-    nextActionMs_ = now;
-    return true;
+  void recordSettleSample(uint32_t elapsedMs) {
+    app::EtmSettleHistogram& h = settleHistograms_[bandIndex_ % app::kBandCount];
+    if (h.samples >= app::kEtmSettleHistogramCap) {
+      h.samples = 0;
+      for (uint8_t b = 0; b < app::kEtmSettleBuckets; ++b) {
+        h.buckets[b] = static_cast<uint16_t>(h.buckets[b] / 2);
+        h.samples = static_cast<uint16_t>(h.samples + h.buckets[b]);
+      }
+    }
+    uint32_t bucket = elapsedMs / app::kEtmSettleBucketMs;
+    if (bucket >= app::kEtmSettleBuckets) bucket = app::kEtmSettleBuckets - 1;
+    ++h.buckets[bucket];
+    ++h.samples;
   }
 
   void buildFineWindows() {
@@ -450,34 +1150,22 @@ class EtmScanner {
       const app::EtmBandProfile* prof = segmentProfiles_[segIdx];
       if (prof->fineStepKhz == 0) continue;
 
-      // Collect candidates for this segment and sort by frequency
-      uint8_t n = 0;
-      app::EtmCandidate segCands[app::kEtmMaxCandidates];
-      for (uint8_t i = 0; i < candidateCount_; ++i) {
-        if (candidates_[i].segmentIndex == segIdx) segCands[n++] = candidates_[i];
-      }
-      if (n == 0) continue;
-
-      for (uint8_t i = 1; i < n; ++i) {
-        app::EtmCandidate key = segCands[i];
-        int8_t j = static_cast<int8_t>(i) - 1;
-        while (j >= 0 && segCands[j].frequencyKhz > key.frequencyKhz) {
-          segCands[j + 1] = segCands[j];
-          --j;
-        }
-        segCands[j + 1] = key;
-      }
+      // This segment's candidates still needing a fine pass, already in frequency order
+      uint16_t i = nextFineCandidate(0, segIdx);
+      if (i >= candidates_.size()) continue;
 
       // Cluster: merge within 2*coarseStep; center = stronger; window ±fineWindowKhz clamped to segment
       const uint16_t mergeDist = static_cast<uint16_t>(seg.coarseStepKhz * 2);
-      uint16_t clusterCenter = segCands[0].frequencyKhz;
-      uint8_t clusterBestRssi = segCands[0].rssi;
-
-      for (uint8_t i = 1; i <= n; ++i) {
-        uint16_t freq = i < n ? segCands[i].frequencyKhz : 0xFFFF;
-        if (i < n && absDeltaKhz(freq, clusterCenter) <= mergeDist) {
-          if (segCands[i].rssi > clusterBestRssi) {
-            clusterBestRssi = segCands[i].rssi;
+      uint16_t clusterCenter = candidates_[i].frequencyKhz;
+      uint8_t clusterBestRssi = candidates_[i].rssi;
+
+      while (true) {
+        i = nextFineCandidate(static_cast<uint16_t>(i + 1), segIdx);
+        const bool more = i < candidates_.size();
+        const uint16_t freq = more ? candidates_[i].frequencyKhz : 0xFFFF;
+        if (more && absDeltaKhz(freq, clusterCenter) <= mergeDist) {
+          if (candidates_[i].rssi > clusterBestRssi) {
+            clusterBestRssi = candidates_[i].rssi;
             clusterCenter = freq;
           }
           continue;
@@ -494,14 +1182,21 @@ class EtmScanner {
             scanMax,
             segIdx,
         };
-        if (i < n) {
-          clusterCenter = segCands[i].frequencyKhz;
-          clusterBestRssi = segCands[i].rssi;
-        }
+        if (!more) break;
+        clusterCenter = candidates_[i].frequencyKhz;
+        clusterBestRssi = candidates_[i].rssi;
       }
     }
   }
 
+  // Peaks were already placed by the coarse fit and get no fine window.
+  uint16_t nextFineCandidate(uint16_t from, uint8_t segIdx) const {
+    while (from < candidates_.size() &&
+           (candidates_[from].segmentIndex != segIdx || candidates_[from].peakFit == app::EtmPeakFit::Peak))
+      ++from;
+    return from;
+  }
+
   void startFineWindow(app::AppState& state, uint32_t now) {
     if (fineWindowIndex_ >= fineWindowCount_) return;
     const app::EtmFineWindow& w = fineWindows_[fineWindowIndex_];
@@ -522,13 +1217,14 @@ class EtmScanner {
   void upgradeCandidateInWindow(uint16_t centerKhz, uint16_t bestKhz, uint8_t bestRssi, uint8_t bestSnr, uint8_t segIdx) {
     const app::EtmSegment& seg = segments_[segIdx];
     const uint16_t mergeDist = static_cast<uint16_t>(seg.coarseStepKhz * 2);
-    for (uint8_t i = 0; i < candidateCount_; ++i) {
+    for (uint16_t i = 0; i < candidates_.size(); ++i) {
       if (candidates_[i].segmentIndex != segIdx) continue;
       if (absDeltaKhz(candidates_[i].frequencyKhz, centerKhz) <= mergeDist) {
         candidates_[i].frequencyKhz = bestKhz;
         candidates_[i].rssi = bestRssi;
         candidates_[i].snr = bestSnr;
         candidates_[i].scanPass = app::kScanPassFine;
+        repositionCandidate(i);
         return;
       }
     }
@@ -540,7 +1236,12 @@ class EtmScanner {
     state.seekScan.scanning = true;
     publishState(state);
 
-    if (verifyCandidateIndex_ >= candidateCount_) {
+    // Peaks are settled by the coarse fit; only the rest are retuned for a full RSQ reading.
+    while (!verifyAwaitingMeasure_ && verifyCandidateIndex_ < candidates_.size() &&
+           candidates_[verifyCandidateIndex_].peakFit == app::EtmPeakFit::Peak)
+      ++verifyCandidateIndex_;
+
+    if (verifyCandidateIndex_ >= candidates_.size()) {
       phase_ = app::EtmPhase::Finalize;
       nextActionMs_ = now;
       return true;
@@ -561,6 +1262,7 @@ class EtmScanner {
     bool pilotPresent = false;
     uint8_t multipath = 0;
     if (services::radio::readFullRsqFm(&rssi, &snr, &freqOff, &pilotPresent, &multipath)) {
+      recordScope(c.frequencyKhz, segments_[c.segmentIndex].coarseStepKhz, rssi, snr);
       c.rssi = rssi;
       c.snr = snr;
       c.freqOff = freqOff;
@@ -573,6 +1275,47 @@ class EtmScanner {
     return true;
   }
 
+  // Fast/Hybrid: one settled coarse reading per Shoulder, so the skirt test no longer rests on its early
+  // adaptive exit. The reading replaces the candidate's and its coarse sample's.
+  bool tickRecheck(app::AppState& state, uint32_t now) {
+    state.seekScan.active = true;
+    state.seekScan.seeking = false;
+    state.seekScan.scanning = true;
+    publishState(state);
+
+    while (!recheckAwaitingMeasure_ && recheckIndex_ < candidates_.size() &&
+           candidates_[recheckIndex_].peakFit != app::EtmPeakFit::Shoulder)
+      ++recheckIndex_;
+
+    if (recheckIndex_ >= candidates_.size()) {
+      dropRecheckedShoulders();
+      phase_ = app::EtmPhase::Finalize;
+      nextActionMs_ = now;
+      return true;
+    }
+
+    app::EtmCandidate& c = candidates_[recheckIndex_];
+    if (!recheckAwaitingMeasure_) {
+      state.radio.frequencyKhz = c.frequencyKhz;
+      state.radio.ssbTuneOffsetHz = 0;
+      services::radio::apply(state);
+      recheckAwaitingMeasure_ = true;
+      nextActionMs_ = now + segmentProfiles_[c.segmentIndex]->coarseSettleMs;
+      return true;
+    }
+
+    uint8_t rssi = 0, snr = 0;
+    services::radio::readSignalQuality(&rssi, &snr);
+    recordScope(c.frequencyKhz, segments_[c.segmentIndex].coarseStepKhz, rssi, snr);
+    recordCoarseSample(c.frequencyKhz, rssi, c.segmentIndex);
+    c.rssi = rssi;
+    c.snr = snr;
+    ++recheckIndex_;
+    recheckAwaitingMeasure_ = false;
+    nextActionMs_ = now;
+    return true;
+  }
+
   bool tickFine(app::AppState& state, uint32_t now) {
     state.seekScan.active = true;
     state.seekScan.seeking = false;
@@ -598,6 +1341,7 @@ class EtmScanner {
 
     uint8_t rssi = 0, snr = 0;
     services::radio::readSignalQuality(&rssi, &snr);
+    recordScope(fineCurrentKhz_, fineStepKhz_, rssi, snr);
     if (rssi > fineBestRssi_ || (rssi == fineBestRssi_ && snr > fineBestSnr_)) {
       fineBestRssi_ = rssi;
       fineBestSnr_ = snr;
@@ -625,33 +1369,26 @@ class EtmScanner {
     const uint16_t mergeKhz = prof->mergeDistanceKhz;
     const uint16_t clusterDistKhz = (segmentCount_ > 0 ? segments_[0].coarseStepKhz : 10) * 2;
 
-    uint8_t commitList[app::kEtmMaxCandidates];
-    uint8_t commitCount = 0;
-
-    if (modulation_ == app::Modulation::FM && verifySettleMs_ > 0 && candidateCount_ > 0) {
-      // Sort candidates by frequency for clustering
-      for (uint8_t i = 1; i < candidateCount_; ++i) {
-        app::EtmCandidate key = candidates_[i];
-        int8_t j = static_cast<int8_t>(i) - 1;
-        while (j >= 0 && candidates_[j].frequencyKhz > key.frequencyKhz) {
-          candidates_[j + 1] = candidates_[j];
-          --j;
-        }
-        candidates_[j + 1] = key;
-      }
-      // Cluster within 2*coarseStep; score; commit clear winner or keep all in cluster
+    memory_.stations.clear();
+    memory_.cursor = -1;
+    memory_.bandIndex = bandIndex_;
+    memory_.modulation = modulation_;
+
+    if (modulation_ == app::Modulation::FM && verifySettleMs_ > 0 && !candidates_.empty()) {
+      // Candidates are frequency-sorted: cluster within 2*coarseStep; score (Peaks on their coarse reading);
+      // commit a clear winner alone, else all. Peaks always stand.
       constexpr float kClearWinnerMargin = 5.0f;
-      for (uint8_t i = 0; i < candidateCount_; ) {
-        uint8_t clusterStart = i;
-        uint8_t clusterEnd = i + 1;
-        while (clusterEnd < candidateCount_ &&
+      for (uint16_t i = 0; i < candidates_.size(); ) {
+        const uint16_t clusterStart = i;
+        uint16_t clusterEnd = static_cast<uint16_t>(i + 1);
+        while (clusterEnd < candidates_.size() &&
                absDeltaKhz(candidates_[clusterEnd].frequencyKhz, candidates_[clusterStart].frequencyKhz) <= clusterDistKhz) {
           ++clusterEnd;
         }
         float bestScore = scoreCandidateFm(candidates_[clusterStart]);
-        uint8_t bestIdx = clusterStart;
+        uint16_t bestIdx = clusterStart;
         float secondScore = -1e9f;
-        for (uint8_t k = clusterStart + 1; k < clusterEnd; ++k) {
+        for (uint16_t k = static_cast<uint16_t>(clusterStart + 1); k < clusterEnd; ++k) {
           const float s = scoreCandidateFm(candidates_[k]);
           if (s > bestScore) {
             secondScore = bestScore;
@@ -661,89 +1398,105 @@ class EtmScanner {
             secondScore = s;
           }
         }
-        if (clusterEnd - clusterStart > 1 && bestScore - secondScore >= kClearWinnerMargin) {
-          if (commitCount < app::kEtmMaxCandidates) commitList[commitCount++] = bestIdx;
-        } else {
-          for (uint8_t k = clusterStart; k < clusterEnd && commitCount < app::kEtmMaxCandidates; ++k) {
-            commitList[commitCount++] = k;
-          }
+        const bool clearWinner = clusterEnd - clusterStart > 1 && bestScore - secondScore >= kClearWinnerMargin;
+        for (uint16_t k = clusterStart; k < clusterEnd; ++k) {
+          if (!clearWinner || k == bestIdx || candidates_[k].peakFit == app::EtmPeakFit::Peak)
+            commitCandidate(candidates_[k], mergeKhz);
         }
         i = clusterEnd;
       }
     } else {
-      for (uint8_t i = 0; i < candidateCount_; ++i) commitList[commitCount++] = i;
+      for (uint16_t i = 0; i < candidates_.size(); ++i) commitCandidate(candidates_[i], mergeKhz);
+    }
+    candidates_.clear();
+
+    identifyDwellMs_ = state.global.scanIdentifyDwellMs;  // fixed for the pass, like the scan speed
+    if (identifyDwellMs_ > 0 && modulation_ == app::Modulation::FM && state.global.rdsMode != app::RdsMode::Off &&
+        !memory_.stations.empty()) {
+      identifyIndex_ = 0;
+      identifyTuned_ = false;
+      identified_ = 0;
+      identifySkips_ = 0;
+      identifyRan_ = true;
+      identifyPassStartMs_ = millis();
+      phase_ = app::EtmPhase::IdentifyScan;
+      return true;
     }
+    return finishScan(state);
+  }
 
-    memory_.count = 0;
-    memory_.cursor = -1;
-    memory_.bandIndex = bandIndex_;
-    memory_.modulation = modulation_;
+  // Identify pass: one dwell per committed station. rds::tick decodes it from the main loop (it is let
+  // through while identifying()); this only watches what the decoder has locked.
+  bool tickIdentify(app::AppState& state, uint32_t now) {
+    state.seekScan.active = true;
+    state.seekScan.seeking = false;
+    state.seekScan.scanning = true;
+    publishState(state);
 
-    for (uint8_t ci = 0; ci < commitCount; ++ci) {
-      const app::EtmCandidate& c = candidates_[commitList[ci]];
-      int16_t found = -1;
-      for (uint8_t j = 0; j < memory_.count; ++j) {
-        if (absDeltaKhz(memory_.stations[j].frequencyKhz, c.frequencyKhz) <= mergeKhz) {
-          found = static_cast<int16_t>(j);
-          break;
-        }
-      }
-      if (found >= 0) {
-        app::EtmStation& s = memory_.stations[found];
-        if (c.rssi > s.rssi || (c.rssi == s.rssi && c.scanPass > s.scanPass)) {
-          s.frequencyKhz = c.frequencyKhz;
-          s.rssi = c.rssi;
-          s.snr = c.snr;
-          s.scanPass = c.scanPass;
-          s.lastSeenMs = millis();
-        }
-        continue;
-      }
-      if (memory_.count >= app::kEtmMaxStations) {
-        int16_t evict = -1;
-        for (uint8_t j = 0; j < memory_.count; ++j) {
-          if (memory_.stations[j].scanPass == 2) continue;
-          if (evict < 0 || memory_.stations[j].scanPass < memory_.stations[evict].scanPass ||
-              (memory_.stations[j].scanPass == memory_.stations[evict].scanPass && memory_.stations[j].rssi < memory_.stations[evict].rssi))
-            evict = static_cast<int16_t>(j);
-        }
-        if (evict >= 0) {
-          memory_.stations[evict] = {
-              c.frequencyKhz, c.rssi, c.snr, bandIndex_, modulation_, c.scanPass, static_cast<uint32_t>(millis())};
-        }
-        continue;
-      }
-      memory_.stations[memory_.count++] = {
-          c.frequencyKhz, c.rssi, c.snr, bandIndex_, modulation_, c.scanPass, static_cast<uint32_t>(millis())};
+    if (identifyIndex_ >= memory_.stations.size()) return finishScan(state);
+
+    app::EtmStation& s = memory_.stations[identifyIndex_];
+    if (!identifyTuned_) {
+      state.radio.frequencyKhz = s.frequencyKhz;
+      state.radio.ssbTuneOffsetHz = 0;
+      services::radio::apply(state);
+      identifyTuned_ = true;
+      identifyStartMs_ = now;
+      nextActionMs_ = now + app::kEtmIdentifyPollMs;
+      return true;
     }
 
-    // Sort by frequency
-    for (uint8_t i = 1; i < memory_.count; ++i) {
-      app::EtmStation key = memory_.stations[i];
-      int8_t j = static_cast<int8_t>(i) - 1;
-      while (j >= 0 && memory_.stations[j].frequencyKhz > key.frequencyKhz) {
-        memory_.stations[j + 1] = memory_.stations[j];
-        --j;
-      }
-      memory_.stations[j + 1] = key;
+    const uint32_t dwellMs = now - identifyStartMs_;
+    uint16_t pi = 0;
+    const bool piLocked = services::rds::votedPi(&pi);
+    // A cached PS is shown only for the PI it was stored under, so with PI locked it names this station.
+    const bool psKnown = piLocked && state.rds.hasPs && state.rds.ps[0] != '\0';
+    // The decoder cleared lastGroupMs on the retune: a group at or after the dwell start is this station's.
+    const bool groupSeen =
+        state.rds.lastGroupMs != 0 && static_cast<int32_t>(state.rds.lastGroupMs - identifyStartMs_) >= 0;
+    const bool noSync = !groupSeen && dwellMs >= app::kEtmIdentifySyncMs;
+    if (!psKnown && !noSync && dwellMs < identifyDwellMs_) {
+      nextActionMs_ = now + app::kEtmIdentifyPollMs;
+      return true;
     }
 
+    if (piLocked) {
+      s.rdsPi = pi;
+      ++identified_;
+    }
+    if (psKnown) app::copyText(s.rdsPs, state.rds.ps);
+    if (noSync) ++identifySkips_;
+    ++identifyIndex_;
+    identifyTuned_ = false;
+    nextActionMs_ = now;
+    return true;
+  }
+
+  // Scan end: cursor and radio on the strongest station, list to the flash cache.
+  bool finishScan(app::AppState& state) {
     uint16_t tuneKhz = restoreKhz_;
     uint8_t bestRssi = 0;
-    for (uint8_t i = 0; i < memory_.count; ++i) {
+    for (uint16_t i = 0; i < memory_.stations.size(); ++i) {
       if (memory_.stations[i].rssi > bestRssi) {
         bestRssi = memory_.stations[i].rssi;
         tuneKhz = memory_.stations[i].frequencyKhz;
         memory_.cursor = static_cast<int16_t>(i);
       }
     }
-    if (memory_.count > 0 && memory_.cursor < 0)
+    if (!memory_.stations.empty() && memory_.cursor < 0)
       memory_.cursor = 0;
 
     state.radio.frequencyKhz = tuneKhz;
     state.radio.ssbTuneOffsetHz = 0;
     services::radio::apply(state);
 
+    scanDurationMs_ = static_cast<uint32_t>(millis() - scanStartMs_);
+    phase_ = app::EtmPhase::Idle;
+    services::radio::setSamplerPaused(false);
+    memoryDirty_ = !services::etmcache::store(memory_, memoryRegion_);
+    if (checkpointed_) services::etmcache::clearCheckpoint();
+    checkpointed_ = false;
+
     state.seekScan.active = false;
     state.seekScan.seeking = false;
     state.seekScan.scanning = false;
@@ -752,42 +1505,343 @@ class EtmScanner {
     state.seekScan.bestRssi = bestRssi;
     publishState(state);
 
-    candidateCount_ = 0;
-    phase_ = app::EtmPhase::Idle;
+    Serial.printf("[etm] scan done: %u stations, %u points, %lu ms%s",
+                  static_cast<unsigned>(memory_.stations.size()),
+                  static_cast<unsigned>(pointsVisited_),
+                  static_cast<unsigned long>(scanDurationMs_),
+                  adaptiveSettle_ ? " (adaptive settle)" : "");
+    if (hybrid_) Serial.printf(", %u seek stops", static_cast<unsigned>(seekStops_));
+    if (resumed_) Serial.printf(", resumed");
+    Serial.printf(", %u peak fits, %u shoulders dropped", static_cast<unsigned>(peakFits_),
+                  static_cast<unsigned>(shouldersDropped_));
+    if (shouldersRechecked_ > 0) Serial.printf(" (%u rechecked)", static_cast<unsigned>(shouldersRechecked_));
+    if (identifyRan_) {
+      Serial.printf(", %u/%u identified (%u without RDS) in %lu ms", static_cast<unsigned>(identified_),
+                    static_cast<unsigned>(identifyIndex_), static_cast<unsigned>(identifySkips_),
+                    static_cast<unsigned long>(millis() - identifyPassStartMs_));
+    }
+    Serial.printf("\n");
     return true;
   }
 
-  void addStationToMemory(uint16_t freqKhz, uint8_t rssi, uint8_t snr, uint8_t pass) {
-    if (memory_.count < app::kEtmMaxStations) {
-      app::EtmStation& s = memory_.stations[memory_.count++];
-      s.frequencyKhz = freqKhz;
-      s.rssi = rssi;
-      s.snr = snr;
-      s.bandIndex = memory_.bandIndex;
-      s.modulation = memory_.modulation;
-      s.scanPass = pass;
-      s.lastSeenMs = millis();
+  // Finalize step: a candidate within mergeKhz of a committed station replaces it only when stronger.
+  void commitCandidate(const app::EtmCandidate& c, uint16_t mergeKhz) {
+    const int16_t found = app::findStationNear(memory_, c.frequencyKhz, mergeKhz);
+    if (found >= 0) {
+      app::EtmStation& s = memory_.stations[found];
+      if (c.rssi > s.rssi || (c.rssi == s.rssi && c.scanPass > s.scanPass)) {
+        s.rssi = c.rssi;
+        s.snr = c.snr;
+        s.scanPass = c.scanPass;
+        s.lastSeenMs = millis();
+        s.misses = 0;
+        if (s.frequencyKhz != c.frequencyKhz) {
+          // The stronger reading moves the station; take it out and back in to keep the order.
+          app::EtmStation moved = s;
+          moved.frequencyKhz = c.frequencyKhz;
+          memory_.stations.erase(static_cast<uint16_t>(found));
+          app::insertStation(memory_, moved);
+        }
+      }
       return;
     }
+    storeStation({c.frequencyKhz, c.rssi, c.snr, bandIndex_, modulation_, c.scanPass, static_cast<uint32_t>(millis()), 0, 0, 0, ""});
+  }
+
+  // Sorted insert; a full store evicts its weakest non-fine station (seek-found first) to make room.
+  void storeStation(const app::EtmStation& station) {
+    if (app::insertStation(memory_, station) >= 0) return;
     int16_t evict = -1;
-    for (uint8_t i = 0; i < memory_.count; ++i) {
-      if (memory_.stations[i].scanPass == 2) continue;
-      if (evict < 0 || memory_.stations[i].scanPass < memory_.stations[evict].scanPass ||
-          (memory_.stations[i].scanPass == memory_.stations[evict].scanPass &&
-           memory_.stations[i].rssi < memory_.stations[evict].rssi))
+    for (uint16_t i = 0; i < memory_.stations.size(); ++i) {
+      const app::EtmStation& s = memory_.stations[i];
+      if (s.scanPass == 2) continue;
+      if (evict < 0 || s.scanPass < memory_.stations[evict].scanPass ||
+          (s.scanPass == memory_.stations[evict].scanPass && s.rssi < memory_.stations[evict].rssi))
         evict = static_cast<int16_t>(i);
     }
-    if (evict >= 0) {
-      memory_.stations[evict].frequencyKhz = freqKhz;
-      memory_.stations[evict].rssi = rssi;
-      memory_.stations[evict].snr = snr;
-      memory_.stations[evict].scanPass = pass;
-      memory_.stations[evict].lastSeenMs = millis();
+    if (evict < 0) return;
+    memory_.stations.erase(static_cast<uint16_t>(evict));
+    app::insertStation(memory_, station);
+  }
+
+  void addStationToMemory(uint16_t freqKhz, uint8_t rssi, uint8_t snr, uint8_t pass) {
+    // Inserting shifts indices: keep the cursor on the station it pointed at.
+    const bool hadCursor = memory_.cursor >= 0 && static_cast<uint16_t>(memory_.cursor) < memory_.stations.size();
+    const uint16_t cursorKhz = hadCursor ? memory_.stations[memory_.cursor].frequencyKhz : 0;
+    storeStation({freqKhz, rssi, snr, memory_.bandIndex, memory_.modulation, pass, static_cast<uint32_t>(millis()), 0, 0, 0, ""});
+    if (hadCursor) memory_.cursor = app::findStationNear(memory_, cursorKhz, 0);
+  }
+
+  static app::Modulation batchModulation(uint8_t bandIndex) {
+    return app::kBandPlan[bandIndex].id == app::BandId::FM ? app::Modulation::FM : app::Modulation::AM;
+  }
+
+  static bool batchScannable(uint8_t bandIndex) {
+    return app::bandSupportsModulation(bandIndex, batchModulation(bandIndex));
+  }
+
+  static uint32_t batchOrderKey(uint8_t bandIndex) {
+    const bool fm = batchModulation(bandIndex) == app::Modulation::FM;
+    return (fm ? 0U : 0x10000U) + app::kBandPlan[bandIndex].minKhz;
+  }
+
+  // Between bands of a batch: fold the finished band into the index, then start the next band or put
+  // the radio back where the batch started.
+  bool tickBatch(app::AppState& state) {
+    if (batchBandRunning_) {
+      batchBandRunning_ = false;
+      if (!batchCancelled_) {
+        mergeMemoryIntoIndex();
+        batchPointsDone_ += totalPoints_;
+        ++batchPos_;
+        // Its list is in the flash cache now; a power cut from here on resumes at the next band.
+        if (batchPos_ < batchCount_) saveBatchCheckpoint();
+      }
+    }
+    while (!batchCancelled_ && batchPos_ < batchCount_) {
+      if (startBatchBand(state)) return true;
+      ++batchPos_;
+    }
+    finishBatch(state);
+    return true;
+  }
+
+  bool startBatchBand(app::AppState& state) {
+    const uint8_t bandIndex = batchBands_[batchPos_];
+    const app::BandDef& band = app::kBandPlan[bandIndex];
+    const app::Modulation modulation = batchModulation(bandIndex);
+    state.radio.bandIndex = bandIndex;
+    state.radio.modulation = modulation;
+    state.radio.frequencyKhz = app::bandMinKhzFor(band, state.global.fmRegion);
+    state.radio.ssbTuneOffsetHz = 0;
+    if (modulation == app::Modulation::FM) {
+      state.radio.fmStepKhz = app::fmStepKhzFromIndex(app::defaultStepIndexForBand(band, state.global.fmRegion));
+    } else {
+      state.radio.amStepKhz = app::isSsb(band.defaultMode)
+                                  ? 1
+                                  : app::amStepKhzFromIndex(app::defaultStepIndexForBand(band, state.global.fmRegion));
+    }
+
+    // First band of a family: one tuner configuration spanning every batch band of that modulation.
+    if (!batchFamilyHeld_ || modulation != batchFamily_) {
+      uint16_t spanMinKhz = 0xFFFF, spanMaxKhz = 0;
+      for (uint8_t i = batchPos_; i < batchCount_; ++i) {
+        if (batchModulation(batchBands_[i]) != modulation) continue;
+        const app::BandDef& b = app::kBandPlan[batchBands_[i]];
+        const uint16_t minKhz = app::bandMinKhzFor(b, state.global.fmRegion);
+        const uint16_t maxKhz = app::bandMaxKhzFor(b, state.global.fmRegion);
+        if (minKhz < spanMinKhz) spanMinKhz = minKhz;
+        if (maxKhz > spanMaxKhz) spanMaxKhz = maxKhz;
+      }
+      services::radio::holdTunerSpan(state, spanMinKhz, spanMaxKhz);
+      batchFamily_ = modulation;
+      batchFamilyHeld_ = true;
+    }
+    services::radio::applyRuntimeSettings(state);
+
+    syncContext(state);
+    if (!requestScan(state)) return false;
+    batchBandRunning_ = true;
+    return true;
+  }
+
+  void finishBatch(app::AppState& state) {
+    services::radio::releaseTunerSpan();
+    const uint8_t volume = state.radio.volume;
+    state.radio = batchRestore_;
+    state.radio.volume = volume;
+    syncContext(state);
+    services::radio::apply(state);
+    services::radio::applyRuntimeSettings(state);
+
+    batchActive_ = false;
+    index_.cursor = -1;
+    if (batchCancelled_ && batchPos_ < batchCount_) {
+      saveBatchCheckpoint();
+    } else if (batchCheckpointed_) {
+      services::etmcache::clearCheckpoint();
+    }
+    const uint32_t durationMs = millis() - batchStartMs_;
+    state.seekScan.active = false;
+    state.seekScan.seeking = false;
+    state.seekScan.scanning = false;
+    state.seekScan.batchPointsVisited = batchCancelled_ ? static_cast<uint16_t>(batchPointsDone_) : batchTotalPoints_;
+    publishState(state);
+    Serial.printf("[etm] batch %s: %u/%u bands, %u indexed stations, %lu ms\n",
+                  batchCancelled_ ? "cancelled" : "done",
+                  static_cast<unsigned>(batchPos_ < batchCount_ ? batchPos_ : batchCount_),
+                  static_cast<unsigned>(batchCount_),
+                  static_cast<unsigned>(index_.entries.size()),
+                  static_cast<unsigned long>(durationMs));
+  }
+
+  // Replaces the index entries of memory_'s band with its fresh list. A station another band already
+  // holds (overlapping plans, e.g. 11m and CB) stays with that band, keeping the stronger reading.
+  void mergeMemoryIntoIndex() {
+    for (uint16_t i = index_.entries.size(); i > 0; --i) {
+      if (index_.entries[i - 1].bandIndex == memory_.bandIndex) index_.entries.erase(static_cast<uint16_t>(i - 1));
+    }
+
+    const uint32_t mergeKhz = memory_.modulation == app::Modulation::FM ? mergeDistanceKhz_ * 10U : mergeDistanceKhz_;
+    for (uint16_t i = 0; i < memory_.stations.size(); ++i) {
+      const app::EtmStation& s = memory_.stations[i];
+      const app::EtmIndexEntry entry = {s.frequencyKhz, memory_.bandIndex, memory_.modulation, s.rssi, s.snr};
+      const uint32_t key = app::indexKeyKhz(entry);
+      uint16_t at = app::indexLowerBound(index_, key);
+
+      bool merged = false;
+      for (uint16_t n = at > 0 ? at - 1 : 0; n < index_.entries.size() && n <= at; ++n) {
+        app::EtmIndexEntry& other = index_.entries[n];
+        const uint32_t otherKey = app::indexKeyKhz(other);
+        if (other.modulation != entry.modulation || (otherKey > key ? otherKey - key : key - otherKey) > mergeKhz) continue;
+        if (entry.rssi > other.rssi) {
+          other.rssi = entry.rssi;
+          other.snr = entry.snr;
+        }
+        merged = true;
+        break;
+      }
+      if (merged) continue;
+
+      if (index_.entries.full()) {
+        uint16_t weakest = 0;
+        for (uint16_t n = 1; n < index_.entries.size(); ++n) {
+          if (index_.entries[n].rssi < index_.entries[weakest].rssi) weakest = n;
+        }
+        if (index_.entries[weakest].rssi >= entry.rssi) continue;
+        index_.entries.erase(weakest);
+        if (weakest < at) --at;
+      }
+      index_.entries.insert(at, entry);
+    }
+  }
+
+  // Scan-mode navigation walks the index on every band the last batch covered, and on ALL.
+  bool indexCovers(const app::AppState& state) const {
+    if (index_.entries.empty() || app::isSsb(state.radio.modulation)) return false;
+    return app::kBandPlan[state.radio.bandIndex].id == app::BandId::All ||
+           (index_.bandMask & app::bandMaskBit(state.radio.bandIndex)) != 0;
+  }
+
+  void navigateIndex(app::AppState& state, int8_t direction) {
+    const app::EtmIndexEntry here = {state.radio.frequencyKhz, state.radio.bandIndex, state.radio.modulation, 0, 0};
+    const uint32_t hereKey = app::indexKeyKhz(here);
+    int16_t next = -1;
+    const uint16_t count = index_.entries.size();
+    const int16_t cursor = index_.cursor;
+    if (cursor >= 0 && cursor < static_cast<int16_t>(count) && app::indexKeyKhz(index_.entries[cursor]) == hereKey) {
+      next = static_cast<int16_t>((cursor + direction + count) % count);
+    } else if (direction > 0) {
+      // First entry above here, wrapping to the lowest.
+      uint16_t at = app::indexLowerBound(index_, hereKey);
+      while (at < count && app::indexKeyKhz(index_.entries[at]) == hereKey) ++at;
+      next = static_cast<int16_t>(at < count ? at : 0);
+    } else {
+      // Last entry below here, wrapping to the highest.
+      const uint16_t at = app::indexLowerBound(index_, hereKey);
+      next = static_cast<int16_t>(at > 0 ? at - 1 : count - 1);
+    }
+    index_.cursor = next;
+    const app::EtmIndexEntry& entry = index_.entries[next];
+
+    const bool bandChange = entry.bandIndex != state.radio.bandIndex || entry.modulation != state.radio.modulation;
+    if (bandChange) {
+      app::syncPersistentStateFromRadio(state);
+      app::applyBandRuntimeToRadio(state, entry.bandIndex);
+      if (state.radio.modulation != entry.modulation) {
+        const app::BandDef& band = app::kBandPlan[entry.bandIndex];
+        state.radio.modulation = entry.modulation;
+        state.radio.amStepKhz = app::isSsb(band.defaultMode)
+                                    ? 1
+                                    : app::amStepKhzFromIndex(app::defaultStepIndexForBand(band, state.global.fmRegion));
+        state.radio.ssbStepHz = 1000;
+      }
+    }
+    state.radio.frequencyKhz = entry.frequencyKhz;
+    state.radio.ssbTuneOffsetHz = 0;
+    services::radio::apply(state);
+    if (bandChange) {
+      services::radio::applyRuntimeSettings(state);
+      syncContext(state);
+    }
+
+    memory_.cursor = app::findStationNear(memory_, entry.frequencyKhz, 0);
+    publishState(state);
+  }
+
+  // Scope of the synced band, laid out afresh when its band limits changed since it was written.
+  app::EtmBandscope& activeScope() {
+    app::EtmBandscope& scope = scopes_[scopeBand_ % app::kBandCount];
+    if (scope.minKhz != scopeMinKhz_ || scope.maxKhz != scopeMaxKhz_) {
+      memset(scope.rssi, app::kBandscopeUnmeasured, sizeof(scope.rssi));
+      memset(scope.snr, 0, sizeof(scope.snr));
+      scope.minKhz = scopeMinKhz_;
+      scope.maxKhz = scopeMaxKhz_;
+      scope.measuredColumns = 0;
+      scope.sweepKhz = scopeSweepStartKhz_;
+      ++scope.generation;
+    }
+    return scope;
+  }
+
+  void recordScopeSpan(uint16_t lowKhz, uint16_t highKhz, uint8_t rssi, uint8_t snr) {
+    app::EtmBandscope& scope = activeScope();
+    if (highKhz < lowKhz || highKhz < scope.minKhz || lowKhz > scope.maxKhz) return;
+    const uint16_t first = app::bandscopeColumnFor(lowKhz, scope.minKhz, scope.maxKhz);
+    const uint16_t last = app::bandscopeColumnFor(highKhz, scope.minKhz, scope.maxKhz);
+    bool changed = false;
+    for (uint16_t column = first; column <= last; ++column) {
+      if (scope.rssi[column] == rssi && scope.snr[column] == snr) continue;
+      if (scope.rssi[column] == app::kBandscopeUnmeasured) ++scope.measuredColumns;
+      scope.rssi[column] = rssi;
+      scope.snr[column] = snr;
+      changed = true;
+    }
+    if (changed) ++scope.generation;
+  }
+
+  // One reading covers its raster cell, frequencyKhz - step/2 .. frequencyKhz + (step - 1)/2.
+  void recordScope(uint16_t frequencyKhz, uint16_t stepKhz, uint8_t rssi, uint8_t snr) {
+    const uint16_t below = static_cast<uint16_t>(stepKhz / 2);
+    const uint16_t above = static_cast<uint16_t>(stepKhz > 0 ? (stepKhz - 1) / 2 : 0);
+    const uint16_t lowKhz = frequencyKhz > below ? static_cast<uint16_t>(frequencyKhz - below) : 0;
+    recordScopeSpan(lowKhz, static_cast<uint16_t>(frequencyKhz + above), rssi, snr);
+  }
+
+  // A hybrid seek passed over the cells between fromKhz and toKhz without stopping, so they sat below the
+  // tuner's seek thresholds: drawn as floor rather than left showing an older scan.
+  void recordScopeSkipped(uint16_t fromKhz, uint16_t toKhz, uint16_t stepKhz, bool throughEnd) {
+    const uint16_t lowKhz = static_cast<uint16_t>(fromKhz + (stepKhz > 0 ? (stepKhz - 1) / 2 : 0) + 1);
+    const uint16_t highKhz = throughEnd ? toKhz : static_cast<uint16_t>(toKhz - stepKhz / 2 - 1);
+    if (toKhz > fromKhz) recordScopeSpan(lowKhz, highKhz, 0, 0);
+  }
+
+  // Next point of the silent background walk over the coarse raster; 0 when there is none.
+  uint16_t nextSweepKhz(uint16_t stepKhz, uint16_t listenKhz) {
+    if (stepKhz == 0) return 0;
+    app::EtmBandscope& scope = activeScope();
+    for (uint8_t tries = 0; tries < 2; ++tries) {
+      uint16_t khz = scope.sweepKhz;
+      if (khz < scopeSweepStartKhz_ || khz > scope.maxKhz) khz = scopeSweepStartKhz_;
+      scope.sweepKhz = static_cast<uint16_t>(khz + stepKhz);
+      if (khz != listenKhz) return khz;
+    }
+    return 0;
+  }
+
+  void removeStationAt(uint16_t index) {
+    if (index >= memory_.stations.size()) return;
+    memory_.stations.erase(index);
+    const int16_t count = static_cast<int16_t>(memory_.stations.size());
+    if (memory_.cursor > static_cast<int16_t>(index)) {
+      --memory_.cursor;
+    } else if (memory_.cursor == static_cast<int16_t>(index) && memory_.cursor >= count) {
+      memory_.cursor = static_cast<int16_t>(count - 1);
     }
   }
 
   void tuneToCursor(app::AppState& state) {
-    if (memory_.cursor < 0 || memory_.cursor >= static_cast<int16_t>(memory_.count)) return;
+    if (memory_.cursor < 0 || memory_.cursor >= static_cast<int16_t>(memory_.stations.size())) return;
     const app::EtmStation& s = memory_.stations[memory_.cursor];
     state.radio.frequencyKhz = s.frequencyKhz;
     state.radio.ssbTuneOffsetHz = 0;
@@ -795,21 +1849,175 @@ class EtmScanner {
   }
 
   bool tickCancelling(app::AppState& state) {
+    if (seekInFlight_) {
+      // Stops the tuner's seek right away; its result is dropped with the scan.
+      services::radio::cancelSeek();
+      services::radio::pollSeek(nullptr, nullptr);
+      seekInFlight_ = false;
+    }
+    if (identifyRan_) {
+      // Cancelled in the identify pass: the list is committed already, the cancel only cuts the pass short.
+      return finishScan(state);
+    }
+    // Keep the work done so far: the next scan of this band picks up from here.
+    if (!batchActive_ && isResumablePhase(resumablePhase_)) {
+      saveCheckpoint(resumablePhase_, millis());
+      Serial.printf("[etm] scan cancelled at %u kHz, checkpoint %s\n", static_cast<unsigned>(currentKhz_),
+                    checkpointed_ ? "saved" : "failed");
+    }
+    resumablePhase_ = app::EtmPhase::Idle;
     state.radio.frequencyKhz = restoreKhz_;
     state.radio.ssbTuneOffsetHz = 0;
     services::radio::apply(state);
-    candidateCount_ = 0;
+    candidates_.clear();
+    scanDurationMs_ = static_cast<uint32_t>(millis() - scanStartMs_);
+    phase_ = app::EtmPhase::Idle;
+    services::radio::setSamplerPaused(false);
     state.seekScan.active = false;
     state.seekScan.seeking = false;
     state.seekScan.scanning = false;
     publishState(state);
-    phase_ = app::EtmPhase::Idle;
     return true;
   }
 
+  // --- Checkpoint / resume ---
+
+  static bool isResumablePhase(app::EtmPhase phase) {
+    return phase == app::EtmPhase::CoarseScan || phase == app::EtmPhase::SeekScan ||
+           phase == app::EtmPhase::VerifyScan;
+  }
+
+  static bool checkpointMatches(const app::EtmCheckpoint& checkpoint, uint8_t bandIndex, app::Modulation modulation,
+                                app::FmRegion region, app::ScanSpeed speed) {
+    return checkpoint.batchMask == 0 && checkpoint.bandIndex == bandIndex && checkpoint.modulation == modulation && checkpoint.region == region &&
+           checkpoint.scanSpeed == speed;
+  }
+
+  // Standalone scans only, between readings (a pending measure is simply repeated after a resume).
+  bool checkpointDue(uint32_t now) const {
+    return !batchActive_ && isResumablePhase(phase_) && !awaitingMeasure_ && !verifyAwaitingMeasure_ &&
+           now - lastCheckpointMs_ >= app::kEtmCheckpointIntervalMs;
+  }
+
+  void saveCheckpoint(app::EtmPhase phase, uint32_t now) {
+    app::EtmCheckpoint checkpoint{};
+    checkpoint.bandIndex = bandIndex_;
+    checkpoint.modulation = modulation_;
+    checkpoint.region = scanRegion_;
+    checkpoint.scanSpeed = scanSpeed_;
+    checkpoint.phase = phase;
+    checkpoint.segmentIndex = segmentIndex_;
+    checkpoint.seekSegmentPrimed = seekSegmentPrimed_;
+    checkpoint.currentKhz = currentKhz_;
+    checkpoint.pointsVisited = pointsVisited_;
+    checkpoint.verifyIndex = verifyCandidateIndex_;
+    checkpoint.floorRssi = floorRssi_;
+    checkpoint.elapsedMs = now - scanStartMs_;
+    lastCheckpointMs_ = now;
+    if (services::etmcache::storeCheckpoint(checkpoint, candidates_, coarseSamples_)) checkpointed_ = true;
+  }
+
+  // Called by a fresh requestScan(): a checkpoint of this band and modulation, at any speed, is superseded.
+  void dropSupersededCheckpoint() {
+    app::EtmCheckpoint checkpoint{};
+    if (services::etmcache::loadCheckpoint(checkpoint, nullptr, nullptr) && checkpoint.batchMask == 0 &&
+        checkpoint.bandIndex == bandIndex_ && checkpoint.modulation == modulation_)
+      services::etmcache::clearCheckpoint();
+  }
+
+  // Called by requestScan() for resumeScan() once the scan is laid out: continues the checkpoint of the same
+  // band, modulation, region and speed.
+  void resumeFromCheckpoint() {
+    app::EtmCheckpoint checkpoint{};
+    if (!services::etmcache::loadCheckpoint(checkpoint, nullptr, nullptr) ||
+        !checkpointMatches(checkpoint, bandIndex_, modulation_, scanRegion_, scanSpeed_))
+      return;
+    // The coarse cursor has run past the last segment by the time VerifyScan starts.
+    const bool valid = services::etmcache::loadCheckpoint(checkpoint, &candidates_, &coarseSamples_) &&
+                       (checkpoint.phase == app::EtmPhase::VerifyScan
+                            ? checkpoint.verifyIndex <= candidates_.size()
+                            : checkpoint.segmentIndex < segmentCount_ &&
+                                  checkpoint.currentKhz >= segments_[checkpoint.segmentIndex].minKhz &&
+                                  checkpoint.currentKhz <= segments_[checkpoint.segmentIndex].maxKhz);
+    if (!valid) {
+      // Laid out differently (band limits changed) or unreadable: start over.
+      candidates_.clear();
+      coarseSamples_.clear();
+      services::etmcache::clearCheckpoint();
+      return;
+    }
+
+    phase_ = checkpoint.phase;
+    segmentIndex_ = checkpoint.segmentIndex;
+    seekSegmentPrimed_ = checkpoint.seekSegmentPrimed;
+    currentKhz_ = checkpoint.currentKhz;
+    pointsVisited_ = checkpoint.pointsVisited;
+    floorRssi_ = checkpoint.floorRssi;
+    settleMs_ = segmentProfiles_[segmentIndex_ < segmentCount_ ? segmentIndex_ : 0]->coarseSettleMs;
+    adjacentStops_ = 0;
+    quietPoints_ = 0;
+    if (phase_ == app::EtmPhase::VerifyScan) {
+      verifyCandidateIndex_ = checkpoint.verifyIndex;
+      verifySettleMs_ = segmentProfiles_[0]->verifySettleMs;
+    }
+    scanStartMs_ = millis() - checkpoint.elapsedMs;
+    lastCheckpointMs_ = millis();
+    checkpointed_ = true;
+    resumed_ = true;
+    Serial.printf("[etm] resuming scan at %u kHz: %u/%u points, %u candidates\n",
+                  static_cast<unsigned>(currentKhz_), static_cast<unsigned>(pointsVisited_),
+                  static_cast<unsigned>(totalPoints_), static_cast<unsigned>(candidates_.size()));
+  }
+
+  // Between bands and on cancel: the batch position only. A finished band's list is already in the flash
+  // cache, so nothing else is needed to rebuild the index.
+  void saveBatchCheckpoint() {
+    app::EtmCheckpoint checkpoint{};
+    checkpoint.bandIndex = batchBands_[batchPos_];
+    checkpoint.modulation = batchModulation(checkpoint.bandIndex);
+    checkpoint.region = batchRegion_;
+    checkpoint.scanSpeed = batchSpeed_;
+    checkpoint.phase = app::EtmPhase::Idle;
+    checkpoint.elapsedMs = millis() - batchStartMs_;
+    checkpoint.batchMask = batchMask_;
+    checkpoint.batchPos = batchPos_;
+    // The band scans are done with these; the batch record carries none.
+    candidates_.clear();
+    coarseSamples_.clear();
+    batchCheckpointed_ = services::etmcache::storeCheckpoint(checkpoint, candidates_, coarseSamples_);
+  }
+
+  // Called by requestBatchScan() once the batch is laid out: skips the bands the checkpoint has finished and
+  // folds their cached lists back into the index.
+  void resumeBatchFromCheckpoint(const app::AppState& state, const uint16_t* bandPoints) {
+    app::EtmCheckpoint checkpoint{};
+    if (!services::etmcache::loadCheckpoint(checkpoint, nullptr, nullptr) || checkpoint.batchPos >= batchCount_ ||
+        batchBands_[checkpoint.batchPos] != checkpoint.bandIndex) {
+      // The band plan or the scannable set changed since: start over.
+      services::etmcache::clearCheckpoint();
+      return;
+    }
+    app::AppState finished = state;
+    for (uint8_t i = 0; i < checkpoint.batchPos; ++i) {
+      finished.radio.bandIndex = batchBands_[i];
+      finished.radio.modulation = batchModulation(batchBands_[i]);
+      syncContext(finished);
+      mergeMemoryIntoIndex();
+      batchPointsDone_ += bandPoints[i];
+    }
+    batchPos_ = checkpoint.batchPos;
+    batchStartMs_ = millis() - checkpoint.elapsedMs;
+    batchCheckpointed_ = true;
+    Serial.printf("[etm] batch resuming at band %u/%u, %u indexed stations\n", static_cast<unsigned>(batchPos_ + 1),
+                  static_cast<unsigned>(batchCount_), static_cast<unsigned>(index_.entries.size()));
+  }
+
   app::EtmPhase phase_ = app::EtmPhase::Idle;
   uint32_t nextActionMs_ = 0;
   app::EtmMemory memory_{};
+  app::FmRegion memoryRegion_ = app::FmRegion::World;
+  bool memoryLoaded_ = false;  // memory_ holds the (cached) list of its context
+  bool memoryDirty_ = false;   // changed since last written to the flash cache
   uint16_t mergeDistanceKhz_ = app::kEtmProfileFm.mergeDistanceKhz;
 
   app::EtmSegment segments_[kEtmMaxSegments];
@@ -825,8 +2033,80 @@ class EtmScanner {
   app::Modulation modulation_ = app::Modulation::FM;
   bool awaitingMeasure_ = false;
 
-  app::EtmCandidate candidates_[app::kEtmMaxCandidates];
-  uint8_t candidateCount_ = 0;
+  app::ScanSpeed scanSpeed_ = app::ScanSpeed::Fast;
+  app::FmRegion scanRegion_ = app::FmRegion::World;
+  app::EtmPhase resumablePhase_ = app::EtmPhase::Idle;  // last checkpointable phase ticked
+  uint32_t lastCheckpointMs_ = 0;
+  bool checkpointed_ = false;  // the checkpoint slot holds this scan
+  bool resumed_ = false;
+
+  bool adaptiveSettle_ = app::kEtmAdaptiveSettleDefault;
+  app::EtmSettleHistogram settleHistograms_[app::kBandCount]{};
+  uint32_t tunedAtMs_ = 0;
+  uint16_t pointDeadlineMs_ = 0;
+  uint8_t prevRssi_ = 0;
+  uint8_t prevSnr_ = 0;
+  uint8_t floorRssi_ = 0xFF;  // lowest fully settled RSSI in the current segment
+  bool havePrevSample_ = false;
+  uint32_t scanStartMs_ = 0;
+  uint32_t scanDurationMs_ = 0;
+
+  bool hybrid_ = false;
+  bool hybridSeeksSw_ = false;  // Hybrid on a band with SW broadcast segments (see seeksSegment())
+  bool seekSegmentPrimed_ = false;  // first point of the current segment measured
+  bool seekInFlight_ = false;       // startScanSeek() issued, polled by tickSeek()
+  uint8_t adjacentStops_ = 0;       // consecutive seek stops one raster step apart
+  uint8_t quietPoints_ = 0;         // consecutive empty points while stepping a dense stretch
+  uint16_t seekStops_ = 0;
+  app::PsramArray<app::EtmCoarseSample> coarseSamples_{app::kEtmMaxCoarseSamples,
+                                                       app::kEtmMaxCoarseSamplesInternal};  // by frequency
+  uint16_t peakFits_ = 0;
+  uint16_t shouldersDropped_ = 0;
+  uint16_t shouldersRechecked_ = 0;
+
+  uint16_t identifyDwellMs_ = app::kEtmIdentifyDwellDefaultMs;
+  bool identifyRan_ = false;    // this scan entered the identify pass
+  bool identifyTuned_ = false;  // identifyIndex_ is tuned and dwelling
+  uint16_t identifyIndex_ = 0;
+  uint16_t identified_ = 0;
+  uint16_t identifySkips_ = 0;
+  uint32_t identifyStartMs_ = 0;
+  uint32_t identifyPassStartMs_ = 0;
+
+  bool batchActive_ = false;
+  bool batchCancelled_ = false;
+  bool batchBandRunning_ = false;  // requestScan() of batchBands_[batchPos_] succeeded
+  bool batchFamilyHeld_ = false;
+  app::Modulation batchFamily_ = app::Modulation::AM;
+  uint8_t batchBands_[app::kBandCount];
+  uint8_t batchCount_ = 0;
+  uint8_t batchPos_ = 0;
+  uint32_t batchMask_ = 0;
+  app::FmRegion batchRegion_ = app::FmRegion::World;
+  app::ScanSpeed batchSpeed_ = app::ScanSpeed::Fast;
+  bool batchCheckpointed_ = false;  // the checkpoint slot holds this batch
+  uint16_t batchTotalPoints_ = 0;
+  uint32_t batchPointsDone_ = 0;
+  uint32_t batchStartMs_ = 0;
+  app::RadioState batchRestore_{};
+  app::EtmGlobalIndex index_{};
+
+  app::EtmBandscope scopes_[app::kBandCount]{};
+  uint8_t scopeBand_ = 0;
+  uint16_t scopeMinKhz_ = 0;
+  uint16_t scopeMaxKhz_ = 0;
+  uint16_t scopeSweepStartKhz_ = 0;
+
+  bool refreshEnabled_ = app::kEtmRefreshDefault;
+  uint16_t refreshListenKhz_ = 0;
+  uint32_t refreshIdleSinceMs_ = 0;
+  uint32_t refreshLastSliceMs_ = 0;
+  uint16_t refreshProbeKhz_ = 0;  // probe in flight (0 = none)
+  uint16_t refreshProbeStepKhz_ = 0;
+  bool refreshProbeStation_ = false;  // a station's probe (else a bandscope sweep point)
+  bool refreshProbeSlice_ = false;    // an AIE mute slice is held until the probe returns
+
+  app::PsramArray<app::EtmCandidate> candidates_{app::kEtmMaxCandidates, app::kEtmMaxCandidatesInternal};  // by frequency
 
   app::EtmFineWindow fineWindows_[app::kEtmMaxFineWindows];
   uint8_t fineWindowCount_ = 0;
@@ -840,9 +2120,11 @@ class EtmScanner {
   uint16_t fineSettleMs_ = 0;
   bool fineAwaitingMeasure_ = false;
 
-  uint8_t verifyCandidateIndex_ = 0;
+  uint16_t verifyCandidateIndex_ = 0;
   uint16_t verifySettleMs_ = 0;
   bool verifyAwaitingMeasure_ = false;
+  uint16_t recheckIndex_ = 0;
+  bool recheckAwaitingMeasure_ = false;
 };
 
 EtmScanner g_scanner;
@@ -853,6 +2135,10 @@ bool requestScan(const app::AppState& state) {
   return g_scanner.requestScan(state);
 }
 
+bool resumeScan(const app::AppState& state) {
+  return g_scanner.resumeScan(state);
+}
+
 bool tick(app::AppState& state) {
   return g_scanner.tick(state);
 }
@@ -861,6 +2147,14 @@ void requestCancel() {
   g_scanner.requestCancel();
 }
 
+bool hasCheckpoint(const app::AppState& state) {
+  return g_scanner.hasCheckpoint(state);
+}
+
+uint16_t knownStationFrom(const app::AppState& state, int8_t direction, uint32_t maxAgeMs) {
+  return g_scanner.knownStationFrom(state, direction, maxAgeMs);
+}
+
 bool busy() {
   return g_scanner.busy();
 }
@@ -877,6 +2171,42 @@ void addSeekResult(uint16_t frequencyKhz, uint8_t rssi, uint8_t snr) {
   g_scanner.addSeekResult(frequencyKhz, rssi, snr);
 }
 
+void setAdaptiveSettle(bool enabled) {
+  g_scanner.setAdaptiveSettle(enabled);
+}
+
+void setBackgroundRefresh(bool enabled) {
+  g_scanner.setBackgroundRefresh(enabled);
+}
+
+bool identifying() {
+  return g_scanner.identifying();
+}
+
+bool tickBackgroundRefresh(app::AppState& state) {
+  return g_scanner.tickBackgroundRefresh(state);
+}
+
+bool requestBatchScan(const app::AppState& state, uint32_t bandMask) {
+  return g_scanner.requestBatchScan(state, bandMask);
+}
+
+bool resumeBatchScan(const app::AppState& state, uint32_t bandMask) {
+  return g_scanner.requestBatchScan(state, bandMask, true);
+}
+
+bool hasBatchCheckpoint(const app::AppState& state, uint32_t bandMask) {
+  return g_scanner.hasBatchCheckpoint(state, bandMask);
+}
+
+const app::EtmGlobalIndex* stationIndex() {
+  return g_scanner.stationIndex();
+}
+
+const app::EtmBandscope* bandscope() {
+  return g_scanner.bandscope();
+}
+
 void navigateNext(app::AppState& state) {
   g_scanner.navigateNext(state);
 }
@@ -1,9 +1,15 @@
 #include <Arduino.h>
-#include <SI4735.h>
 #include <Wire.h>
+#if !defined(APP_TUNER_SIM)
+#include <SI4735.h>
+#endif
 
 #include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
 
 #include "../../include/aie_engine.h"
 #include "../../include/app_config.h"
@@ -12,11 +18,20 @@
 #include "../../include/etm_scan.h"
 #include "../../include/hardware_pins.h"
 #include "../../include/patch_init.h"
+#if defined(APP_TUNER_SIM)
+#include "../../include/tuner_sim.h"
+#endif
 
 namespace services::radio {
 namespace {
+#if defined(APP_TUNER_SIM)
+// Host-native build: the simulated tuner mirrors the SI4735 calls used below.
+using TunerDevice = sim::SimTuner;
+#else
 class SI4735Local : public SI4735 {
  public:
+  using RdsStatus = si47x_rds_status;
+
   bool readRdsStatusRaw(si47x_rds_status& out, uint8_t intAck, uint8_t mtFifo, uint8_t statusOnly) {
     getRdsStatus(intAck, mtFifo, statusOnly);
     out = currentRdsStatus;
@@ -36,15 +51,16 @@ class SI4735Local : public SI4735 {
   }
 };
 
-SI4735Local g_rx;
+using TunerDevice = SI4735Local;
+#endif
+
+TunerDevice g_rx;
 SemaphoreHandle_t g_radio_mux = nullptr;
 bool g_ready = false;
 bool g_hasAppliedState = false;
 bool g_ssbPatchLoaded = false;
-bool g_seekAborted = false;
-bool g_seekAllowHoldAbort = true;
-bool g_muted = false;
-bool g_aie_muted = false;
+std::atomic<bool> g_muted{false};
+std::atomic<bool> g_aie_muted{false};
 bool g_squelchMuted = false;
 bool g_bootPowerPrepared = false;
 bool g_i2cStarted = false;
@@ -52,10 +68,128 @@ uint32_t g_powerOnMs = 0;
 uint32_t g_lastSquelchPollMs = 0;
 uint8_t g_squelchOpenVotes = 0;
 uint8_t g_squelchCloseVotes = 0;
-bool g_rsqCacheValid = false;
-uint32_t g_rsqCacheMs = 0;
-uint8_t g_rsqCacheRssi = 0;
-uint8_t g_rsqCacheSnr = 0;
+uint32_t g_squelchNextSeq = 0;
+RsqRing g_rsqRing;
+// Epoch bumps on every retune so samples of the previous channel are never served as current.
+std::atomic<uint16_t> g_rsqEpoch{0};
+std::atomic<uint32_t> g_rsqEpochMs{0};
+std::atomic<bool> g_samplerPaused{false};
+uint32_t g_nextInlineSampleMs = 0;
+
+// Radio worker: loop-side requests are posted as commands and executed on core 0, so the UI/input loop
+// never waits for I2C or mode switches. Each command type sits in the queue at most
+// once; re-posting one that is still queued only refreshes its payload (latest target wins).
+enum class CommandType : uint8_t {
+  Apply = 0,
+  Volume,
+  Mute,
+  ResetRds,
+  Count,
+};
+
+struct Command {
+  CommandType type;
+  uint32_t postedMs;
+};
+
+constexpr uint8_t kCommandTypeCount = static_cast<uint8_t>(CommandType::Count);
+
+TaskHandle_t g_workerTask = nullptr;
+QueueHandle_t g_commandQueue = nullptr;
+SemaphoreHandle_t g_pendingMux = nullptr;  // guards the Apply payload slot, never held across I2C
+std::atomic<bool> g_commandQueued[kCommandTypeCount];
+app::AppState g_pendingApplyState{};
+app::AppState g_workApplyState{};
+std::atomic<uint8_t> g_pendingVolume{0};
+
+// Incremental seek: SEEK_START is issued under a short lock and the tuner then seeks on its own. Each
+// pollSeek() takes the lock once to read STC/READFREQ, so nothing holds the radio across a seek and the
+// loop keeps running (input, AIE, squelch, rendering) between polls.
+enum class SeekPhase : uint8_t {
+  Idle = 0,
+  Tuned,    // start (or opposite band edge) tuned, SEEK_START due at the next poll
+  Seeking,  // SEEK_START issued, waiting for STC
+  Done,     // result waiting for pollSeek()
+};
+
+struct SeekRun {
+  SeekPhase phase;
+  bool up;
+  bool allowHoldAbort;     // user seek: a held button also aborts; scan seeks stop on abort events only
+  bool retryOppositeEdge;  // user seek: nothing up to the band edge seeks on from the other edge once
+  bool retried;
+  bool found;
+  bool aborted;
+  bool cancelRequested;
+  uint16_t minKhz;
+  uint16_t maxKhz;
+  uint16_t startKhz;
+  uint32_t startedMs;
+  uint32_t nextPollMs;
+  app::RadioState radio;  // applied state at the start; its frequency becomes the result
+  app::FmRegion region;
+};
+
+SeekRun g_seek{};
+std::atomic<bool> g_seekRunning{false};
+std::atomic<uint16_t> g_seekProgressKhz{0};
+
+// Two-step probe of another channel: startProbe() tunes away and pollProbe() reads and tunes back once the
+// settle time has passed, each under a short lock. In between the tuner sits on probeKhz, so the sampler,
+// squelch votes and RDS polling skip while g_probeAway is set, and any apply or seek returns home first.
+enum class ProbePhase : uint8_t {
+  Idle = 0,
+  Away,  // tuned to probeKhz, reading due at readAtMs
+  Done,  // result waiting for pollProbe()
+};
+
+struct ProbeRun {
+  ProbePhase phase;
+  bool measured;
+  uint8_t rssi;
+  uint8_t snr;
+  uint16_t homeKhz;
+  uint32_t readAtMs;
+};
+
+ProbeRun g_probe{};
+std::atomic<bool> g_probeAway{false};
+
+// Copies of the applied state written with it (under g_radio_mux, by the worker or a synchronous apply) for
+// the checks the loop core makes without the lock: RDS polling, probes, squelch votes and the sampler.
+std::atomic<bool> g_appliedValid{false};
+std::atomic<app::Modulation> g_appliedModulation{app::Modulation::FM};
+std::atomic<uint8_t> g_appliedSquelch{0};  // 0 (off) until runtime settings were applied
+constexpr uint32_t kSeekPollMs = 10;
+constexpr uint32_t kSeekEdgeSettleMs = 20;
+
+std::atomic<uint32_t> g_statPosted{0};
+std::atomic<uint32_t> g_statCoalesced{0};
+std::atomic<uint32_t> g_statExecuted{0};
+std::atomic<uint32_t> g_statSuperseded{0};
+std::atomic<uint32_t> g_statMaxQueueMs{0};
+std::atomic<uint32_t> g_statTunes{0};
+std::atomic<uint32_t> g_statDeferredTunes{0};
+std::atomic<uint32_t> g_statRdsResets{0};
+std::atomic<uint32_t> g_statRdsResetsSkipped{0};
+std::atomic<uint32_t> g_statBandConfigs{0};
+
+// Tuner span held by a batch scan: band switches inside it in the same modulation only retune.
+bool g_spanHeld = false;
+app::Modulation g_spanModulation = app::Modulation::AM;
+uint16_t g_spanMinKhz = 0;
+uint16_t g_spanMaxKhz = 0;
+
+// Tune coalescing: a frequency-only apply arriving within the settle window of the previous tune is held
+// (still queued, so later posts keep refreshing its target) and issued once when the window closes.
+uint16_t g_tuneSettleWindowMs = app::kTuneSettleWindowMs;
+uint32_t g_lastTuneMs = 0;
+std::atomic<bool> g_applyDeferred{false};  // cleared by supersedePendingApply() on the loop core
+uint32_t g_applyDueMs = 0;
+// Retune counter and its value at the last RDS FIFO flush: a ResetRds with nothing retuned since the
+// last flush (applyLocked flushes on every retune) would only repeat it.
+uint32_t g_tuneSeq = 0;
+uint32_t g_rdsFlushTuneSeq = 0;
 
 const char* g_lastError = "not-initialized";
 app::RadioState g_lastApplied{};
@@ -82,8 +216,13 @@ struct RuntimeSnapshot {
 RuntimeSnapshot g_lastRuntime{};
 
 constexpr uint32_t kSquelchPollMs = 80;
-// Slightly above the 80ms poll cadence to absorb scheduler jitter and let UI+squelch share one read.
-constexpr uint32_t kRsqCacheMaxAgeMs = 120;
+// Sampler cadence: fast right after a retune so meter and squelch follow the AGC ramp, slow otherwise.
+constexpr uint32_t kRsqFastPeriodMs = 25;
+constexpr uint32_t kRsqSlowPeriodMs = 150;
+constexpr uint32_t kRsqFastWindowMs = 500;
+// Consumers accept the newest sample up to this age; slightly above the slow period to absorb jitter.
+constexpr uint32_t kRsqMaxAgeMs = 180;
+constexpr uint32_t kWorkerStackBytes = 4096;
 constexpr uint8_t kSquelchHysteresisRssi = 2;
 constexpr uint8_t kSquelchVotesToToggle = 2;
 
@@ -237,7 +376,31 @@ void resetSquelchStateLocked(bool forceUnsquelch) {
   }
 }
 
-void invalidateRsqCacheLocked() { g_rsqCacheValid = false; }
+// Apply-driven retune (frequency step or band switch): feeds the settle window and the tune counter.
+void noteRetuneLocked() {
+  g_lastTuneMs = millis();
+  ++g_tuneSeq;
+  g_statTunes.fetch_add(1, std::memory_order_relaxed);
+}
+
+void invalidateRsqCacheLocked() {
+  g_rsqEpoch.store(static_cast<uint16_t>(g_rsqEpoch.load(std::memory_order_relaxed) + 1), std::memory_order_release);
+  g_rsqEpochMs.store(millis(), std::memory_order_release);
+}
+
+// Back to the applied channel from a probe still away: at its read, or before an apply or seek retunes.
+// An interrupted probe reports no measurement.
+void returnFromProbeLocked() {
+  if (g_probe.phase != ProbePhase::Away) {
+    return;
+  }
+  g_rx.setFrequency(g_probe.homeKhz);
+  ++g_tuneSeq;
+  invalidateRsqCacheLocked();
+  resetSquelchVotes();
+  g_probe.phase = ProbePhase::Done;
+  g_probeAway.store(false, std::memory_order_release);
+}
 
 void applyRegionSetting(const app::AppState& state) {
   if (state.radio.modulation != app::Modulation::FM) {
@@ -326,6 +489,7 @@ void updateRuntimeSnapshot(const app::AppState& state) {
   g_lastRuntime.zoomMenu = state.global.zoomMenu;
   g_lastRuntime.fmRegion = state.global.fmRegion;
   g_hasRuntimeSnapshot = true;
+  g_appliedSquelch.store(state.global.squelch, std::memory_order_release);
 }
 
 void configureSeekProperties(const app::AppState& state) {
@@ -364,6 +528,8 @@ void configureRdsForFm(bool enable) {
     g_rx.clearRdsBuffer();
     g_rx.flushRdsFifo();
     g_rdsConfiguredForFm = true;
+    g_rdsFlushTuneSeq = g_tuneSeq;
+    g_statRdsResets.fetch_add(1, std::memory_order_relaxed);
     return;
   }
 
@@ -424,18 +590,26 @@ bool readCurrentSignalQuality(uint8_t& rssi, uint8_t& snr) {
   return true;
 }
 
+// Every RSQ read lands in the ring. Pushes only happen under g_radio_mux, which keeps the ring
+// single-producer even though the sampler task and main-loop fallbacks both read the tuner.
 void updateRsqCacheLocked(uint8_t rssi, uint8_t snr) {
-  g_rsqCacheRssi = rssi;
-  g_rsqCacheSnr = snr;
-  g_rsqCacheMs = millis();
-  g_rsqCacheValid = true;
+  g_rsqRing.push(millis(), rssi, snr, g_rsqEpoch.load(std::memory_order_relaxed));
+}
+
+// Lock-free: newest sample of the current channel, if any.
+bool latestCurrentSample(RsqSample& sample) {
+  return g_rsqRing.latest(sample) && sample.tuneEpoch == g_rsqEpoch.load(std::memory_order_acquire);
+}
+
+bool freshCurrentSample(RsqSample& sample, uint32_t nowMs) {
+  return latestCurrentSample(sample) && static_cast<uint32_t>(nowMs - sample.timestampMs) <= kRsqMaxAgeMs;
 }
 
 bool readCurrentSignalQualityCachedLocked(uint8_t& rssi, uint8_t& snr) {
-  const uint32_t nowMs = millis();
-  if (g_rsqCacheValid && static_cast<uint32_t>(nowMs - g_rsqCacheMs) <= kRsqCacheMaxAgeMs) {
-    rssi = g_rsqCacheRssi;
-    snr = g_rsqCacheSnr;
+  RsqSample sample{};
+  if (freshCurrentSample(sample, millis())) {
+    rssi = sample.rssi;
+    snr = sample.snr;
     return true;
   }
 
@@ -443,36 +617,86 @@ bool readCurrentSignalQualityCachedLocked(uint8_t& rssi, uint8_t& snr) {
     return false;
   }
 
-  g_rsqCacheRssi = rssi;
-  g_rsqCacheSnr = snr;
-  g_rsqCacheMs = nowMs;
-  g_rsqCacheValid = true;
+  updateRsqCacheLocked(rssi, snr);
   return true;
 }
 
-void updateSquelchFromSignalLocked() {
-  if (!g_hasAppliedState || !g_hasRuntimeSnapshot) {
-    resetSquelchStateLocked(true);
+// One sampler pass; returns the delay until the next one. Never blocks on the radio lock: seek and
+// ETM hold it for long stretches, and a skipped beat is preferable to queueing behind them.
+uint32_t samplerStep(uint32_t nowMs) {
+  const bool settling = static_cast<uint32_t>(nowMs - g_rsqEpochMs.load(std::memory_order_acquire)) < kRsqFastWindowMs;
+  const uint32_t periodMs = settling ? kRsqFastPeriodMs : kRsqSlowPeriodMs;
+  if (!g_ready || !g_appliedValid.load(std::memory_order_acquire) || g_samplerPaused.load(std::memory_order_acquire) ||
+      g_seekRunning.load(std::memory_order_acquire) || g_probeAway.load(std::memory_order_acquire)) {
+    return periodMs;
+  }
+
+  // A consumer fallback read may already have produced a recent enough sample.
+  RsqSample sample{};
+  if (latestCurrentSample(sample) && static_cast<uint32_t>(nowMs - sample.timestampMs) < periodMs) {
+    return periodMs;
+  }
+
+  if (xSemaphoreTake(g_radio_mux, 0) != pdTRUE) {
+    return kRsqFastPeriodMs;
+  }
+  uint8_t rssi = 0;
+  uint8_t snr = 0;
+  if (readCurrentSignalQuality(rssi, snr)) {
+    updateRsqCacheLocked(rssi, snr);
+  }
+  xSemaphoreGive(g_radio_mux);
+  return periodMs;
+}
+
+void workerTask(void*);
+
+// Votes on the sampler's output; the radio lock is only taken to flip the mute, or to read the
+// tuner directly when no fresh sample exists (sampler paused or starved).
+void setSquelchMuted(bool muted) {
+  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
     return;
   }
+  setSquelchMutedLocked(muted);
+  xSemaphoreGive(g_radio_mux);
+}
 
-  const uint8_t sql = g_lastRuntime.squelch;
-  if (sql == 0) {
-    resetSquelchStateLocked(true);
+void updateSquelchFromSignal(uint32_t nowMs) {
+  const uint8_t sql = g_appliedSquelch.load(std::memory_order_acquire);
+  if (!g_appliedValid.load(std::memory_order_acquire) || sql == 0) {
+    resetSquelchVotes();
+    if (g_squelchMuted) {
+      setSquelchMuted(false);
+    }
     return;
   }
 
-  if (services::seekscan::busy() || services::etm::busy()) {
-    // Hold current squelch state during seek/scan to avoid rapid toggling while the tuner moves.
+  if (services::seekscan::busy() || services::etm::busy() || g_probeAway.load(std::memory_order_acquire)) {
+    // Hold current squelch state during seek/scan/probe to avoid rapid toggling while the tuner moves.
     resetSquelchVotes();
     return;
   }
 
+  // One vote per sample: polling faster than the sampler must not count the same reading twice.
   uint8_t rssi = 0;
-  uint8_t snr = 0;
-  (void)snr;
-  if (!readCurrentSignalQualityCachedLocked(rssi, snr)) {
-    return;
+  RsqSample sample{};
+  if (freshCurrentSample(sample, nowMs)) {
+    if (sample.sequence < g_squelchNextSeq) {
+      return;
+    }
+    g_squelchNextSeq = sample.sequence + 1;
+    rssi = sample.rssi;
+  } else {
+    if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+      return;
+    }
+    uint8_t snr = 0;
+    const bool ok = readCurrentSignalQualityCachedLocked(rssi, snr);
+    xSemaphoreGive(g_radio_mux);
+    if (!ok) {
+      return;
+    }
+    g_squelchNextSeq = g_rsqRing.published();
   }
 
   const uint8_t threshold = squelchThresholdRssiFromUi(sql);
@@ -488,7 +712,7 @@ void updateSquelchFromSignalLocked() {
       g_squelchCloseVotes = 0;
       if (g_squelchOpenVotes >= kSquelchVotesToToggle) {
         resetSquelchVotes();
-        setSquelchMutedLocked(false);
+        setSquelchMuted(false);
       }
     } else {
       g_squelchOpenVotes = 0;
@@ -503,7 +727,7 @@ void updateSquelchFromSignalLocked() {
     g_squelchOpenVotes = 0;
     if (g_squelchCloseVotes >= kSquelchVotesToToggle) {
       resetSquelchVotes();
-      setSquelchMutedLocked(true);
+      setSquelchMuted(true);
     }
   } else {
     g_squelchCloseVotes = 0;
@@ -615,11 +839,9 @@ void applyStepProperties(const app::RadioState& radio) {
   }
 }
 
-void configureModeAndBand(const app::AppState& state) {
+void configureModeAndBand(const app::AppState& state, uint16_t bandMinKhz, uint16_t bandMaxKhz) {
   const app::RadioState& radio = state.radio;
-  const app::BandDef& band = app::kBandPlan[radio.bandIndex];
-  const uint16_t bandMinKhz = app::bandMinKhzFor(band, state.global.fmRegion);
-  const uint16_t bandMaxKhz = app::bandMaxKhzFor(band, state.global.fmRegion);
+  g_statBandConfigs.fetch_add(1, std::memory_order_relaxed);
 
   setAmpEnabled(false);
   delay(12);
@@ -655,18 +877,11 @@ void configureModeAndBand(const app::AppState& state) {
   setAmpEnabled(true);
 }
 
-bool stopSeekingCallback() {
-  const bool abortRequested =
-      g_seekAllowHoldAbort ? services::input::consumeAbortRequest() : services::input::consumeAbortEventRequest();
-  if (abortRequested) {
-    g_seekAborted = true;
-    return true;
-  }
-  return false;
+void configureModeAndBand(const app::AppState& state) {
+  const app::BandDef& band = app::kBandPlan[state.radio.bandIndex];
+  configureModeAndBand(state, app::bandMinKhzFor(band, state.global.fmRegion), app::bandMaxKhzFor(band, state.global.fmRegion));
 }
 
-void showSeekProgressCallback(uint16_t frequencyKhz) { services::seekscan::notifySeekProgress(frequencyKhz); }
-
 }  // namespace
 
 void prepareBootPower() {
@@ -720,11 +935,23 @@ bool begin() {
   invalidateRsqCacheLocked();
   g_lastSquelchPollMs = millis();
   applyMuteState();
-  g_rx.setMaxSeekTime(app::kSeekTimeoutMs);
 
   g_lastError = "ok";
   g_ready = true;
   Serial.printf("[radio] initialized @0x%02X\n", i2cAddress);
+
+  if (g_pendingMux == nullptr) {
+    g_pendingMux = xSemaphoreCreateMutex();
+  }
+  if (g_commandQueue == nullptr) {
+    g_commandQueue = xQueueCreate(kCommandTypeCount, sizeof(Command));
+  }
+  // Core 0 keeps tuner I/O off the UI/loop core; without the task tick() drains commands and samples inline.
+  if (g_workerTask == nullptr && g_commandQueue != nullptr && g_pendingMux != nullptr &&
+      xTaskCreatePinnedToCore(workerTask, "radio_worker", kWorkerStackBytes, nullptr, 2, &g_workerTask, 0) != pdPASS) {
+    g_workerTask = nullptr;
+    Serial.println("[radio] worker task unavailable, running commands from loop");
+  }
   return true;
 }
 
@@ -732,24 +959,24 @@ bool ready() { return g_ready; }
 
 const char* lastError() { return g_lastError; }
 
-void apply(const app::AppState& state) {
-  if (!g_ready || g_radio_mux == nullptr) {
-    return;
-  }
-  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
-    return;
-  }
+namespace {
 
+void applyLocked(const app::AppState& state) {
+  returnFromProbeLocked();
   const app::RadioState& radio = state.radio;
   const bool regionChanged = g_hasAppliedState && state.global.fmRegion != g_lastAppliedRegion;
 
+  const bool insideHeldSpan = g_spanHeld && !regionChanged && radio.modulation == g_spanModulation &&
+                              radio.frequencyKhz >= g_spanMinKhz && radio.frequencyKhz <= g_spanMaxKhz;
   const bool fullReconfigure =
       !g_hasAppliedState ||
-      radio.bandIndex != g_lastApplied.bandIndex ||
+      (radio.bandIndex != g_lastApplied.bandIndex && !insideHeldSpan) ||
       radio.modulation != g_lastApplied.modulation ||
       (regionChanged && radio.modulation == app::Modulation::FM);
 
   if (fullReconfigure) {
+    g_spanHeld = false;
+    noteRetuneLocked();
     configureModeAndBand(state);
     if (!app::isSsb(radio.modulation)) {
       g_lastAppliedSsbCalHz = 0;
@@ -766,6 +993,7 @@ void apply(const app::AppState& state) {
     }
 
     if (radio.frequencyKhz != g_lastApplied.frequencyKhz) {
+      noteRetuneLocked();
       g_rx.setFrequency(radio.frequencyKhz);
       resetSquelchVotes();
       invalidateRsqCacheLocked();
@@ -792,20 +1020,14 @@ void apply(const app::AppState& state) {
   g_lastApplied = radio;
   g_lastAppliedRegion = state.global.fmRegion;
   g_hasAppliedState = true;
-
-  xSemaphoreGive(g_radio_mux);
+  g_appliedModulation.store(radio.modulation, std::memory_order_release);
+  g_appliedValid.store(true, std::memory_order_release);
 }
 
-void applyRuntimeSettings(const app::AppState& state) {
-  if (!g_ready || g_radio_mux == nullptr) {
-    return;
-  }
+void applyRuntimeSettingsLocked(const app::AppState& state) {
   if (runtimeSnapshotMatches(state)) {
     return;
   }
-  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
-    return;
-  }
   applyBandwidthSetting(state);
   applyAgcSetting(state);
   applySquelchSetting(state);
@@ -817,114 +1039,473 @@ void applyRuntimeSettings(const app::AppState& state) {
   applyRegionSetting(state);
   applyPowerProfile(state);
   updateRuntimeSnapshot(state);
+}
+
+// A synchronous apply makes any still-queued async apply stale; drop it instead of retuning back. A held
+// tune goes with it: left deferred with its due time passed, the worker would never block again.
+void supersedePendingApply() {
+  if (g_pendingMux == nullptr || xSemaphoreTake(g_pendingMux, portMAX_DELAY) != pdTRUE) {
+    return;
+  }
+  if (g_commandQueued[static_cast<uint8_t>(CommandType::Apply)].exchange(false)) {
+    g_statSuperseded.fetch_add(1, std::memory_order_relaxed);
+  }
+  g_applyDeferred = false;
+  xSemaphoreGive(g_pendingMux);
+}
+
+}  // namespace
+
+void apply(const app::AppState& state) {
+  if (!g_ready || g_radio_mux == nullptr) {
+    return;
+  }
+  supersedePendingApply();
+  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+    return;
+  }
+  applyLocked(state);
   xSemaphoreGive(g_radio_mux);
 }
 
-bool seekImpl(app::AppState& state, int8_t direction, bool allowHoldAbort, bool retryOppositeEdge) {
-  if (!g_ready || g_radio_mux == nullptr || app::isSsb(state.radio.modulation)) {
+void applyRuntimeSettings(const app::AppState& state) {
+  if (!g_ready || g_radio_mux == nullptr) {
+    return;
+  }
+  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+    return;
+  }
+  applyRuntimeSettingsLocked(state);
+  xSemaphoreGive(g_radio_mux);
+}
+
+namespace {
+
+void finishSeekLocked(uint16_t frequencyKhz, bool found) {
+  g_seek.found = found;
+  g_seek.phase = SeekPhase::Done;
+  g_seek.radio.frequencyKhz = frequencyKhz;
+  g_seek.radio.ssbTuneOffsetHz = 0;
+  g_lastApplied = g_seek.radio;
+  g_lastAppliedRegion = g_seek.region;
+  g_hasAppliedState = true;
+  g_appliedModulation.store(g_seek.radio.modulation, std::memory_order_release);
+  g_appliedValid.store(true, std::memory_order_release);
+  invalidateRsqCacheLocked();
+  g_seekProgressKhz.store(frequencyKhz, std::memory_order_release);
+  g_seekRunning.store(false, std::memory_order_release);
+}
+
+void issueSeekStartLocked(uint32_t nowMs) {
+  g_rx.seekStation(g_seek.up ? 1 : 0, 0);
+  g_seek.phase = SeekPhase::Seeking;
+  g_seek.nextPollMs = nowMs + kSeekPollMs;
+}
+
+// One step of the running seek under the radio lock: SEEK_START, STC poll, edge retry or cancel.
+void stepSeekLocked(uint32_t nowMs, bool abort) {
+  if (abort) {
+    if (g_seek.phase == SeekPhase::Seeking) {
+      g_rx.getStatus(0, 1);
+    }
+    g_seek.aborted = true;
+    finishSeekLocked(g_rx.getFrequency(), false);
+    return;
+  }
+  if (g_seek.phase == SeekPhase::Tuned) {
+    issueSeekStartLocked(nowMs);
+    return;
+  }
+
+  const uint16_t frequencyKhz = g_rx.getFrequency();
+  g_seekProgressKhz.store(frequencyKhz, std::memory_order_release);
+  if (!g_rx.getTuneCompleteTriggered()) {
+    if (nowMs - g_seek.startedMs < app::kSeekTimeoutMs) {
+      g_seek.nextPollMs = nowMs + kSeekPollMs;
+      return;
+    }
+    g_rx.getStatus(0, 1);
+  }
+
+  const bool found = g_rx.getStatusValid() && frequencyKhz >= g_seek.minKhz && frequencyKhz <= g_seek.maxKhz &&
+                     frequencyKhz != g_seek.startKhz;
+  if (found) {
+    finishSeekLocked(frequencyKhz, true);
+    return;
+  }
+  const uint16_t restartKhz = g_seek.up ? g_seek.minKhz : g_seek.maxKhz;
+  if (g_seek.retryOppositeEdge && !g_seek.retried && restartKhz != g_seek.startKhz) {
+    g_seek.retried = true;
+    g_rx.setFrequency(restartKhz);
+    g_seek.phase = SeekPhase::Tuned;
+    g_seek.nextPollMs = nowMs + kSeekEdgeSettleMs;
+    return;
+  }
+  // Nothing found: back to where the seek started.
+  if (frequencyKhz != g_seek.startKhz) {
+    g_rx.setFrequency(g_seek.startKhz);
+  }
+  finishSeekLocked(g_seek.startKhz, false);
+}
+
+bool beginSeek(const app::AppState& state,
+               int8_t direction,
+               bool allowHoldAbort,
+               bool retryOppositeEdge,
+               uint16_t minKhz,
+               uint16_t maxKhz,
+               uint8_t spacingKhz,
+               uint16_t gridOriginKhz) {
+  if (!g_ready || g_radio_mux == nullptr || app::isSsb(state.radio.modulation) ||
+      g_seek.phase != SeekPhase::Idle) {
     return false;
   }
+  // A queued apply would retune under the running seek; issue its target now instead.
+  supersedePendingApply();
   if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
     return false;
   }
+  applyLocked(state);
   invalidateRsqCacheLocked();
+  ++g_tuneSeq;
+
+  services::input::clearAbortRequest();
+  g_seek = SeekRun{};
+  g_seek.up = direction >= 0;
+  g_seek.allowHoldAbort = allowHoldAbort;
+  g_seek.retryOppositeEdge = retryOppositeEdge;
+  g_seek.minKhz = minKhz;
+  g_seek.maxKhz = maxKhz;
+  g_seek.radio = state.radio;
+  g_seek.region = state.global.fmRegion;
+  g_seek.startedMs = millis();
+
+  if (state.radio.modulation == app::Modulation::FM) {
+    g_rx.setSeekFmLimits(minKhz, maxKhz);
+    g_rx.setSeekFmSpacing(spacingKhz);
+  } else {
+    g_rx.setSeekAmLimits(minKhz, maxKhz);
+    g_rx.setSeekAmSpacing(spacingKhz);
+  }
+
+  g_seek.startKhz = snapToSeekSpacing(state.radio.frequencyKhz, minKhz, maxKhz, spacingKhz, direction, gridOriginKhz);
+  g_seekProgressKhz.store(g_seek.startKhz, std::memory_order_release);
+  g_seekRunning.store(true, std::memory_order_release);
+  if (g_seek.startKhz != state.radio.frequencyKhz) {
+    g_rx.setFrequency(g_seek.startKhz);
+    g_seek.phase = SeekPhase::Tuned;
+    g_seek.nextPollMs = g_seek.startedMs + kSeekEdgeSettleMs / 2;
+  } else {
+    issueSeekStartLocked(g_seek.startedMs);
+  }
+  xSemaphoreGive(g_radio_mux);
+  return true;
+}
 
+}  // namespace
+
+bool startSeek(const app::AppState& state, int8_t direction) {
   const app::BandDef& band = app::kBandPlan[state.radio.bandIndex];
   const uint16_t bandMinKhz = app::bandMinKhzFor(band, state.global.fmRegion);
   const uint16_t bandMaxKhz = app::bandMaxKhzFor(band, state.global.fmRegion);
-  const uint8_t seekSpacingKhz = seekSpacingKhzFor(state);
-  const uint16_t seekGridOriginKhz = seekGridOriginKhzFor(state, bandMinKhz);
-  services::input::clearAbortRequest();
-  g_seekAborted = false;
-  g_seekAllowHoldAbort = allowHoldAbort;
+  return beginSeek(state,
+                   direction,
+                   true,
+                   true,
+                   bandMinKhz,
+                   bandMaxKhz,
+                   seekSpacingKhzFor(state),
+                   seekGridOriginKhzFor(state, bandMinKhz));
+}
 
-  const uint16_t snappedStartFrequency = snapToSeekSpacing(state.radio.frequencyKhz,
-                                                           bandMinKhz,
-                                                           bandMaxKhz,
-                                                           seekSpacingKhz,
-                                                           direction,
-                                                           seekGridOriginKhz);
-  if (snappedStartFrequency != state.radio.frequencyKhz) {
-    state.radio.frequencyKhz = snappedStartFrequency;
-    g_rx.setFrequency(state.radio.frequencyKhz);
-    delay(10);
+// Scan-driven seek inside one scan segment: limits and raster come from the caller, no edge retry,
+// and only explicit abort events (not a held button) stop it.
+bool startScanSeek(const app::AppState& state, int8_t direction, uint16_t minKhz, uint16_t maxKhz, uint8_t spacingKhz) {
+  if (minKhz > maxKhz || spacingKhz == 0) {
+    return false;
   }
+  return beginSeek(state, direction, false, false, minKhz, maxKhz, spacingKhz, minKhz);
+}
 
-  const uint16_t startFrequency = state.radio.frequencyKhz;
-
-  if (state.radio.modulation == app::Modulation::FM) {
-    g_rx.setSeekFmLimits(bandMinKhz, bandMaxKhz);
-    g_rx.setSeekFmSpacing(seekSpacingKhz);
-  } else {
-    g_rx.setSeekAmLimits(bandMinKhz, bandMaxKhz);
-    g_rx.setSeekAmSpacing(seekSpacingKhz);
-  }
-
-  g_rx.seekStationProgress(showSeekProgressCallback, stopSeekingCallback, direction >= 0 ? 1 : 0);
-  uint16_t nextFrequency = g_rx.getCurrentFrequency();
-  bool found =
-      !g_seekAborted && nextFrequency >= bandMinKhz && nextFrequency <= bandMaxKhz && nextFrequency != startFrequency;
-
-  if (retryOppositeEdge && !found && !g_seekAborted) {
-    const uint16_t restartFrequency = direction >= 0 ? bandMinKhz : bandMaxKhz;
-    if (restartFrequency != startFrequency) {
-      g_rx.setFrequency(restartFrequency);
-      delay(20);
-      services::input::clearAbortRequest();
-      g_rx.seekStationProgress(showSeekProgressCallback, stopSeekingCallback, direction >= 0 ? 1 : 0);
-      nextFrequency = g_rx.getCurrentFrequency();
-      found =
-          !g_seekAborted && nextFrequency >= bandMinKhz && nextFrequency <= bandMaxKhz && nextFrequency != startFrequency;
+bool pollSeek(bool* found, uint16_t* frequencyKhz) {
+  if (g_seek.phase == SeekPhase::Idle) {
+    return false;
+  }
+  if (g_seek.phase != SeekPhase::Done) {
+    // Abort requests are checked on every call; the tuner is only read once per poll period.
+    const bool abort = g_seek.cancelRequested || (g_seek.allowHoldAbort ? services::input::consumeAbortRequest()
+                                                                         : services::input::consumeAbortEventRequest());
+    const uint32_t nowMs = millis();
+    if (!abort && static_cast<int32_t>(nowMs - g_seek.nextPollMs) < 0) {
+      return false;
+    }
+    if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+      return false;
     }
+    stepSeekLocked(nowMs, abort);
+    xSemaphoreGive(g_radio_mux);
+    if (g_seek.phase != SeekPhase::Done) {
+      return false;
+    }
+  }
+  g_seek.phase = SeekPhase::Idle;
+  if (found != nullptr) {
+    *found = g_seek.found;
   }
+  if (frequencyKhz != nullptr) {
+    *frequencyKhz = g_seek.radio.frequencyKhz;
+  }
+  return true;
+}
 
-  uint16_t finalFrequency = nextFrequency;
-  if (!found && !g_seekAborted) {
-    finalFrequency = startFrequency;
-    if (finalFrequency != nextFrequency) {
-      g_rx.setFrequency(finalFrequency);
-      delay(10);
-    }
+void cancelSeek() {
+  if (g_seek.phase != SeekPhase::Idle) {
+    g_seek.cancelRequested = true;
   }
+}
 
-  state.radio.frequencyKhz = finalFrequency;
-  state.radio.ssbTuneOffsetHz = 0;
+bool lastSeekAborted() { return g_seek.aborted; }
 
+void holdTunerSpan(const app::AppState& state, uint16_t minKhz, uint16_t maxKhz) {
+  if (!g_ready || g_radio_mux == nullptr || app::isSsb(state.radio.modulation) || minKhz > maxKhz) {
+    return;
+  }
+  supersedePendingApply();
+  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+    return;
+  }
+  returnFromProbeLocked();
+  noteRetuneLocked();
+  configureModeAndBand(state, minKhz, maxKhz);
+  g_lastAppliedSsbCalHz = 0;
+  g_hasRuntimeSnapshot = false;
+  resetSquelchStateLocked(true);
+  invalidateRsqCacheLocked();
   g_lastApplied = state.radio;
   g_lastAppliedRegion = state.global.fmRegion;
   g_hasAppliedState = true;
+  g_appliedModulation.store(state.radio.modulation, std::memory_order_release);
+  g_appliedValid.store(true, std::memory_order_release);
+  g_spanHeld = true;
+  g_spanModulation = state.radio.modulation;
+  g_spanMinKhz = minKhz;
+  g_spanMaxKhz = maxKhz;
+  xSemaphoreGive(g_radio_mux);
+}
 
+void releaseTunerSpan() {
+  if (g_radio_mux == nullptr || xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+    return;
+  }
+  // The tuner still has the span's limits: make the next apply configure the band properly.
+  if (g_spanHeld) {
+    g_spanHeld = false;
+    g_hasAppliedState = false;
+    g_appliedValid.store(false, std::memory_order_release);
+  }
   xSemaphoreGive(g_radio_mux);
-  return found;
 }
 
-bool seek(app::AppState& state, int8_t direction) { return seekImpl(state, direction, true, true); }
+namespace {
 
-bool seekForScan(app::AppState& state, int8_t direction) { return seekImpl(state, direction, false, false); }
+// Time left in the settle window if this apply would only move the frequency, otherwise 0.
+uint32_t tuneDeferralMs(const app::AppState& state, uint32_t nowMs) {
+  if (g_tuneSettleWindowMs == 0 || !g_hasAppliedState || state.radio.frequencyKhz == g_lastApplied.frequencyKhz ||
+      state.radio.bandIndex != g_lastApplied.bandIndex || state.radio.modulation != g_lastApplied.modulation ||
+      state.global.fmRegion != g_lastAppliedRegion) {
+    return 0;
+  }
+  const uint32_t sinceTuneMs = nowMs - g_lastTuneMs;
+  return sinceTuneMs < g_tuneSettleWindowMs ? g_tuneSettleWindowMs - sinceTuneMs : 0;
+}
 
-bool lastSeekAborted() { return g_seekAborted; }
+void executeApply() {
+  if (xSemaphoreTake(g_pendingMux, portMAX_DELAY) != pdTRUE) {
+    return;
+  }
+  std::atomic<bool>& queued = g_commandQueued[static_cast<uint8_t>(CommandType::Apply)];
+  // Cleared by a synchronous apply() in the meantime: nothing left to do.
+  if (!queued.load(std::memory_order_acquire)) {
+    g_applyDeferred = false;
+    xSemaphoreGive(g_pendingMux);
+    return;
+  }
+  const uint32_t nowMs = millis();
+  const uint32_t waitMs = tuneDeferralMs(g_pendingApplyState, nowMs);
+  if (waitMs > 0) {
+    if (!g_applyDeferred) {
+      g_statDeferredTunes.fetch_add(1, std::memory_order_relaxed);
+    }
+    g_applyDeferred = true;
+    g_applyDueMs = nowMs + waitMs;
+    xSemaphoreGive(g_pendingMux);
+    return;
+  }
+  g_applyDeferred = false;
+  queued.store(false, std::memory_order_release);
+  g_workApplyState = g_pendingApplyState;
+  xSemaphoreGive(g_pendingMux);
 
-void applyVolumeOnly(uint8_t volume) {
-  if (!g_ready || g_radio_mux == nullptr) {
+  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
     return;
   }
+  applyLocked(g_workApplyState);
+  applyRuntimeSettingsLocked(g_workApplyState);
+  xSemaphoreGive(g_radio_mux);
+}
+
+void executeCommand(const Command& command) {
+  const uint32_t queuedMs = millis() - command.postedMs;
+  uint32_t maxQueuedMs = g_statMaxQueueMs.load(std::memory_order_relaxed);
+  while (queuedMs > maxQueuedMs && !g_statMaxQueueMs.compare_exchange_weak(maxQueuedMs, queuedMs)) {
+  }
+  g_statExecuted.fetch_add(1, std::memory_order_relaxed);
+
+  // Flags are cleared before the payload is read, so a post racing this command queues a fresh one.
+  std::atomic<bool>& queued = g_commandQueued[static_cast<uint8_t>(command.type)];
+  switch (command.type) {
+    case CommandType::Apply:
+      executeApply();
+      return;
+    default:
+      break;
+  }
+
+  queued.store(false, std::memory_order_release);
   if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
     return;
   }
-  g_rx.setVolume(volume);
+  switch (command.type) {
+    case CommandType::Volume:
+      g_rx.setVolume(g_pendingVolume.load(std::memory_order_acquire));
+      break;
+    case CommandType::Mute:
+      applyMuteState();
+      break;
+    case CommandType::ResetRds:
+      if (g_rdsConfiguredForFm && g_rdsFlushTuneSeq == g_tuneSeq) {
+        g_statRdsResetsSkipped.fetch_add(1, std::memory_order_relaxed);
+      } else if (g_hasAppliedState && g_lastApplied.modulation == app::Modulation::FM) {
+        configureRdsForFm(true);
+      }
+      break;
+    default:
+      break;
+  }
   xSemaphoreGive(g_radio_mux);
 }
 
-void setAieMuted(bool muted) {
-  g_aie_muted = muted;
+void postCommand(CommandType type) {
+  g_statPosted.fetch_add(1, std::memory_order_relaxed);
+  if (g_commandQueued[static_cast<uint8_t>(type)].exchange(true)) {
+    g_statCoalesced.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  const Command command{type, millis()};
+  // The queue holds one slot per command type, so a send only fails when it was never created.
+  if (g_commandQueue == nullptr || xQueueSend(g_commandQueue, &command, 0) != pdTRUE) {
+    executeCommand(command);
+  }
+}
+
+void drainCommands() {
+  Command command{};
+  while (xQueueReceive(g_commandQueue, &command, 0) == pdTRUE) {
+    executeCommand(command);
+  }
+}
+
+// Issues a held tune once its settle window has closed.
+void runDeferredApply(uint32_t nowMs) {
+  if (g_applyDeferred && static_cast<int32_t>(nowMs - g_applyDueMs) >= 0) {
+    executeApply();
+  }
+}
+
+// Commands first; RSQ sampling and held tunes fill the gaps between them at their own deadlines.
+void workerTask(void*) {
+  uint32_t nextSampleMs = millis();
+  for (;;) {
+    uint32_t wakeMs = nextSampleMs;
+    if (g_applyDeferred && static_cast<int32_t>(g_applyDueMs - wakeMs) < 0) {
+      wakeMs = g_applyDueMs;
+    }
+    const int32_t untilWakeMs = static_cast<int32_t>(wakeMs - millis());
+    Command command{};
+    if (untilWakeMs > 0 &&
+        xQueueReceive(g_commandQueue, &command, pdMS_TO_TICKS(static_cast<uint32_t>(untilWakeMs))) == pdTRUE) {
+      executeCommand(command);
+      continue;
+    }
+    const uint32_t nowMs = millis();
+    runDeferredApply(nowMs);
+    if (static_cast<int32_t>(nowMs - nextSampleMs) >= 0) {
+      nextSampleMs = nowMs + samplerStep(nowMs);
+    }
+  }
+}
+
+}  // namespace
+
+void requestApply(const app::AppState& state) {
+  if (!g_ready || g_radio_mux == nullptr || g_pendingMux == nullptr) {
+    return;
+  }
+  if (xSemaphoreTake(g_pendingMux, portMAX_DELAY) != pdTRUE) {
+    return;
+  }
+  g_pendingApplyState = state;
+  xSemaphoreGive(g_pendingMux);
+  postCommand(CommandType::Apply);
+}
+
+uint16_t seekProgressKhz() { return g_seekProgressKhz.load(std::memory_order_acquire); }
+
+void workerStats(WorkerStats* stats) {
+  if (stats == nullptr) {
+    return;
+  }
+  stats->posted = g_statPosted.load(std::memory_order_relaxed);
+  stats->coalesced = g_statCoalesced.load(std::memory_order_relaxed);
+  stats->executed = g_statExecuted.load(std::memory_order_relaxed);
+  stats->superseded = g_statSuperseded.load(std::memory_order_relaxed);
+  stats->maxQueueMs = g_statMaxQueueMs.load(std::memory_order_relaxed);
+  stats->tunes = g_statTunes.load(std::memory_order_relaxed);
+  stats->deferredTunes = g_statDeferredTunes.load(std::memory_order_relaxed);
+  stats->rdsResets = g_statRdsResets.load(std::memory_order_relaxed);
+  stats->rdsResetsSkipped = g_statRdsResetsSkipped.load(std::memory_order_relaxed);
+  stats->bandConfigs = g_statBandConfigs.load(std::memory_order_relaxed);
+}
+
+void resetWorkerStats() {
+  g_statPosted.store(0, std::memory_order_relaxed);
+  g_statCoalesced.store(0, std::memory_order_relaxed);
+  g_statExecuted.store(0, std::memory_order_relaxed);
+  g_statSuperseded.store(0, std::memory_order_relaxed);
+  g_statMaxQueueMs.store(0, std::memory_order_relaxed);
+  g_statTunes.store(0, std::memory_order_relaxed);
+  g_statDeferredTunes.store(0, std::memory_order_relaxed);
+  g_statRdsResets.store(0, std::memory_order_relaxed);
+  g_statRdsResetsSkipped.store(0, std::memory_order_relaxed);
+  g_statBandConfigs.store(0, std::memory_order_relaxed);
+}
+
+void setTuneSettleWindowMs(uint16_t windowMs) { g_tuneSettleWindowMs = windowMs; }
+
+void applyVolumeOnly(uint8_t volume) {
   if (!g_ready || g_radio_mux == nullptr) {
     return;
   }
-  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+  g_pendingVolume.store(volume, std::memory_order_release);
+  postCommand(CommandType::Volume);
+}
+
+void setAieMuted(bool muted) {
+  g_aie_muted = muted;
+  if (!g_ready || g_radio_mux == nullptr) {
     return;
   }
-  applyMuteState();
-  xSemaphoreGive(g_radio_mux);
+  postCommand(CommandType::Mute);
 }
 
 void setMuted(bool muted) {
@@ -932,14 +1513,40 @@ void setMuted(bool muted) {
   if (!g_ready || g_radio_mux == nullptr) {
     return;
   }
-  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
-    return;
-  }
-  applyMuteState();
-  xSemaphoreGive(g_radio_mux);
+  postCommand(CommandType::Mute);
 }
 
 bool readSignalQuality(uint8_t* rssi, uint8_t* snr) {
+  if (!g_ready || g_radio_mux == nullptr) {
+    return false;
+  }
+  uint8_t currentRssi = 0;
+  uint8_t currentSnr = 0;
+  RsqSample sample{};
+  if (freshCurrentSample(sample, millis())) {
+    currentRssi = sample.rssi;
+    currentSnr = sample.snr;
+  } else {
+    if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+      return false;
+    }
+    const bool ok = readCurrentSignalQualityCachedLocked(currentRssi, currentSnr);
+    xSemaphoreGive(g_radio_mux);
+    if (!ok) {
+      return false;
+    }
+  }
+  if (rssi != nullptr) {
+    *rssi = currentRssi;
+  }
+  if (snr != nullptr) {
+    *snr = currentSnr;
+  }
+  return true;
+}
+
+// Bypasses the RSQ cache: used where consecutive reads must be independent samples (adaptive settle).
+bool readSignalQualityFresh(uint8_t* rssi, uint8_t* snr) {
   if (!g_ready || g_radio_mux == nullptr) {
     return false;
   }
@@ -948,7 +1555,10 @@ bool readSignalQuality(uint8_t* rssi, uint8_t* snr) {
   }
   uint8_t currentRssi = 0;
   uint8_t currentSnr = 0;
-  const bool ok = readCurrentSignalQualityCachedLocked(currentRssi, currentSnr);
+  const bool ok = readCurrentSignalQuality(currentRssi, currentSnr);
+  if (ok) {
+    updateRsqCacheLocked(currentRssi, currentSnr);
+  }
   xSemaphoreGive(g_radio_mux);
   if (!ok) {
     return false;
@@ -962,6 +1572,103 @@ bool readSignalQuality(uint8_t* rssi, uint8_t* snr) {
   return true;
 }
 
+// The caller is responsible for keeping audio muted from startProbe() until pollProbe() returns true.
+bool startProbe(uint16_t frequencyKhz, uint16_t settleMs) {
+  if (!g_ready || g_radio_mux == nullptr || !g_appliedValid.load(std::memory_order_acquire) ||
+      app::isSsb(g_appliedModulation.load(std::memory_order_acquire)) || g_seek.phase != SeekPhase::Idle ||
+      g_commandQueued[static_cast<uint8_t>(CommandType::Apply)].load(std::memory_order_acquire)) {
+    return false;
+  }
+  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+    return false;
+  }
+  if (g_probe.phase != ProbePhase::Idle) {
+    xSemaphoreGive(g_radio_mux);
+    return false;
+  }
+  g_probe = ProbeRun{};
+  g_probe.homeKhz = g_lastApplied.frequencyKhz;
+  if (frequencyKhz == g_probe.homeKhz) {
+    g_probe.measured = readCurrentSignalQualityCachedLocked(g_probe.rssi, g_probe.snr);
+    g_probe.phase = ProbePhase::Done;
+  } else {
+    g_rx.setFrequency(frequencyKhz);
+    ++g_tuneSeq;
+    invalidateRsqCacheLocked();
+    g_probe.readAtMs = millis() + settleMs;
+    g_probe.phase = ProbePhase::Away;
+    g_probeAway.store(true, std::memory_order_release);
+  }
+  xSemaphoreGive(g_radio_mux);
+  return true;
+}
+
+bool pollProbe(bool* measured, uint8_t* rssi, uint8_t* snr) {
+  if (g_radio_mux == nullptr ||
+      (g_probeAway.load(std::memory_order_acquire) && static_cast<int32_t>(millis() - g_probe.readAtMs) < 0)) {
+    return false;
+  }
+  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+    return false;
+  }
+  if (g_probe.phase == ProbePhase::Away) {
+    g_probe.measured = readCurrentSignalQuality(g_probe.rssi, g_probe.snr);
+    returnFromProbeLocked();
+  }
+  const ProbeRun result = g_probe;
+  if (result.phase == ProbePhase::Done) {
+    g_probe.phase = ProbePhase::Idle;
+  }
+  xSemaphoreGive(g_radio_mux);
+  if (result.phase != ProbePhase::Done) {
+    return false;
+  }
+  if (measured != nullptr) {
+    *measured = result.measured;
+  }
+  if (rssi != nullptr) {
+    *rssi = result.rssi;
+  }
+  if (snr != nullptr) {
+    *snr = result.snr;
+  }
+  return true;
+}
+
+void cancelProbe() {
+  if (g_radio_mux == nullptr || xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+    return;
+  }
+  returnFromProbeLocked();
+  g_probe.phase = ProbePhase::Idle;
+  xSemaphoreGive(g_radio_mux);
+}
+
+bool audioMuted() { return g_muted || g_squelchMuted; }
+
+bool squelchClosed() { return g_squelchMuted; }
+
+bool latestSignalSample(RsqSample* sample) {
+  RsqSample current{};
+  if (!latestCurrentSample(current)) {
+    return false;
+  }
+  if (sample != nullptr) {
+    *sample = current;
+  }
+  return true;
+}
+
+uint8_t signalHistory(RsqSample* samples, uint8_t maxSamples, uint32_t windowMs) {
+  if (samples == nullptr || maxSamples == 0) {
+    return 0;
+  }
+  return g_rsqRing.window(
+      samples, maxSamples, millis() - windowMs, g_rsqEpoch.load(std::memory_order_acquire));
+}
+
+void setSamplerPaused(bool paused) { g_samplerPaused.store(paused, std::memory_order_release); }
+
 bool readFullRsqFm(uint8_t* rssi, uint8_t* snr, int8_t* freqOff, bool* pilotPresent, uint8_t* multipath) {
   if (!g_ready || g_radio_mux == nullptr) {
     return false;
@@ -984,13 +1691,20 @@ bool readFullRsqFm(uint8_t* rssi, uint8_t* snr, int8_t* freqOff, bool* pilotPres
 }
 
 bool pollRdsGroup(RdsGroupSnapshot* snapshot) {
-  if (snapshot == nullptr || !g_ready || g_radio_mux == nullptr || !g_hasAppliedState || g_lastApplied.modulation != app::Modulation::FM) {
+  if (snapshot == nullptr || !g_ready || g_radio_mux == nullptr || !g_appliedValid.load(std::memory_order_acquire) ||
+      g_appliedModulation.load(std::memory_order_acquire) != app::Modulation::FM) {
     return false;
   }
-  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+  // The tuner has not reached the requested channel yet (or is away on a probe); its FIFO holds another station.
+  if (g_commandQueued[static_cast<uint8_t>(CommandType::Apply)].load(std::memory_order_acquire) ||
+      g_probeAway.load(std::memory_order_acquire)) {
     return false;
   }
-  si47x_rds_status raw{};
+  // Polled every RDS tick from the loop: skip a beat rather than wait behind a worker command.
+  if (xSemaphoreTake(g_radio_mux, 0) != pdTRUE) {
+    return false;
+  }
+  TunerDevice::RdsStatus raw{};
   g_rx.readRdsStatusRaw(raw, 0, 0, 0);
   xSemaphoreGive(g_radio_mux);
 
@@ -1027,14 +1741,10 @@ bool pollRdsGroup(RdsGroupSnapshot* snapshot) {
 }
 
 void resetRdsDecoder() {
-  if (!g_ready || g_radio_mux == nullptr || !g_hasAppliedState || g_lastApplied.modulation != app::Modulation::FM) {
-    return;
-  }
-  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+  if (!g_ready || g_radio_mux == nullptr) {
     return;
   }
-  configureRdsForFm(true);
-  xSemaphoreGive(g_radio_mux);
+  postCommand(CommandType::ResetRds);
 }
 
 void tick() {
@@ -1043,16 +1753,21 @@ void tick() {
   }
 
   const uint32_t nowMs = millis();
-  if (static_cast<uint32_t>(nowMs - g_lastSquelchPollMs) < kSquelchPollMs) {
-    return;
+  if (g_workerTask == nullptr) {
+    if (g_commandQueue != nullptr) {
+      drainCommands();
+    }
+    runDeferredApply(nowMs);
+  }
+  if (g_workerTask == nullptr && static_cast<int32_t>(nowMs - g_nextInlineSampleMs) >= 0) {
+    g_nextInlineSampleMs = nowMs + samplerStep(nowMs);
   }
-  g_lastSquelchPollMs = nowMs;
 
-  if (xSemaphoreTake(g_radio_mux, portMAX_DELAY) != pdTRUE) {
+  if (static_cast<uint32_t>(nowMs - g_lastSquelchPollMs) < kSquelchPollMs) {
     return;
   }
-  updateSquelchFromSignalLocked();
-  xSemaphoreGive(g_radio_mux);
+  g_lastSquelchPollMs = nowMs;
+  updateSquelchFromSignal(nowMs);
 }
 
 }  // namespace services::radio
@@ -0,0 +1,225 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include <string.h>
+
+#include "../../include/app_services.h"
+#include "../../include/le_bytes.h"
+#include "../../include/psram_array.h"
+
+namespace services::rdscache {
+namespace {
+
+// /rds/names.bin, little-endian, most recently heard first:
+//   u32 magic | u8 version | u8 0 | u16 count | u32 checksum
+//   count x { u16 pi | u16 frequencyKhz | u8 pty | u8 flags | char ps[8] }
+// The checksum (FNV-1a) covers the records. The file is rewritten whole, temp-and-rename like the ETM cache,
+// once the list has been unchanged for kFlushIdleMs, so a scroll through the band costs one write.
+constexpr uint32_t kMagic = 0x4E534452;  // RDSN
+constexpr uint8_t kVersion = 1;
+constexpr size_t kHeaderSize = 12;
+constexpr size_t kRecordSize = 14;
+constexpr uint8_t kFlagDynamicPs = 0x01;
+constexpr uint16_t kMaxNames = 256;
+constexpr uint16_t kMaxNamesInternal = 64;
+constexpr uint32_t kFlushIdleMs = 10000;
+constexpr char kDir[] = "/rds";
+constexpr char kPath[] = "/rds/names.bin";
+constexpr char kTmpPath[] = "/rds/names.bin.tmp";
+
+bool g_ready = false;
+app::PsramArray<StationName> g_names(kMaxNames, kMaxNamesInternal);
+bool g_dirty = false;
+uint32_t g_changedAtMs = 0;
+uint32_t g_writes = 0;
+
+void encode(uint8_t* rec, const StationName& name) {
+  put16(rec, name.pi);
+  put16(rec + 2, name.frequencyKhz);
+  rec[4] = name.pty;
+  rec[5] = name.dynamicPs ? kFlagDynamicPs : 0;
+  memset(rec + 6, ' ', 8);
+  memcpy(rec + 6, name.ps, strnlen(name.ps, 8));
+}
+
+StationName decode(const uint8_t* rec) {
+  StationName name{};
+  name.pi = get16(rec);
+  name.frequencyKhz = get16(rec + 2);
+  name.pty = static_cast<uint8_t>(rec[4] & 0x1F);
+  name.dynamicPs = (rec[5] & kFlagDynamicPs) ? 1 : 0;
+  uint8_t len = 8;
+  while (len > 0 && rec[6 + len - 1] == ' ') --len;
+  for (uint8_t i = 0; i < len; ++i) {
+    name.ps[i] = (rec[6 + i] >= 32 && rec[6 + i] <= 126) ? static_cast<char>(rec[6 + i]) : ' ';
+  }
+  name.ps[len] = '\0';
+  return name;
+}
+
+int16_t find(uint16_t pi) {
+  for (uint16_t i = 0; i < g_names.size(); ++i) {
+    if (g_names[i].pi == pi) return static_cast<int16_t>(i);
+  }
+  return -1;
+}
+
+void load() {
+  g_names.clear();
+  g_dirty = false;
+  if (!LittleFS.exists(kPath)) {
+    return;
+  }
+  File file = LittleFS.open(kPath, "r");
+  if (!file) {
+    return;
+  }
+  uint8_t header[kHeaderSize];
+  const size_t size = file.size();
+  const bool headerRead = file.read(header, kHeaderSize) == kHeaderSize;
+  const uint16_t count = headerRead ? get16(header + 6) : 0;
+  if (!headerRead || get32(header) != kMagic || header[4] != kVersion || count > kMaxNames ||
+      size != kHeaderSize + static_cast<size_t>(count) * kRecordSize) {
+    file.close();
+    Serial.printf("[rdscache] %s: bad header, ignored\n", kPath);
+    return;
+  }
+
+  // Entries past what this board can hold are the least recently heard; dropping them is fine.
+  uint32_t checksum = kChecksumSeed;
+  for (uint16_t i = 0; i < count; ++i) {
+    uint8_t rec[kRecordSize];
+    if (file.read(rec, kRecordSize) != kRecordSize) break;
+    checksum = checksumForBytes(rec, kRecordSize, checksum);
+    const StationName name = decode(rec);
+    if (name.pi != 0 && find(name.pi) < 0) g_names.push_back(name);
+  }
+  file.close();
+  if (checksum != get32(header + 8)) {
+    g_names.clear();
+    Serial.printf("[rdscache] %s: checksum mismatch, ignored\n", kPath);
+  }
+}
+
+bool store() {
+  uint8_t header[kHeaderSize];
+  uint32_t checksum = kChecksumSeed;
+  for (uint16_t i = 0; i < g_names.size(); ++i) {
+    uint8_t rec[kRecordSize];
+    encode(rec, g_names[i]);
+    checksum = checksumForBytes(rec, kRecordSize, checksum);
+  }
+  put32(header, kMagic);
+  header[4] = kVersion;
+  header[5] = 0;
+  put16(header + 6, g_names.size());
+  put32(header + 8, checksum);
+
+  File file = LittleFS.open(kTmpPath, "w");
+  if (!file) {
+    return false;
+  }
+  bool written = file.write(header, kHeaderSize) == kHeaderSize;
+  for (uint16_t i = 0; written && i < g_names.size(); ++i) {
+    uint8_t rec[kRecordSize];
+    encode(rec, g_names[i]);
+    written = file.write(rec, kRecordSize) == kRecordSize;
+  }
+  file.close();
+  if (!written || !LittleFS.rename(kTmpPath, kPath)) {
+    LittleFS.remove(kTmpPath);
+    Serial.printf("[rdscache] %s: write failed\n", kPath);
+    return false;
+  }
+  ++g_writes;
+  return true;
+}
+
+}  // namespace
+
+bool begin() {
+  if (!services::etmcache::begin()) {
+    return false;
+  }
+  if (!LittleFS.exists(kDir) && !LittleFS.mkdir(kDir)) {
+    Serial.println("[rdscache] mkdir failed");
+    return false;
+  }
+  g_ready = true;
+  load();
+  return true;
+}
+
+bool lookup(uint16_t pi, StationName* out) {
+  const int16_t index = pi != 0 ? find(pi) : -1;
+  if (index < 0) {
+    return false;
+  }
+  if (out != nullptr) {
+    *out = g_names[static_cast<uint16_t>(index)];
+  }
+  return true;
+}
+
+void remember(const StationName& name) {
+  if (name.pi == 0 || name.ps[0] == '\0') {
+    return;
+  }
+  int16_t index = find(name.pi);
+  if (index < 0) {
+    if (g_names.full()) {
+      g_names.erase(static_cast<uint16_t>(g_names.size() - 1));
+    }
+    if (!g_names.insert(0, name)) {
+      return;
+    }
+    g_dirty = true;
+    g_changedAtMs = millis();
+    return;
+  }
+
+  // Most recently heard first, so a full cache forgets the stations not heard for longest.
+  g_names.move(static_cast<uint16_t>(index), 0);
+  StationName& entry = g_names[0];
+  // A dynamic PS is never shown from the cache: once flagged, the stored PS stays as it is, so rotating text
+  // costs no flash writes and only the PI, frequency, PTY and the flag are compared.
+  const bool psChanged = !name.dynamicPs && strcmp(entry.ps, name.ps) != 0;
+  if (entry.frequencyKhz == name.frequencyKhz && entry.pty == name.pty && entry.dynamicPs == name.dynamicPs &&
+      !psChanged) {
+    return;
+  }
+  entry.frequencyKhz = name.frequencyKhz;
+  entry.pty = name.pty;
+  entry.dynamicPs = name.dynamicPs;
+  if (psChanged) {
+    app::copyText(entry.ps, name.ps);
+  }
+  g_dirty = true;
+  g_changedAtMs = millis();
+}
+
+void tick() {
+  if (!g_ready || !g_dirty || millis() - g_changedAtMs < kFlushIdleMs) {
+    return;
+  }
+  // A failed write is retried after the next idle period rather than every loop pass.
+  g_dirty = false;
+  if (!store()) {
+    g_dirty = true;
+    g_changedAtMs = millis();
+  }
+}
+
+void clear() {
+  g_names.clear();
+  g_dirty = false;
+  if (g_ready && LittleFS.exists(kPath)) {
+    LittleFS.remove(kPath);
+  }
+}
+
+uint16_t size() { return g_names.size(); }
+
+uint32_t flashWrites() { return g_writes; }
+
+}  // namespace services::rdscache
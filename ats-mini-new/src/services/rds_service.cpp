@@ -1,5 +1,4 @@
 #include <Arduino.h>
-#include <SI4735.h>
 
 #include <string.h>
 
@@ -8,8 +7,14 @@
 namespace services::rds {
 namespace {
 
-constexpr uint32_t kRdsTickMs = 220;
-constexpr uint8_t kMaxGroupsPerTick = 4;  // signal-scale: RDS_CHECK_GROUPS_PER_TICK
+// FIFO poll cadence. Groups arrive at ~11.4/s and the tuner FIFO holds 25 of them; every poll drains it by
+// its fill level (up to kRdsDrainMaxGroups), so the cadence only sets latency, not how much is decoded.
+constexpr uint32_t kRdsTickMs = 220;          // steady reception; also the quality decay step without groups
+constexpr uint32_t kRdsAcquireTickMs = 40;    // after a retune / new sync while PS or RT is still incomplete
+constexpr uint32_t kRdsAcquireWindowMs = 5000;
+constexpr uint32_t kRdsIdleTickMs = 880;      // PS and RT committed, or squelch closed: ~10 groups per poll
+constexpr uint8_t kRdsDrainMaxGroups = 16;
+constexpr uint32_t kRdsStatsWindowMs = 5000;
 constexpr uint32_t kRdsUiCommitMinMs = 500;
 constexpr uint8_t kRdsQualityMinBuffer = 30;
 constexpr uint8_t kRdsQualityMinCommit = 45;
@@ -23,13 +28,26 @@ constexpr uint8_t kRdsPsChangeThreshold = 4;
 constexpr uint32_t kRdsPsFreshWindowMs = 4000;
 constexpr uint8_t kRdsRtSegments2A = 16;
 constexpr uint8_t kRdsRtSegments2B = 16;
+constexpr uint8_t kRdsRtChars2A = 64;
+constexpr uint8_t kRdsRtChars2B = 32;
 constexpr uint32_t kRdsRtAbDebounceWindowMs = 10000;
 constexpr uint8_t kRdsRtAbDebounceToggles = 2;
-constexpr uint8_t kRdsRtPartialCommitSegments = 12;
+// RT character votes: a clean block counts 2, a corrected one (BLE 1-2) 1, and the other candidate of the
+// position loses 1. A character is confident at kRdsRtCharConfident with a kRdsRtCharMargin lead; the cap
+// lets a changed text without an A/B toggle take over after three clean receptions.
+constexpr uint8_t kRdsRtCharScoreMax = 6;
+constexpr uint8_t kRdsRtCharConfident = 2;
+constexpr uint8_t kRdsRtCharMargin = 2;
 constexpr uint32_t kRdsHoldMs = 10000;
 constexpr uint32_t kRdsStaleClearMs = 30000;
 constexpr uint32_t kCtStaleMs = 90000;
 constexpr uint8_t kCtRepeatVotes = 2;
+constexpr uint8_t kGroupRoutes = 32;  // 16 group types x version A/B
+constexpr uint8_t kAfCodeFiller = 205;
+constexpr uint8_t kAfCodeCountBase = 224;
+constexpr uint8_t kAfCodeCountMax = 249;
+constexpr uint8_t kAfCodeLfMf = 250;
+constexpr uint16_t kRtPlusAid = 0x4BD7;
 
 struct PiVoteState {
   uint16_t window[kRdsPiVoteWindow];
@@ -58,11 +76,15 @@ struct PsState {
   PsSegmentState seg[kRdsPsSegments];
 };
 
+// Two candidates per RT character position with their vote scores (score 0 = free slot).
+struct RtCharVote {
+  char value[2];
+  uint8_t score[2];
+};
+
 struct RtState {
-  char buf2A[64];
-  uint16_t mask2A;
-  char buf2B[32];
-  uint16_t mask2B;
+  RtCharVote chars[kRdsRtChars2A];  // 2B texts use the first kRdsRtChars2B
+  bool versionB;                    // layout the votes belong to
   bool hasAb;
   uint8_t abFlag;
   uint32_t lastAbToggleMs;
@@ -72,6 +94,57 @@ struct RtState {
   uint32_t committedAtMs;
 };
 
+// Per-group work for the dispatcher; kRoutes is indexed by groupType * 2 + versionB.
+using GroupHandler = void (*)(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint32_t nowMs);
+
+struct GroupRoute {
+  GroupHandler handler;
+  bool needsQuality;  // payload groups wait for kRdsQualityMinBuffer; CT and RT are voted on their own
+};
+
+enum class AfMethod : uint8_t {
+  Unknown = 0,
+  A = 1,
+  B = 2,
+};
+
+// AF list assembly across 0A groups: the last count header seen and the method its first pair revealed.
+struct AfAssembly {
+  AfMethod method;
+  uint8_t headCode;   // frequency code sent with the count (method B: the list's own transmitter)
+  uint8_t announced;  // count from the header
+  bool headPending;   // header seen, method not yet known
+  bool accepting;     // method B: the current list belongs to the tuned transmitter
+  bool skipNext;      // a 250 code announced an LF/MF frequency
+};
+
+struct RtPlusState {
+  uint8_t route;  // route index claimed by the RT+ ODA, 0 = not announced (0A is never claimable)
+  bool hasToggle;
+  uint8_t itemToggle;
+};
+
+// Station name cache use for the tuned channel.
+struct NameState {
+  bool checked;           // cache consulted (a PI lock, or a clean block A matching the cached frequency)
+  uint16_t cachedPi;      // PI the provisional PS belongs to, 0 = none shown
+  uint16_t rememberedPi;  // PI whose live PS was written to the cache this session, 0 = none yet
+  char rememberedPs[app::kRdsPsCapacity];
+  bool hasPty;
+  uint8_t pty;            // last PTY from block B, kept in every RDS mode for the cache
+};
+
+// Poller cadence and the counters behind RdsStats.
+struct PollState {
+  uint32_t acquireUntilMs;  // fast polling allowed until then (0 = not acquiring)
+  bool synced;
+  uint32_t lastGroupMs;     // last group read, or last quality decay step
+  uint32_t windowStartMs;
+  uint16_t windowGroups;
+  uint16_t windowLost;
+  RdsStats stats;
+};
+
 struct DecoderRuntime {
   bool initialized;
   uint8_t lastBandIndex;
@@ -84,6 +157,10 @@ struct DecoderRuntime {
   QualityState quality;
   PsState ps;
   RtState rt;
+  AfAssembly af;
+  RtPlusState rtPlus;
+  NameState names;
+  PollState poll;
 
   bool ctCandidateValid;
   uint16_t ctCandidateMjd;
@@ -102,21 +179,20 @@ inline bool modeAllowsPi(app::RdsMode mode) { return mode == app::RdsMode::FullN
 inline bool modeAllowsPty(app::RdsMode mode) { return mode == app::RdsMode::FullNoCt || mode == app::RdsMode::All; }
 inline bool modeAllowsRt(app::RdsMode mode) { return mode == app::RdsMode::FullNoCt || mode == app::RdsMode::All; }
 inline bool modeAllowsCtApply(app::RdsMode mode) { return mode == app::RdsMode::All; }
+inline bool modeAllowsNetwork(app::RdsMode mode) { return mode == app::RdsMode::FullNoCt || mode == app::RdsMode::All; }
 
 inline bool isGoodBle(uint8_t ble) { return ble <= 1; }
 
-void resetRtAssembly() {
-  memset(g_rt.rt.buf2A, ' ', sizeof(g_rt.rt.buf2A));
-  memset(g_rt.rt.buf2B, ' ', sizeof(g_rt.rt.buf2B));
-  g_rt.rt.mask2A = 0;
-  g_rt.rt.mask2B = 0;
-}
+void resetRtAssembly() { memset(g_rt.rt.chars, 0, sizeof(g_rt.rt.chars)); }
 
 void resetDecoderRuntime() {
   memset(&g_rt.piVote, 0, sizeof(g_rt.piVote));
   memset(&g_rt.quality, 0, sizeof(g_rt.quality));
   memset(&g_rt.ps, 0, sizeof(g_rt.ps));
   memset(&g_rt.rt, 0, sizeof(g_rt.rt));
+  memset(&g_rt.af, 0, sizeof(g_rt.af));
+  memset(&g_rt.rtPlus, 0, sizeof(g_rt.rtPlus));
+  memset(&g_rt.names, 0, sizeof(g_rt.names));
   resetRtAssembly();
   g_rt.ctCandidateValid = false;
   g_rt.ctCandidateMjd = 0;
@@ -125,6 +201,49 @@ void resetDecoderRuntime() {
   g_rt.ctCandidateRepeats = 0;
 }
 
+bool acquireComplete(const app::AppState& state) {
+  const bool psDone = state.rds.hasPs && !state.rds.psCached;
+  const bool rtDone = !modeAllowsRt(state.global.rdsMode) || state.rds.hasRt;
+  return psDone && rtDone;
+}
+
+bool acquireWindowOpen(uint32_t nowMs) {
+  return g_rt.poll.acquireUntilMs != 0 && static_cast<int32_t>(g_rt.poll.acquireUntilMs - nowMs) > 0;
+}
+
+// Fast while a new station is being acquired, slow once there is nothing left to complete.
+uint32_t pollIntervalMs(const app::AppState& state, uint32_t nowMs) {
+  if (services::radio::squelchClosed() || acquireComplete(state)) {
+    return kRdsIdleTickMs;
+  }
+  // An ETM scan hops the tuner faster than any station could be acquired; stay out of its way, except in
+  // its identify pass, which dwells to be acquired.
+  if (acquireWindowOpen(nowMs) && (!services::etm::busy() || services::etm::identifying())) {
+    return kRdsAcquireTickMs;
+  }
+  return kRdsTickMs;
+}
+
+void countGroups(uint8_t groups, uint8_t lost, uint8_t fifoPeak, uint32_t nowMs) {
+  RdsStats& st = g_rt.poll.stats;
+  st.groups += groups;
+  st.lost += lost;
+  ++st.polls;
+  if (fifoPeak > st.maxFifo) {
+    st.maxFifo = fifoPeak;
+  }
+  g_rt.poll.windowGroups = static_cast<uint16_t>(g_rt.poll.windowGroups + groups);
+  g_rt.poll.windowLost = static_cast<uint16_t>(g_rt.poll.windowLost + lost);
+  const uint32_t elapsedMs = nowMs - g_rt.poll.windowStartMs;
+  if (elapsedMs >= kRdsStatsWindowMs) {
+    st.groupsPerSecX10 = static_cast<uint16_t>(g_rt.poll.windowGroups * 10000UL / elapsedMs);
+    st.lostPerSecX10 = static_cast<uint16_t>(g_rt.poll.windowLost * 10000UL / elapsedMs);
+    g_rt.poll.windowStartMs = nowMs;
+    g_rt.poll.windowGroups = 0;
+    g_rt.poll.windowLost = 0;
+  }
+}
+
 void clearPi(app::RdsState& rds) {
   rds.pi = 0;
   rds.hasPi = 0;
@@ -138,6 +257,7 @@ void clearPty(app::RdsState& rds) {
 void clearPs(app::RdsState& rds) {
   rds.ps[0] = '\0';
   rds.hasPs = 0;
+  rds.psCached = 0;
 }
 
 void clearRt(app::RdsState& rds) {
@@ -145,6 +265,17 @@ void clearRt(app::RdsState& rds) {
   rds.hasRt = 0;
 }
 
+void clearRtPlus(app::RdsState& rds) {
+  memset(rds.rtPlus, 0, sizeof(rds.rtPlus));
+  rds.hasRtPlus = 0;
+  rds.rtPlusRunning = 0;
+}
+
+void clearEon(app::RdsState& rds) {
+  memset(rds.eon, 0, sizeof(rds.eon));
+  rds.eonCount = 0;
+}
+
 void clearCt(app::AppState& state) {
   state.rds.hasCt = 0;
   state.rds.ctMjd = 0;
@@ -166,6 +297,10 @@ void applyModeVisibilityMask(app::AppState& state) {
   }
   if (!modeAllowsRt(mode)) {
     clearRt(state.rds);
+    clearRtPlus(state.rds);
+  }
+  if (!modeAllowsNetwork(mode)) {
+    clearEon(state.rds);
   }
   if (!modeAllowsCtApply(mode)) {
     services::clock::clearRdsUtcBase(state);
@@ -324,15 +459,79 @@ bool commitPsToState(app::AppState& state, const char* ps, uint32_t nowMs) {
   }
 
   if (state.rds.hasPs && strcmp(state.rds.ps, trimmed) == 0) {
-    return false;
+    if (!state.rds.psCached) {
+      return false;
+    }
+    // Live voting confirmed the cached name: same text, no longer provisional.
+    state.rds.psCached = 0;
+    state.rds.lastPsCommitMs = nowMs;
+    return true;
   }
 
   app::copyText(state.rds.ps, trimmed);
   state.rds.hasPs = 1;
+  state.rds.psCached = 0;
   state.rds.lastPsCommitMs = nowMs;
   return true;
 }
 
+// Provisional PS from the station name cache. An error-free block A is enough when the cache last heard that
+// PI on this very frequency; otherwise the PI vote has to lock first. Live voting later confirms or replaces
+// it through commitPsToState().
+void applyCachedName(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, bool piLocked,
+                     uint16_t votedPi, uint32_t nowMs) {
+  if (piLocked && state.rds.psCached && votedPi != g_rt.names.cachedPi) {
+    clearPs(state.rds);  // the first block A was not this station's after all
+    g_rt.names.cachedPi = 0;
+    g_rt.names.checked = false;
+  }
+  if (g_rt.names.checked || !modeAllowsPs(state.global.rdsMode)) {
+    return;
+  }
+
+  const bool quick = !piLocked && snap.bleA == 0 && snap.blockA != 0;
+  if (!piLocked && !quick) {
+    return;
+  }
+  const uint16_t pi = piLocked ? votedPi : snap.blockA;
+  services::rdscache::StationName name{};
+  const bool known = services::rdscache::lookup(pi, &name);
+  if (quick && (!known || name.frequencyKhz != state.radio.frequencyKhz)) {
+    return;  // wait for the lock before trusting an unfamiliar PI
+  }
+  g_rt.names.checked = true;
+  if (!known || name.dynamicPs || state.rds.hasPs) {
+    return;
+  }
+  app::copyText(state.rds.ps, name.ps);
+  state.rds.hasPs = 1;
+  state.rds.psCached = 1;
+  state.rds.lastPsCommitMs = nowMs;
+  g_rt.names.cachedPi = pi;
+}
+
+// Writes the confirmed name of the locked PI to the cache. A second, different PS in the same session marks
+// the station as sending dynamic PS, which is then never shown from the cache.
+void rememberName(const app::AppState& state, uint16_t pi) {
+  if (!state.rds.hasPs || state.rds.psCached ||
+      (g_rt.names.rememberedPi == pi && strcmp(g_rt.names.rememberedPs, state.rds.ps) == 0)) {
+    return;
+  }
+  services::rdscache::StationName known{};
+  const bool haveKnown = services::rdscache::lookup(pi, &known);
+
+  services::rdscache::StationName name{};
+  name.pi = pi;
+  name.frequencyKhz = state.radio.frequencyKhz;
+  name.pty = g_rt.names.hasPty ? g_rt.names.pty : known.pty;
+  name.dynamicPs = ((haveKnown && known.dynamicPs) || g_rt.names.rememberedPi == pi) ? 1 : 0;
+  app::copyText(name.ps, state.rds.ps);
+  services::rdscache::remember(name);
+
+  g_rt.names.rememberedPi = pi;
+  app::copyText(g_rt.names.rememberedPs, state.rds.ps);
+}
+
 bool commitRtToState(app::AppState& state, const char* rt, uint32_t nowMs) {
   if (!modeAllowsRt(state.global.rdsMode)) {
     return false;
@@ -448,13 +647,42 @@ void processPsGroup(const services::radio::RdsGroupSnapshot& snap, uint32_t nowM
   addPsSegmentVote(psAddress, c0, c1, nowMs);
 }
 
-uint8_t bitCount16(uint16_t value) {
-  uint8_t count = 0;
-  while (value) {
-    count = static_cast<uint8_t>(count + (value & 1U));
-    value >>= 1;
+uint8_t rtVoteWeight(uint8_t ble) {
+  if (ble == 0) {
+    return 2;
   }
-  return count;
+  return ble <= 2 ? 1 : 0;
+}
+
+void addRtCharVote(uint8_t position, uint8_t value, uint8_t weight) {
+  RtCharVote& vote = g_rt.rt.chars[position];
+  const char c = sanitizeRtChar(value);
+  uint8_t slot = 0;
+  if (vote.score[0] > 0 && vote.value[0] == c) {
+    slot = 0;
+  } else if (vote.score[1] > 0 && vote.value[1] == c) {
+    slot = 1;
+  } else {
+    // A new candidate takes the weaker slot.
+    slot = vote.score[0] <= vote.score[1] ? 0 : 1;
+    vote.value[slot] = c;
+    vote.score[slot] = 0;
+  }
+  const uint8_t score = static_cast<uint8_t>(vote.score[slot] + weight);
+  vote.score[slot] = score < kRdsRtCharScoreMax ? score : kRdsRtCharScoreMax;
+  uint8_t& other = vote.score[slot ^ 1];
+  if (other > 0) {
+    --other;
+  }
+}
+
+bool rtCharConfident(const RtCharVote& vote, char* out) {
+  const uint8_t best = vote.score[0] >= vote.score[1] ? 0 : 1;
+  if (vote.score[best] < kRdsRtCharConfident || vote.score[best] < vote.score[best ^ 1] + kRdsRtCharMargin) {
+    return false;
+  }
+  *out = vote.value[best];
+  return true;
 }
 
 bool commitRtCandidate(const char* source, uint8_t maxLen, uint32_t nowMs) {
@@ -520,43 +748,53 @@ bool processRtGroup(const services::radio::RdsGroupSnapshot& snap, uint32_t nowM
   }
 
   const uint8_t segment = snap.segmentAddress;
-  bool changed = false;
+  if (snap.versionB != g_rt.rt.versionB) {
+    g_rt.rt.versionB = snap.versionB;
+    resetRtAssembly();
+  }
 
+  // Each block votes on its own characters, so a group with one damaged block still counts.
   if (!snap.versionB) {
-    if (segment >= kRdsRtSegments2A || snap.bleC > 1 || snap.bleD > 1) {
+    if (segment >= kRdsRtSegments2A) {
       return false;
     }
-
     const uint8_t pos = static_cast<uint8_t>(segment * 4U);
-    g_rt.rt.buf2A[pos + 0] = sanitizeRtChar(static_cast<uint8_t>(snap.blockC >> 8));
-    g_rt.rt.buf2A[pos + 1] = sanitizeRtChar(static_cast<uint8_t>(snap.blockC & 0xFF));
-    g_rt.rt.buf2A[pos + 2] = sanitizeRtChar(static_cast<uint8_t>(snap.blockD >> 8));
-    g_rt.rt.buf2A[pos + 3] = sanitizeRtChar(static_cast<uint8_t>(snap.blockD & 0xFF));
-    g_rt.rt.mask2A |= static_cast<uint16_t>(1U << segment);
-
-    const bool hasEnd = memchr(g_rt.rt.buf2A, 0x0D, sizeof(g_rt.rt.buf2A)) != nullptr;
-    const uint8_t count = bitCount16(g_rt.rt.mask2A);
-    if (hasEnd || count == kRdsRtSegments2A || (!g_rt.rt.committedValid && count >= kRdsRtPartialCommitSegments)) {
-      changed |= commitRtCandidate(g_rt.rt.buf2A, sizeof(g_rt.rt.buf2A), nowMs);
+    const uint8_t weightC = rtVoteWeight(snap.bleC);
+    const uint8_t weightD = rtVoteWeight(snap.bleD);
+    if (weightC == 0 && weightD == 0) {
+      return false;
+    }
+    if (weightC != 0) {
+      addRtCharVote(pos + 0, static_cast<uint8_t>(snap.blockC >> 8), weightC);
+      addRtCharVote(pos + 1, static_cast<uint8_t>(snap.blockC & 0xFF), weightC);
+    }
+    if (weightD != 0) {
+      addRtCharVote(pos + 2, static_cast<uint8_t>(snap.blockD >> 8), weightD);
+      addRtCharVote(pos + 3, static_cast<uint8_t>(snap.blockD & 0xFF), weightD);
     }
   } else {
-    if (segment >= kRdsRtSegments2B || snap.bleD > 1) {
+    const uint8_t weightD = rtVoteWeight(snap.bleD);
+    if (segment >= kRdsRtSegments2B || weightD == 0) {
       return false;
     }
-
     const uint8_t pos = static_cast<uint8_t>(segment * 2U);
-    g_rt.rt.buf2B[pos + 0] = sanitizeRtChar(static_cast<uint8_t>(snap.blockD >> 8));
-    g_rt.rt.buf2B[pos + 1] = sanitizeRtChar(static_cast<uint8_t>(snap.blockD & 0xFF));
-    g_rt.rt.mask2B |= static_cast<uint16_t>(1U << segment);
+    addRtCharVote(pos + 0, static_cast<uint8_t>(snap.blockD >> 8), weightD);
+    addRtCharVote(pos + 1, static_cast<uint8_t>(snap.blockD & 0xFF), weightD);
+  }
 
-    const bool hasEnd = memchr(g_rt.rt.buf2B, 0x0D, sizeof(g_rt.rt.buf2B)) != nullptr;
-    const uint8_t count = bitCount16(g_rt.rt.mask2B);
-    if (hasEnd || count == kRdsRtSegments2B || (!g_rt.rt.committedValid && count >= kRdsRtPartialCommitSegments)) {
-      changed |= commitRtCandidate(g_rt.rt.buf2B, sizeof(g_rt.rt.buf2B), nowMs);
+  // Commit once every character up to the end marker (or the whole buffer) is confident.
+  const uint8_t length = snap.versionB ? kRdsRtChars2B : kRdsRtChars2A;
+  char text[kRdsRtChars2A];
+  uint8_t used = 0;
+  for (; used < length; ++used) {
+    if (!rtCharConfident(g_rt.rt.chars[used], &text[used])) {
+      return false;
+    }
+    if (text[used] == 0x0D) {
+      break;
     }
   }
-
-  return changed;
+  return commitRtCandidate(text, used, nowMs);
 }
 
 bool decodeCtUtc(const services::radio::RdsGroupSnapshot& snap, uint16_t& outMjd, uint8_t& outHour, uint8_t& outMinute) {
@@ -564,18 +802,11 @@ bool decodeCtUtc(const services::radio::RdsGroupSnapshot& snap, uint16_t& outMjd
     return false;
   }
 
-  si47x_rds_date_time dt{};
-  dt.raw[4] = static_cast<uint8_t>(snap.blockB & 0xFF);
-  dt.raw[5] = static_cast<uint8_t>(snap.blockB >> 8);
-  dt.raw[2] = static_cast<uint8_t>(snap.blockC & 0xFF);
-  dt.raw[3] = static_cast<uint8_t>(snap.blockC >> 8);
-  dt.raw[0] = static_cast<uint8_t>(snap.blockD & 0xFF);
-  dt.raw[1] = static_cast<uint8_t>(snap.blockD >> 8);
-
-  const uint32_t mjd = dt.refined.mjd;
-  const uint32_t hour = dt.refined.hour;
-  const uint32_t minute = dt.refined.minute;
-  const uint32_t offset = dt.refined.offset;
+  // 4A layout: MJD spans B[1:0]+C[15:1], hour C[0]+D[15:12], minute D[11:6], local offset D[4:0].
+  const uint32_t mjd = (static_cast<uint32_t>(snap.blockB & 0x03U) << 15) | (static_cast<uint32_t>(snap.blockC) >> 1);
+  const uint32_t hour = (static_cast<uint32_t>(snap.blockC & 0x01U) << 4) | (static_cast<uint32_t>(snap.blockD) >> 12);
+  const uint32_t minute = (static_cast<uint32_t>(snap.blockD) >> 6) & 0x3FU;
+  const uint32_t offset = static_cast<uint32_t>(snap.blockD) & 0x1FU;
 
   if (mjd == 0 || hour > 23 || minute > 59 || offset > 31) {
     return false;
@@ -637,6 +868,271 @@ void processCt(app::AppState& state, const services::radio::RdsGroupSnapshot& sn
   }
 }
 
+// --- AF lists (group 0A block C) ---
+
+bool addAfCode(app::RdsAfList& af, uint8_t code, bool regional) {
+  if (app::rdsAfCodeToFrequency(code) == 0) {
+    return false;
+  }
+  for (uint8_t i = 0; i < af.count; ++i) {
+    if (af.codes[i] == code) {
+      return false;
+    }
+  }
+  if (af.count >= app::kRdsAfCapacity) {
+    return false;
+  }
+  if (regional) {
+    af.regionalMask |= 1UL << af.count;
+  }
+  af.codes[af.count++] = code;
+  return true;
+}
+
+void startAfList(app::RdsAfList& af, uint8_t announced, bool methodB) {
+  memset(&af, 0, sizeof(af));
+  af.methodB = methodB ? 1 : 0;
+  af.expected = methodB ? static_cast<uint8_t>(announced > 0 ? (announced - 1U) / 2U : 0U) : announced;
+}
+
+// Method A sends the list as plain pairs after the header. Method B sends one list per transmitter, every pair
+// holding that transmitter's frequency; pairs in ascending order carry the same programme, descending ones a
+// regional variant. The first pair after a header tells the two apart.
+void processAfPair(app::AppState& state, uint8_t first, uint8_t second) {
+  AfAssembly& asmb = g_rt.af;
+  app::RdsAfList& af = state.rds.af;
+
+  if (asmb.skipNext) {
+    asmb.skipNext = false;
+    first = kAfCodeFiller;
+  }
+  if (second == kAfCodeLfMf) {
+    asmb.skipNext = true;
+  }
+
+  if (first >= kAfCodeCountBase && first <= kAfCodeCountMax) {
+    const uint8_t announced = static_cast<uint8_t>(first - kAfCodeCountBase);
+    asmb.headCode = second;
+    asmb.announced = announced;
+    if (asmb.method == AfMethod::A) {
+      if (af.expected != announced) {
+        startAfList(af, announced, false);
+      }
+      (void)addAfCode(af, second, false);
+    } else if (asmb.method == AfMethod::B) {
+      asmb.accepting = second == app::rdsAfCodeFromFrequency(state.radio.frequencyKhz);
+      if (asmb.accepting && af.expected != (announced > 0 ? (announced - 1U) / 2U : 0U)) {
+        startAfList(af, announced, true);
+      }
+    } else {
+      asmb.headPending = true;
+    }
+    return;
+  }
+  if (first == kAfCodeLfMf || (app::rdsAfCodeToFrequency(first) == 0 && app::rdsAfCodeToFrequency(second) == 0)) {
+    return;
+  }
+
+  if (asmb.headPending) {
+    asmb.headPending = false;
+    const bool methodB = asmb.announced >= 3 && (first == asmb.headCode || second == asmb.headCode);
+    asmb.method = methodB ? AfMethod::B : AfMethod::A;
+    startAfList(af, asmb.announced, methodB);
+    if (methodB) {
+      asmb.accepting = asmb.headCode == app::rdsAfCodeFromFrequency(state.radio.frequencyKhz);
+    } else {
+      (void)addAfCode(af, asmb.headCode, false);
+    }
+  } else if (asmb.method == AfMethod::Unknown) {
+    return;  // pairs before the first header cannot be placed
+  }
+
+  if (asmb.method == AfMethod::A) {
+    (void)addAfCode(af, first, false);
+    (void)addAfCode(af, second, false);
+    return;
+  }
+  if (!asmb.accepting) {
+    return;
+  }
+  if (first == asmb.headCode) {
+    (void)addAfCode(af, second, first > second);
+  } else if (second == asmb.headCode) {
+    (void)addAfCode(af, first, first > second);
+  }
+}
+
+void handleGroup0(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint32_t nowMs) {
+  processPsGroup(snap, nowMs);
+  // AF lists are kept in every RDS mode: AF following needs them even when only PS is shown.
+  if (!snap.versionB && snap.bleC <= 1) {
+    processAfPair(state, static_cast<uint8_t>(snap.blockC >> 8), static_cast<uint8_t>(snap.blockC & 0xFF));
+  }
+}
+
+void handleGroup2(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint32_t nowMs) {
+  (void)state;
+  (void)processRtGroup(snap, nowMs);
+}
+
+void handleGroup4A(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint32_t nowMs) {
+  processCt(state, snap, nowMs);
+}
+
+// --- EON (group 14A) ---
+
+app::RdsEonEntry* eonEntryFor(app::RdsState& rds, uint16_t pi) {
+  uint8_t oldest = 0;
+  for (uint8_t i = 0; i < rds.eonCount; ++i) {
+    if (rds.eon[i].pi == pi) {
+      return &rds.eon[i];
+    }
+    if (rds.eon[i].lastSeenMs < rds.eon[oldest].lastSeenMs) {
+      oldest = i;
+    }
+  }
+  const uint8_t slot = rds.eonCount < app::kRdsEonCapacity ? rds.eonCount++ : oldest;
+  memset(&rds.eon[slot], 0, sizeof(rds.eon[slot]));
+  rds.eon[slot].pi = pi;
+  return &rds.eon[slot];
+}
+
+void addEonAf(app::RdsEonEntry& entry, uint8_t code) {
+  if (app::rdsAfCodeToFrequency(code) == 0) {
+    return;
+  }
+  for (uint8_t i = 0; i < entry.afCount; ++i) {
+    if (entry.afCodes[i] == code) {
+      return;
+    }
+  }
+  if (entry.afCount < app::kRdsEonAfCapacity) {
+    entry.afCodes[entry.afCount++] = code;
+  }
+}
+
+void handleGroup14A(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint32_t nowMs) {
+  if (!modeAllowsNetwork(state.global.rdsMode) || snap.bleC > 1 || snap.bleD > 1 || snap.blockD == 0 ||
+      snap.blockD == state.rds.pi) {
+    return;
+  }
+
+  app::RdsEonEntry& entry = *eonEntryFor(state.rds, snap.blockD);
+  entry.lastSeenMs = nowMs;
+  const uint8_t variant = static_cast<uint8_t>(snap.blockB & 0x0FU);
+  if (variant <= 3) {
+    entry.ps[variant * 2] = sanitizeRdsChar(static_cast<uint8_t>(snap.blockC >> 8));
+    entry.ps[variant * 2 + 1] = sanitizeRdsChar(static_cast<uint8_t>(snap.blockC & 0xFF));
+    entry.psMask = static_cast<uint8_t>(entry.psMask | (1U << variant));
+    entry.ps[8] = '\0';
+  } else if (variant == 4) {
+    addEonAf(entry, static_cast<uint8_t>(snap.blockC >> 8));
+    addEonAf(entry, static_cast<uint8_t>(snap.blockC & 0xFF));
+  } else if (variant <= 8) {
+    // Mapped frequencies: tuned network frequency, then the other network's.
+    addEonAf(entry, static_cast<uint8_t>(snap.blockC & 0xFF));
+  } else if (variant == 13) {
+    entry.pty = static_cast<uint8_t>((snap.blockC >> 11) & 0x1FU);
+    entry.hasPty = 1;
+  }
+}
+
+// --- RadioText+ (ODA announced in 3A, carried in the group it names) ---
+
+void handleRtPlus(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint32_t nowMs) {
+  (void)nowMs;
+  if (!modeAllowsRt(state.global.rdsMode) || snap.bleC > 1 || snap.bleD > 1) {
+    return;
+  }
+
+  const uint8_t toggle = static_cast<uint8_t>((snap.blockB >> 4) & 0x01U);
+  if (g_rt.rtPlus.hasToggle && toggle != g_rt.rtPlus.itemToggle) {
+    clearRtPlus(state.rds);
+  }
+  g_rt.rtPlus.hasToggle = true;
+  g_rt.rtPlus.itemToggle = toggle;
+
+  const uint8_t types[app::kRdsRtPlusTagCount] = {
+      static_cast<uint8_t>(((snap.blockB & 0x07U) << 3) | (snap.blockC >> 13)),
+      static_cast<uint8_t>(((snap.blockC & 0x01U) << 5) | (snap.blockD >> 11)),
+  };
+  const uint8_t starts[app::kRdsRtPlusTagCount] = {
+      static_cast<uint8_t>((snap.blockC >> 7) & 0x3FU),
+      static_cast<uint8_t>((snap.blockD >> 5) & 0x3FU),
+  };
+  const uint8_t lengths[app::kRdsRtPlusTagCount] = {
+      static_cast<uint8_t>(((snap.blockC >> 1) & 0x3FU) + 1U),
+      static_cast<uint8_t>((snap.blockD & 0x1FU) + 1U),
+  };
+
+  for (uint8_t i = 0; i < app::kRdsRtPlusTagCount; ++i) {
+    if (types[i] == 0 || starts[i] + lengths[i] > app::kRdsRtCapacity - 1) {
+      continue;
+    }
+    state.rds.rtPlus[i].contentType = types[i];
+    state.rds.rtPlus[i].start = starts[i];
+    state.rds.rtPlus[i].length = lengths[i];
+    state.rds.hasRtPlus = 1;
+  }
+  state.rds.rtPlusRunning = static_cast<uint8_t>((snap.blockB >> 3) & 0x01U);
+}
+
+inline uint8_t routeIndex(uint8_t groupType, bool versionB) {
+  return static_cast<uint8_t>(((groupType & 0x0FU) << 1) | (versionB ? 1U : 0U));
+}
+
+void handleGroup3A(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint32_t nowMs);
+
+constexpr GroupRoute kRoutes[kGroupRoutes] = {
+    {handleGroup0, true},   {handleGroup0, true},    // 0A, 0B: PS (+ AF on 0A)
+    {nullptr, false},       {nullptr, false},        // 1
+    {handleGroup2, false},  {handleGroup2, false},   // 2A, 2B: RT
+    {handleGroup3A, true},  {nullptr, false},        // 3A: ODA registration
+    {handleGroup4A, false}, {nullptr, false},        // 4A: CT
+    {nullptr, false},       {nullptr, false},        // 5
+    {nullptr, false},       {nullptr, false},        // 6
+    {nullptr, false},       {nullptr, false},        // 7
+    {nullptr, false},       {nullptr, false},        // 8
+    {nullptr, false},       {nullptr, false},        // 9
+    {nullptr, false},       {nullptr, false},        // 10
+    {nullptr, false},       {nullptr, false},        // 11
+    {nullptr, false},       {nullptr, false},        // 12
+    {nullptr, false},       {nullptr, false},        // 13
+    {handleGroup14A, true}, {nullptr, false},        // 14A: EON
+    {nullptr, false},       {nullptr, false},        // 15
+};
+
+constexpr GroupRoute kRtPlusRoute = {handleRtPlus, true};
+
+// 3A registers an open data application: block B names the group that will carry it, block D its AID. Only
+// version A groups without a fixed route can be claimed.
+void handleGroup3A(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint32_t nowMs) {
+  (void)state;
+  (void)nowMs;
+  if (snap.bleB > 1 || snap.bleD > 1) {
+    return;
+  }
+  const uint8_t appGroup = static_cast<uint8_t>(snap.blockB & 0x1FU);
+  if ((appGroup & 0x01U) != 0 || kRoutes[appGroup].handler != nullptr) {
+    return;
+  }
+  if (snap.blockD == kRtPlusAid) {
+    g_rt.rtPlus.route = appGroup;
+  } else if (g_rt.rtPlus.route == appGroup) {
+    g_rt.rtPlus.route = 0;
+  }
+}
+
+void dispatchGroup(app::AppState& state, const services::radio::RdsGroupSnapshot& snap, uint8_t groupQuality,
+                   uint32_t nowMs) {
+  const uint8_t index = routeIndex(snap.groupType, snap.versionB);
+  const GroupRoute& route = (g_rt.rtPlus.route != 0 && index == g_rt.rtPlus.route) ? kRtPlusRoute : kRoutes[index];
+  if (route.handler == nullptr || (route.needsQuality && groupQuality < kRdsQualityMinBuffer)) {
+    return;
+  }
+  route.handler(state, snap, nowMs);
+}
+
 void syncQualityToState(app::AppState& state) {
   state.rds.quality = g_rt.quality.score;
   state.rds.lastGoodGroupMs = g_rt.quality.lastGoodGroupMs;
@@ -655,6 +1151,7 @@ void applyStalePolicy(app::AppState& state, uint32_t nowMs) {
     if (modeAllowsRt(state.global.rdsMode) && state.rds.lastRtCommitMs &&
         (nowMs - state.rds.lastRtCommitMs) >= kRdsStaleClearMs) {
       clearRt(state.rds);
+      clearRtPlus(state.rds);
       state.rds.lastRtCommitMs = 0;
     }
 
@@ -706,21 +1203,44 @@ void clearCommittedRds(app::AppState& state) {
 
 bool hasAnyVisibleOrClockRdsState(const app::AppState& state) {
   return state.rds.hasPs || state.rds.hasRt || state.rds.hasPi || state.rds.hasPty || state.rds.hasCt ||
-         state.rds.quality > 0 || state.clock.hasRdsBase;
+         state.rds.hasRtPlus || state.rds.af.count > 0 || state.rds.eonCount > 0 || state.rds.quality > 0 ||
+         state.clock.hasRdsBase;
 }
 
 }  // namespace
 
+bool acquiring(const app::AppState& state) {
+  if (!modeEnabled(state.global.rdsMode) || state.radio.modulation != app::Modulation::FM ||
+      services::radio::squelchClosed() || acquireComplete(state)) {
+    return false;
+  }
+  return acquireWindowOpen(millis());
+}
+
 void reset(app::AppState& state) {
   clearCommittedRds(state);
   resetDecoderRuntime();
   services::clock::clearRdsUtcBase(state);
   g_rt.lastTickMs = 0;
+  g_rt.poll.acquireUntilMs = millis() + kRdsAcquireWindowMs;
+  g_rt.poll.synced = false;
+  g_rt.poll.lastGroupMs = millis();
+}
+
+bool votedPi(uint16_t* pi) {
+  if (!g_rt.piVote.locked) {
+    return false;
+  }
+  if (pi != nullptr) {
+    *pi = g_rt.piVote.lockedPi;
+  }
+  return true;
 }
 
 void tick(app::AppState& state) {
   const uint32_t nowMs = millis();
-  const bool seekBusy = services::seekscan::busy() || state.seekScan.active;
+  const bool seekBusy =
+      services::seekscan::busy() || (state.seekScan.active && !services::etm::identifying());
   const bool active = services::radio::ready() && isFmActive(state) && modeEnabled(state.global.rdsMode) && !seekBusy;
 
   if (contextChanged(state, seekBusy)) {
@@ -731,6 +1251,7 @@ void tick(app::AppState& state) {
       reset(state);
       if (services::radio::ready() && isFmActive(state) && modeEnabled(state.global.rdsMode)) {
         services::radio::resetRdsDecoder();
+        services::rdstrace::noteTune(state.radio.frequencyKhz);
       }
     } else {
       applyModeVisibilityMask(state);
@@ -750,26 +1271,43 @@ void tick(app::AppState& state) {
     return;
   }
 
-  if (nowMs - g_rt.lastTickMs < kRdsTickMs) {
+  if (nowMs - g_rt.lastTickMs < pollIntervalMs(state, nowMs)) {
     applyStalePolicy(state, nowMs);
     applyModeVisibilityMask(state);
     return;
   }
   g_rt.lastTickMs = nowMs;
 
-  uint8_t rssiSample = 0;
-  uint8_t snrSample = 0;
-  (void)services::radio::readSignalQuality(&rssiSample, &snrSample);
-
   bool validGroupSeen = false;
   uint16_t votedPi = 0x0000;
   bool piLocked = false;
+  uint8_t groups = 0;
+  uint8_t lost = 0;
+  uint8_t fifoPeak = 0;
+  uint8_t rssiSample = 0;
+  uint8_t snrSample = 0;
 
-  for (uint8_t i = 0; i < kMaxGroupsPerTick; ++i) {
+  // Drain by fill level: the FIFO count of each read says whether another read will find a group.
+  bool more = true;
+  for (uint8_t i = 0; i < kRdsDrainMaxGroups && more; ++i) {
     services::radio::RdsGroupSnapshot snap{};
     if (!services::radio::pollRdsGroup(&snap)) {
       break;
     }
+    more = snap.fifoUsed > 0;
+    if (i == 0) {
+      // SNR for the group quality, read only once there is a group: empty polls cost one FIFO read.
+      (void)services::radio::readSignalQuality(&rssiSample, &snrSample);
+      services::rdstrace::noteRsq(rssiSample, snrSample);
+      fifoPeak = static_cast<uint8_t>(snap.fifoUsed + 1U);
+    }
+    services::rdstrace::noteGroup(snap);
+    ++groups;
+    lost = static_cast<uint8_t>(lost + (snap.groupLost ? 1U : 0U));
+    if (!g_rt.poll.synced || snap.syncFound) {
+      g_rt.poll.synced = true;
+      g_rt.poll.acquireUntilMs = nowMs + kRdsAcquireWindowMs;
+    }
 
     validGroupSeen = true;
     state.rds.lastGroupMs = nowMs;
@@ -780,18 +1318,17 @@ void tick(app::AppState& state) {
 
     const uint16_t piSample = (snap.bleA <= 1) ? snap.blockA : 0x0000;
     piLocked |= updatePiVote(piSample, &votedPi);
+    applyCachedName(state, snap, piLocked, votedPi, nowMs);
 
     if (snap.bleB <= 1) {
+      g_rt.names.pty = static_cast<uint8_t>(snap.pty & 0x1F);
+      g_rt.names.hasPty = true;
       commitPtyImmediate(state, snap.pty, nowMs);
     }
 
-    // Keep CT updates immediate (signal-scale behavior for low-rate fields), but CT application remains mode-gated.
-    processCt(state, snap, nowMs);
-
-    if (groupQuality >= kRdsQualityMinBuffer) {
-      processPsGroup(snap, nowMs);
-      (void)processRtGroup(snap, nowMs);
-    }
+    // One table lookup per group. CT is routed without the quality gate (signal-scale behavior for low-rate
+    // fields) and its application remains mode-gated.
+    dispatchGroup(state, snap, groupQuality, nowMs);
 
     if ((nowMs - g_rt.quality.lastUiCommitMs) < kRdsUiCommitMinMs) {
       continue;
@@ -819,15 +1356,41 @@ void tick(app::AppState& state) {
     if (committed) {
       g_rt.quality.lastUiCommitMs = nowMs;
     }
+    if (piLocked) {
+      rememberName(state, votedPi);
+    }
   }
 
-  if (!validGroupSeen) {
-    (void)updateRdsQuality(false, 0, nowMs);
+  countGroups(groups, lost, fifoPeak, nowMs);
+  if (validGroupSeen) {
+    g_rt.poll.lastGroupMs = nowMs;
+  } else {
+    // One decay step per kRdsTickMs without groups, whatever the poll cadence.
+    uint32_t steps = (nowMs - g_rt.poll.lastGroupMs) / kRdsTickMs;
+    g_rt.poll.lastGroupMs += steps * kRdsTickMs;
+    for (steps = min(steps, static_cast<uint32_t>(8)); steps > 0; --steps) {
+      (void)updateRdsQuality(false, 0, nowMs);
+    }
     syncQualityToState(state);
   }
 
   applyStalePolicy(state, nowMs);
   applyModeVisibilityMask(state);
+  g_rt.poll.stats.pollMs = static_cast<uint16_t>(pollIntervalMs(state, nowMs));
+}
+
+void stats(RdsStats* out) {
+  if (out == nullptr) {
+    return;
+  }
+  *out = g_rt.poll.stats;
+}
+
+void resetStats() {
+  g_rt.poll.stats = RdsStats{};
+  g_rt.poll.windowStartMs = millis();
+  g_rt.poll.windowGroups = 0;
+  g_rt.poll.windowLost = 0;
 }
 
 }  // namespace services::rds
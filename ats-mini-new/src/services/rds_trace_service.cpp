@@ -0,0 +1,295 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include <string.h>
+
+#include "../../include/app_services.h"
+#include "../../include/le_bytes.h"
+
+namespace services::rdstrace {
+namespace {
+
+// /rds/trace.bin, little-endian, appended while recording:
+//   u32 magic | u8 version | u8 0 | u16 0
+//   records: u8 type | u16 dtMs since the previous record | payload
+//     Tune  { u16 frequencyKhz }
+//     Rsq   { u8 rssi | u8 snr }                        (only when the levels rds::tick used changed)
+//     Group { u16 A | u16 B | u16 C | u16 D | u8 BLE A..D (2 bits each, A low) | u8 flags }
+//     Time  { u32 dtMs }                                (no dt field; bridges gaps over 65535 ms)
+// Group flags: bit 0 RDSSYNCFOUND, bit 1 GRPLOST, bits 2..6 FIFO count left after the read.
+// Records go through a RAM buffer and are appended in kBufferSize chunks, ~150 B/s with a clean signal.
+constexpr uint32_t kMagic = 0x54534452;  // RDST
+constexpr uint8_t kVersion = 1;
+constexpr size_t kHeaderSize = 8;
+constexpr uint8_t kTypeTune = 1;
+constexpr uint8_t kTypeRsq = 2;
+constexpr uint8_t kTypeGroup = 3;
+constexpr uint8_t kTypeTime = 4;
+constexpr size_t kTuneSize = 5;
+constexpr size_t kRsqSize = 5;
+constexpr size_t kGroupSize = 13;
+constexpr size_t kTimeSize = 5;
+constexpr uint8_t kFlagSyncFound = 0x01;
+constexpr uint8_t kFlagGroupLost = 0x02;
+constexpr size_t kBufferSize = 512;
+constexpr uint32_t kMaxTraceBytes = 128UL * 1024UL;  // ~15 min of groups
+constexpr size_t kDumpLineBytes = 32;
+constexpr char kDir[] = "/rds";
+constexpr char kPath[] = "/rds/trace.bin";
+
+bool g_recording = false;
+uint8_t g_buffer[kBufferSize];
+size_t g_used = 0;
+uint32_t g_bytes = 0;
+uint32_t g_lastMs = 0;
+bool g_hasRsq = false;
+uint16_t g_tunedKhz = 0;
+bool g_groupSinceTune = false;
+uint8_t g_lastRssi = 0;
+uint8_t g_lastSnr = 0;
+
+size_t recordSize(uint8_t type) {
+  switch (type) {
+    case kTypeTune:
+      return kTuneSize;
+    case kTypeRsq:
+      return kRsqSize;
+    case kTypeGroup:
+      return kGroupSize;
+    case kTypeTime:
+      return kTimeSize;
+    default:
+      return 0;
+  }
+}
+
+bool flush() {
+  if (g_used == 0) {
+    return true;
+  }
+  File file = LittleFS.open(kPath, "a");
+  const bool written = file && file.write(g_buffer, g_used) == g_used;
+  file.close();
+  g_used = 0;
+  if (!written) {
+    Serial.printf("[rdstrace] %s: write failed, recording stopped\n", kPath);
+    g_recording = false;
+  }
+  return written;
+}
+
+// Room for one record of size bytes (plus a Time record ahead of it); false once the file is at its cap.
+bool reserve(size_t size) {
+  if (g_bytes + kTimeSize + size > kMaxTraceBytes) {
+    flush();
+    g_recording = false;
+    Serial.printf("[rdstrace] %s: full at %lu bytes, recording stopped\n", kPath, static_cast<unsigned long>(g_bytes));
+    return false;
+  }
+  if (g_used + kTimeSize + size > kBufferSize && !flush()) {
+    return false;
+  }
+  return true;
+}
+
+// Starts a record: type and the time since the previous one. Returns the payload.
+uint8_t* beginRecord(uint8_t type, size_t size) {
+  if (!g_recording || !reserve(size)) {
+    return nullptr;
+  }
+  const uint32_t nowMs = millis();
+  uint32_t dtMs = nowMs - g_lastMs;
+  g_lastMs = nowMs;
+  if (dtMs > 0xFFFF) {
+    g_buffer[g_used] = kTypeTime;
+    put32(g_buffer + g_used + 1, dtMs);
+    g_used += kTimeSize;
+    g_bytes += kTimeSize;
+    dtMs = 0;
+  }
+  uint8_t* rec = g_buffer + g_used;
+  rec[0] = type;
+  put16(rec + 1, static_cast<uint16_t>(dtMs));
+  g_used += size;
+  g_bytes += size;
+  return rec + 3;
+}
+
+}  // namespace
+
+bool start(uint16_t frequencyKhz) {
+  if (g_recording) {
+    return true;
+  }
+  if (!services::etmcache::begin() || (!LittleFS.exists(kDir) && !LittleFS.mkdir(kDir))) {
+    Serial.println("[rdstrace] no filesystem");
+    return false;
+  }
+  uint8_t header[kHeaderSize];
+  put32(header, kMagic);
+  header[4] = kVersion;
+  header[5] = 0;
+  put16(header + 6, 0);
+  File file = LittleFS.open(kPath, "w");
+  const bool written = file && file.write(header, kHeaderSize) == kHeaderSize;
+  file.close();
+  if (!written) {
+    Serial.printf("[rdstrace] %s: create failed\n", kPath);
+    return false;
+  }
+  g_used = 0;
+  g_bytes = kHeaderSize;
+  g_lastMs = millis();
+  g_hasRsq = false;
+  g_tunedKhz = 0;
+  g_recording = true;
+  noteTune(frequencyKhz);
+  Serial.printf("[rdstrace] recording %u\n", frequencyKhz);
+  return true;
+}
+
+void stop() {
+  if (!g_recording) {
+    return;
+  }
+  flush();
+  g_recording = false;
+  Serial.printf("[rdstrace] stopped, %lu bytes\n", static_cast<unsigned long>(g_bytes));
+}
+
+bool recording() { return g_recording; }
+
+void noteTune(uint16_t frequencyKhz) {
+  // The decoder's reset right after start() (or a mode change) is not a retune.
+  if (!g_recording || (frequencyKhz == g_tunedKhz && !g_groupSinceTune)) {
+    return;
+  }
+  uint8_t* payload = beginRecord(kTypeTune, kTuneSize);
+  if (payload == nullptr) {
+    return;
+  }
+  put16(payload, frequencyKhz);
+  g_tunedKhz = frequencyKhz;
+  g_groupSinceTune = false;
+  g_hasRsq = false;
+}
+
+void noteRsq(uint8_t rssi, uint8_t snr) {
+  if (!g_recording || (g_hasRsq && rssi == g_lastRssi && snr == g_lastSnr)) {
+    return;
+  }
+  uint8_t* payload = beginRecord(kTypeRsq, kRsqSize);
+  if (payload == nullptr) {
+    return;
+  }
+  payload[0] = rssi;
+  payload[1] = snr;
+  g_hasRsq = true;
+  g_lastRssi = rssi;
+  g_lastSnr = snr;
+}
+
+void noteGroup(const radio::RdsGroupSnapshot& group) {
+  uint8_t* payload = beginRecord(kTypeGroup, kGroupSize);
+  if (payload == nullptr) {
+    return;
+  }
+  g_groupSinceTune = true;
+  put16(payload, group.blockA);
+  put16(payload + 2, group.blockB);
+  put16(payload + 4, group.blockC);
+  put16(payload + 6, group.blockD);
+  payload[8] = static_cast<uint8_t>((group.bleA & 0x03) | ((group.bleB & 0x03) << 2) | ((group.bleC & 0x03) << 4) |
+                                    ((group.bleD & 0x03) << 6));
+  payload[9] = static_cast<uint8_t>((group.syncFound ? kFlagSyncFound : 0) | (group.groupLost ? kFlagGroupLost : 0) |
+                                    ((group.fifoUsed & 0x1F) << 2));
+}
+
+void dump() {
+  if (g_recording) {
+    flush();
+  }
+  File file = LittleFS.open(kPath, "r");
+  if (!file) {
+    Serial.println("[rdstrace] no trace");
+    return;
+  }
+  const size_t size = file.size();
+  Serial.printf("[rdstrace] begin bytes=%lu\n", static_cast<unsigned long>(size));
+  uint8_t chunk[kDumpLineBytes];
+  char line[kDumpLineBytes * 2 + 2];
+  size_t read = 0;
+  while ((read = file.read(chunk, kDumpLineBytes)) > 0) {
+    line[0] = ':';
+    for (size_t i = 0; i < read; ++i) {
+      snprintf(line + 1 + i * 2, 3, "%02X", chunk[i]);
+    }
+    Serial.println(line);
+  }
+  file.close();
+  Serial.println("[rdstrace] end");
+}
+
+void clear() {
+  g_recording = false;
+  g_used = 0;
+  g_bytes = 0;
+  if (LittleFS.exists(kPath)) {
+    LittleFS.remove(kPath);
+  }
+}
+
+uint32_t bytes() { return g_bytes; }
+
+bool checkHeader(const uint8_t* data, size_t size, size_t* offset) {
+  if (data == nullptr || size < kHeaderSize || get32(data) != kMagic || data[4] != kVersion) {
+    return false;
+  }
+  *offset = kHeaderSize;
+  return true;
+}
+
+bool decodeRecord(const uint8_t* data, size_t size, size_t* offset, uint32_t* clockMs, TraceRecord* out) {
+  while (*offset < size) {
+    const uint8_t* rec = data + *offset;
+    const size_t length = recordSize(rec[0]);
+    if (length == 0 || *offset + length > size) {
+      return false;
+    }
+    *offset += length;
+    if (rec[0] == kTypeTime) {
+      *clockMs += get32(rec + 1);
+      continue;
+    }
+
+    *clockMs += get16(rec + 1);
+    *out = TraceRecord{};
+    out->atMs = *clockMs;
+    const uint8_t* payload = rec + 3;
+    switch (rec[0]) {
+      case kTypeTune:
+        out->type = TraceRecordType::Tune;
+        out->frequencyKhz = get16(payload);
+        break;
+      case kTypeRsq:
+        out->type = TraceRecordType::Rsq;
+        out->rssi = payload[0];
+        out->snr = payload[1];
+        break;
+      default:
+        out->type = TraceRecordType::Group;
+        for (uint8_t i = 0; i < 4; ++i) {
+          out->blocks[i] = get16(payload + i * 2);
+          out->ble[i] = static_cast<uint8_t>((payload[8] >> (i * 2)) & 0x03);
+        }
+        out->syncFound = (payload[9] & kFlagSyncFound) != 0;
+        out->groupLost = (payload[9] & kFlagGroupLost) != 0;
+        out->fifoUsed = static_cast<uint8_t>((payload[9] >> 2) & 0x1F);
+        break;
+    }
+    return true;
+  }
+  return false;
+}
+
+}  // namespace services::rdstrace
@@ -11,6 +11,7 @@ enum class Operation : uint8_t {
   None = 0,
   SeekPending = 1,
   Seeking = 2,
+  MemoryConfirm = 3,  // tuned to a known ETM station, waiting to read it
 };
 
 struct ContextKey {
@@ -22,7 +23,8 @@ struct ContextKey {
 
 Operation g_operation = Operation::None;
 int8_t g_direction = 1;
-app::AppState* g_activeSeekState = nullptr;
+uint32_t g_confirmAtMs = 0;
+bool g_confirmCancelled = false;
 
 ContextKey g_context = {0xFF, 0, 9, app::FmRegion::World};
 
@@ -50,10 +52,7 @@ bool sameContext(const ContextKey& lhs, const ContextKey& rhs) {
          lhs.fmRegion == rhs.fmRegion;
 }
 
-void clearOperationState() {
-  g_operation = Operation::None;
-  g_activeSeekState = nullptr;
-}
+void clearOperationState() { g_operation = Operation::None; }
 
 void publishSeekCompleteState(app::AppState& state, bool found) {
   state.seekScan.active = false;
@@ -66,6 +65,64 @@ void publishSeekCompleteState(app::AppState& state, bool found) {
   state.seekScan.foundIndex = found ? 0 : -1;
 }
 
+void publishSeekFound(app::AppState& state, bool found, uint8_t rssi) {
+  state.seekScan.bestFrequencyKhz = state.radio.frequencyKhz;
+  state.seekScan.bestRssi = rssi;
+  state.seekScan.pointsVisited = 1;
+  publishSeekCompleteState(state, found);
+  clearOperationState();
+}
+
+// Hardware seek from the current frequency; tickSeeking() polls it once per loop pass.
+bool startHardwareSeek(app::AppState& state) {
+  if (!services::radio::startSeek(state, g_direction)) {
+    publishSeekCompleteState(state, false);
+    clearOperationState();
+    return true;
+  }
+  g_operation = Operation::Seeking;
+  return true;
+}
+
+// Memory seek (etm_scan.h): tune straight to the known station and read it once it has settled.
+void startMemoryJump(app::AppState& state, uint16_t frequencyKhz) {
+  state.radio.frequencyKhz = frequencyKhz;
+  state.radio.ssbTuneOffsetHz = 0;
+  state.seekScan.bestFrequencyKhz = frequencyKhz;
+  services::radio::apply(state);
+  const uint16_t settleMs = isFmFamily(state.radio.modulation) ? app::kEtmProfileFm.coarseSettleMs
+                                                                : app::kEtmProfileSw.coarseSettleMs;
+  g_confirmAtMs = millis() + settleMs;
+  g_confirmCancelled = false;
+  g_operation = Operation::MemoryConfirm;
+}
+
+bool tickMemoryConfirm(app::AppState& state) {
+  if (g_confirmCancelled) {
+    publishSeekFound(state, false, 0);
+    return true;
+  }
+  if (static_cast<int32_t>(millis() - g_confirmAtMs) < 0) {
+    return false;
+  }
+
+  uint8_t rssi = 0;
+  uint8_t snr = 0;
+  services::radio::readSignalQualityFresh(&rssi, &snr);
+  const uint8_t sensIdx = static_cast<uint8_t>(state.global.scanSensitivity) % 2;
+  const app::EtmSensitivity& sens =
+      isFmFamily(state.radio.modulation) ? app::kEtmSensitivityFm[sensIdx] : app::kEtmSensitivityAm[sensIdx];
+  if (rssi >= sens.rssiMin && snr >= sens.snrMin) {
+    publishSeekFound(state, true, rssi);
+    return true;
+  }
+  // Gone: seek on from here, past the station that was not there.
+  Serial.printf("[seek] %u kHz not confirmed (rssi %u snr %u), hardware seek\n",
+                static_cast<unsigned>(state.radio.frequencyKhz), static_cast<unsigned>(rssi),
+                static_cast<unsigned>(snr));
+  return startHardwareSeek(state);
+}
+
 void updateContext(app::AppState& state) {
   const ContextKey next = contextFor(state);
   if (!sameContext(next, g_context)) {
@@ -73,6 +130,31 @@ void updateContext(app::AppState& state) {
   }
 }
 
+// The tuner seeks on its own between polls; the loop keeps running and only mirrors its progress.
+bool tickSeeking(app::AppState& state) {
+  bool found = false;
+  uint16_t frequencyKhz = 0;
+  if (!services::radio::pollSeek(&found, &frequencyKhz)) {
+    const uint16_t progressKhz = services::radio::seekProgressKhz();
+    if (progressKhz == 0 || progressKhz == state.radio.frequencyKhz) {
+      return false;
+    }
+    state.radio.frequencyKhz = progressKhz;
+    state.radio.ssbTuneOffsetHz = 0;
+    state.seekScan.bestFrequencyKhz = progressKhz;
+    return true;
+  }
+
+  state.radio.frequencyKhz = frequencyKhz;
+  state.radio.ssbTuneOffsetHz = 0;
+
+  uint8_t rssi = 0;
+  uint8_t snr = 0;
+  services::radio::readSignalQuality(&rssi, &snr);
+  publishSeekFound(state, found, rssi);
+  return true;
+}
+
 }  // namespace
 
 void requestSeek(int8_t direction) {
@@ -91,7 +173,10 @@ void requestCancel() {
     return;
   }
   if (g_operation == Operation::Seeking) {
-    services::input::requestAbortEvent();
+    services::radio::cancelSeek();
+  }
+  if (g_operation == Operation::MemoryConfirm) {
+    g_confirmCancelled = true;
   }
 }
 
@@ -99,21 +184,15 @@ bool busy() { return g_operation != Operation::None; }
 
 void syncContext(app::AppState& state) { updateContext(state); }
 
-void notifySeekProgress(uint16_t frequencyKhz) {
-  if (g_operation != Operation::Seeking || g_activeSeekState == nullptr) {
-    return;
-  }
-
-  app::AppState& state = *g_activeSeekState;
-  state.radio.frequencyKhz = frequencyKhz;
-  state.radio.ssbTuneOffsetHz = 0;
-  state.seekScan.bestFrequencyKhz = frequencyKhz;
-  services::ui::render(state);
-}
-
 bool tick(app::AppState& state) {
   updateContext(state);
 
+  if (g_operation == Operation::Seeking) {
+    return tickSeeking(state);
+  }
+  if (g_operation == Operation::MemoryConfirm) {
+    return tickMemoryConfirm(state);
+  }
   if (g_operation != Operation::SeekPending) {
     return false;
   }
@@ -123,21 +202,14 @@ bool tick(app::AppState& state) {
   state.seekScan.scanning = false;
   state.seekScan.direction = g_direction;
 
-  g_operation = Operation::Seeking;
-  g_activeSeekState = &state;
-  const bool found = services::radio::seek(state, g_direction);
-
-  uint8_t rssi = 0;
-  uint8_t snr = 0;
-  services::radio::readSignalQuality(&rssi, &snr);
-
-  state.seekScan.bestFrequencyKhz = state.radio.frequencyKhz;
-  state.seekScan.bestRssi = rssi;
-  state.seekScan.pointsVisited = 1;
-  publishSeekCompleteState(state, found);
-
-  clearOperationState();
-  return true;
+  if (!app::isSsb(state.radio.modulation)) {
+    const uint16_t knownKhz = services::etm::knownStationFrom(state, g_direction, app::kEtmSeekMaxAgeMs);
+    if (knownKhz != 0) {
+      startMemoryJump(state, knownKhz);
+      return true;
+    }
+  }
+  return startHardwareSeek(state);
 }
 
 }  // namespace services::seekscan
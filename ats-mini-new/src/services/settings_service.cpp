@@ -9,6 +9,7 @@
 #include "../../include/app_services.h"
 #include "../../include/bandplan.h"
 #include "../../include/etm_scan.h"
+#include "../../include/le_bytes.h"
 #include "../../include/settings_model.h"
 
 namespace services::settings {
@@ -20,6 +21,8 @@ bool g_dirty = false;
 uint32_t g_lastDirtyMs = 0;
 
 constexpr uint32_t kMagic = 0x4154534D;  // ATSM
+constexpr uint16_t kSchemaV5 = 5;
+constexpr uint16_t kSchemaV4 = 4;
 constexpr uint16_t kSchemaV3 = 3;
 constexpr uint16_t kSchemaV2 = 2;
 constexpr uint8_t kLegacySchemaV1 = 1;
@@ -52,7 +55,7 @@ struct PersistedMemorySlotV3 {
   char name[app::kMemoryNameCapacity];
 };
 
-struct PersistedPayloadV3 {
+struct PersistedPayloadV5 {
   PersistedRadioV3 radio;
   app::GlobalSettings global;
   app::BandRuntimeState perBand[app::kBandCount];
@@ -60,6 +63,107 @@ struct PersistedPayloadV3 {
   app::NetworkCredentials network;
 };
 
+struct PersistedBlobV5 {
+  uint32_t magic;
+  uint16_t schema;
+  uint16_t payloadSize;
+  uint32_t checksum;
+  PersistedPayloadV5 payload;
+};
+
+// GlobalSettings as stored by schema 4 (before the scan band mask).
+struct GlobalSettingsV4 {
+  uint8_t volume;
+  uint8_t lastBandIndex;
+
+  app::WifiMode wifiMode;
+  uint8_t brightness;
+  uint8_t agcEnabled;
+  uint8_t avcLevel;
+  uint8_t avcAmLevel;
+  uint8_t avcSsbLevel;
+  uint8_t softMuteEnabled;
+  uint8_t softMuteMaxAttenuation;
+  uint8_t softMuteAmLevel;
+  uint8_t softMuteSsbLevel;
+  uint16_t sleepTimerMinutes;
+  app::SleepMode sleepMode;
+  app::Theme theme;
+  app::RdsMode rdsMode;
+  uint8_t zoomMenu;
+  int8_t scrollDirection;
+  int16_t utcOffsetMinutes;
+  uint8_t squelch;
+  app::FmRegion fmRegion;
+  app::UiLayout uiLayout;
+  app::BleMode bleMode;
+  app::UsbMode usbMode;
+
+  app::ScanSensitivity scanSensitivity;
+  app::ScanSpeed scanSpeed;
+  uint16_t scanIdentifyDwellMs;
+
+  uint8_t memoryWriteIndex;
+};
+
+struct PersistedPayloadV4 {
+  PersistedRadioV3 radio;
+  GlobalSettingsV4 global;
+  app::BandRuntimeState perBand[app::kBandCount];
+  PersistedMemorySlotV3 memories[app::kMemoryCount];
+  app::NetworkCredentials network;
+};
+
+struct PersistedBlobV4 {
+  uint32_t magic;
+  uint16_t schema;
+  uint16_t payloadSize;
+  uint32_t checksum;
+  PersistedPayloadV4 payload;
+};
+
+// GlobalSettings as stored by schema 2 and 3 (before the scan identify dwell).
+struct GlobalSettingsV3 {
+  uint8_t volume;
+  uint8_t lastBandIndex;
+
+  app::WifiMode wifiMode;
+  uint8_t brightness;
+  uint8_t agcEnabled;
+  uint8_t avcLevel;
+  uint8_t avcAmLevel;
+  uint8_t avcSsbLevel;
+  uint8_t softMuteEnabled;
+  uint8_t softMuteMaxAttenuation;
+  uint8_t softMuteAmLevel;
+  uint8_t softMuteSsbLevel;
+  uint16_t sleepTimerMinutes;
+  app::SleepMode sleepMode;
+  app::Theme theme;
+  app::RdsMode rdsMode;
+  uint8_t zoomMenu;
+  int8_t scrollDirection;
+  int16_t utcOffsetMinutes;
+  uint8_t squelch;
+  app::FmRegion fmRegion;
+  app::UiLayout uiLayout;
+  app::BleMode bleMode;
+  app::UsbMode usbMode;
+
+  app::ScanSensitivity scanSensitivity;
+  app::ScanSpeed scanSpeed;
+
+  uint8_t memoryWriteIndex;
+};
+
+struct PersistedPayloadV3 {
+  PersistedRadioV3 radio;
+  GlobalSettingsV3 global;
+  app::BandRuntimeState perBand[app::kBandCount];
+  PersistedMemorySlotV3 memories[app::kMemoryCount];
+  app::NetworkCredentials network;
+};
+
 struct PersistedBlobV3 {
   uint32_t magic;
   uint16_t schema;
@@ -78,7 +182,7 @@ struct PersistedRadioV2 {
   uint8_t volume;
 };
 
-using GlobalSettingsV2 = app::GlobalSettings;
+using GlobalSettingsV2 = GlobalSettingsV3;
 
 struct GlobalSettingsV2Legacy {
   uint8_t volume;
@@ -207,15 +311,6 @@ uint8_t inferBandIndexFromFrequency(uint16_t frequencyKhz, app::Modulation modul
   return allBand;
 }
 
-uint32_t checksumForBytes(const uint8_t* bytes, size_t length) {
-  uint32_t acc = 2166136261u;
-  for (size_t i = 0; i < length; ++i) {
-    acc ^= bytes[i];
-    acc *= 16777619u;
-  }
-  return acc;
-}
-
 uint16_t legacyChecksumFor(const PersistedRadioV2& radio) {
   uint32_t acc = 2166136261u;
 
@@ -376,10 +471,18 @@ void sanitizeGlobal(app::GlobalSettings& global) {
   }
 
   const uint8_t speedRaw = static_cast<uint8_t>(global.scanSpeed);
-  if (speedRaw > static_cast<uint8_t>(app::ScanSpeed::Thorough)) {
+  if (speedRaw > static_cast<uint8_t>(app::ScanSpeed::Hybrid)) {
     global.scanSpeed = app::ScanSpeed::Thorough;
   }
 
+  if (!app::isEtmIdentifyDwellOption(global.scanIdentifyDwellMs)) {
+    global.scanIdentifyDwellMs = app::kEtmIdentifyDwellDefaultMs;
+  }
+
+  if (app::etmBatchPresetIndex(global.scanBandMask) >= app::kEtmBatchPresetCount) {
+    global.scanBandMask = app::etmBatchPresetMask(app::kEtmBatchPresetDefault);
+  }
+
   if (global.memoryWriteIndex >= app::kMemoryCount) {
     global.memoryWriteIndex = 0;
   }
@@ -412,12 +515,80 @@ void migrateLegacyGlobal(const GlobalSettingsV2Legacy& legacy, app::GlobalSettin
   global.avcSsbLevel = 48;
   global.scanSensitivity = app::ScanSensitivity::High;
   global.scanSpeed = app::ScanSpeed::Thorough;
+  global.scanIdentifyDwellMs = app::kEtmIdentifyDwellDefaultMs;
+  global.scanBandMask = app::etmBatchPresetMask(app::kEtmBatchPresetDefault);
 
   const uint8_t legacySoftMute = legacy.softMuteEnabled ? clampValue<uint8_t>(legacy.softMuteMaxAttenuation, 0, 32) : 0;
   global.softMuteAmLevel = legacySoftMute;
   global.softMuteSsbLevel = legacySoftMute;
 }
 
+void migrateGlobalV3(const GlobalSettingsV3& source, app::GlobalSettings& global) {
+  global.volume = source.volume;
+  global.lastBandIndex = source.lastBandIndex;
+  global.wifiMode = source.wifiMode;
+  global.brightness = source.brightness;
+  global.agcEnabled = source.agcEnabled;
+  global.avcLevel = source.avcLevel;
+  global.avcAmLevel = source.avcAmLevel;
+  global.avcSsbLevel = source.avcSsbLevel;
+  global.softMuteEnabled = source.softMuteEnabled;
+  global.softMuteMaxAttenuation = source.softMuteMaxAttenuation;
+  global.softMuteAmLevel = source.softMuteAmLevel;
+  global.softMuteSsbLevel = source.softMuteSsbLevel;
+  global.sleepTimerMinutes = source.sleepTimerMinutes;
+  global.sleepMode = source.sleepMode;
+  global.theme = source.theme;
+  global.rdsMode = source.rdsMode;
+  global.zoomMenu = source.zoomMenu;
+  global.scrollDirection = source.scrollDirection;
+  global.utcOffsetMinutes = source.utcOffsetMinutes;
+  global.squelch = source.squelch;
+  global.fmRegion = source.fmRegion;
+  global.uiLayout = source.uiLayout;
+  global.bleMode = source.bleMode;
+  global.usbMode = source.usbMode;
+  global.scanSensitivity = source.scanSensitivity;
+  global.scanSpeed = source.scanSpeed;
+  global.memoryWriteIndex = source.memoryWriteIndex;
+
+  global.scanIdentifyDwellMs = app::kEtmIdentifyDwellDefaultMs;
+  global.scanBandMask = app::etmBatchPresetMask(app::kEtmBatchPresetDefault);
+}
+
+void migrateGlobalV4(const GlobalSettingsV4& source, app::GlobalSettings& global) {
+  global.volume = source.volume;
+  global.lastBandIndex = source.lastBandIndex;
+  global.wifiMode = source.wifiMode;
+  global.brightness = source.brightness;
+  global.agcEnabled = source.agcEnabled;
+  global.avcLevel = source.avcLevel;
+  global.avcAmLevel = source.avcAmLevel;
+  global.avcSsbLevel = source.avcSsbLevel;
+  global.softMuteEnabled = source.softMuteEnabled;
+  global.softMuteMaxAttenuation = source.softMuteMaxAttenuation;
+  global.softMuteAmLevel = source.softMuteAmLevel;
+  global.softMuteSsbLevel = source.softMuteSsbLevel;
+  global.sleepTimerMinutes = source.sleepTimerMinutes;
+  global.sleepMode = source.sleepMode;
+  global.theme = source.theme;
+  global.rdsMode = source.rdsMode;
+  global.zoomMenu = source.zoomMenu;
+  global.scrollDirection = source.scrollDirection;
+  global.utcOffsetMinutes = source.utcOffsetMinutes;
+  global.squelch = source.squelch;
+  global.fmRegion = source.fmRegion;
+  global.uiLayout = source.uiLayout;
+  global.bleMode = source.bleMode;
+  global.usbMode = source.usbMode;
+  global.scanSensitivity = source.scanSensitivity;
+  global.scanSpeed = source.scanSpeed;
+  global.scanIdentifyDwellMs = source.scanIdentifyDwellMs;
+  global.memoryWriteIndex = source.memoryWriteIndex;
+
+  global.scanBandMask = app::etmBatchPresetMask(app::kEtmBatchPresetDefault);
+}
+
 void sanitizeBandRuntime(uint8_t bandIndex, app::BandRuntimeState& bandState, app::FmRegion region) {
   const app::BandDef& band = app::kBandPlan[bandIndex];
   const uint16_t bandMinKhz = app::bandMinKhzFor(band, region);
@@ -573,7 +744,7 @@ void sanitizeNetwork(app::NetworkCredentials& network) {
   }
 }
 
-void fillPayloadFromState(const app::AppState& state, PersistedPayloadV3& payload) {
+void fillPayloadFromState(const app::AppState& state, PersistedPayloadV5& payload) {
   payload.radio.bandIndex = state.radio.bandIndex;
   payload.radio.frequencyKhz = state.radio.frequencyKhz;
   payload.radio.modulation = state.radio.modulation;
@@ -600,7 +771,7 @@ void fillPayloadFromState(const app::AppState& state, PersistedPayloadV3& payloa
   payload.network = state.network;
 }
 
-void syncDerivedFields(PersistedPayloadV3& payload) {
+void syncDerivedFields(PersistedPayloadV5& payload) {
   payload.global.volume = payload.radio.volume;
   payload.global.lastBandIndex = payload.radio.bandIndex;
 
@@ -621,7 +792,7 @@ void syncDerivedFields(PersistedPayloadV3& payload) {
   }
 }
 
-void sanitizePayload(PersistedPayloadV3& payload) {
+void sanitizePayload(PersistedPayloadV5& payload) {
   sanitizeGlobal(payload.global);
 
   for (uint8_t i = 0; i < app::kBandCount; ++i) {
@@ -635,7 +806,7 @@ void sanitizePayload(PersistedPayloadV3& payload) {
   sanitizeNetwork(payload.network);
 }
 
-void applyPayloadToState(const PersistedPayloadV3& payload, app::AppState& state) {
+void applyPayloadToState(const PersistedPayloadV5& payload, app::AppState& state) {
   state.radio.bandIndex = payload.radio.bandIndex;
   state.radio.frequencyKhz = payload.radio.frequencyKhz;
   state.radio.modulation = payload.radio.modulation;
@@ -673,10 +844,13 @@ void applyPayloadToState(const PersistedPayloadV3& payload, app::AppState& state
   state.seekScan.foundIndex = -1;
   state.seekScan.fineScanActive = false;
   state.seekScan.cursorScanPass = 0;
+  state.seekScan.cursorRdsPi = 0;
+  state.seekScan.cursorRdsPs[0] = '\0';
   state.seekScan.totalPoints = 0;
+  state.seekScan.scanDurationMs = 0;
 }
 
-void migrateV2ToV3(const PersistedPayloadV2& source, PersistedPayloadV3& target) {
+void migrateV2ToV5(const PersistedPayloadV2& source, PersistedPayloadV5& target) {
   target.radio.bandIndex = source.radio.bandIndex;
   target.radio.frequencyKhz = source.radio.frequencyKhz;
   target.radio.modulation = sanitizeModulationValue(source.radio.modulation);
@@ -686,7 +860,7 @@ void migrateV2ToV3(const PersistedPayloadV2& source, PersistedPayloadV3& target)
   target.radio.ssbStepHz = 1000;
   target.radio.volume = source.radio.volume;
 
-  target.global = source.global;
+  migrateGlobalV3(source.global, target.global);
 
   for (uint8_t i = 0; i < app::kBandCount; ++i) {
     target.perBand[i] = source.perBand[i];
@@ -715,7 +889,37 @@ void migrateV2ToV3(const PersistedPayloadV2& source, PersistedPayloadV3& target)
   }
 }
 
-void migrateV2LegacyToV3(const PersistedPayloadV2Legacy& source, PersistedPayloadV3& target) {
+void migrateV4ToV5(const PersistedPayloadV4& source, PersistedPayloadV5& target) {
+  target.radio = source.radio;
+  migrateGlobalV4(source.global, target.global);
+
+  for (uint8_t i = 0; i < app::kBandCount; ++i) {
+    target.perBand[i] = source.perBand[i];
+  }
+
+  for (uint8_t i = 0; i < app::kMemoryCount; ++i) {
+    target.memories[i] = source.memories[i];
+  }
+
+  target.network = source.network;
+}
+
+void migrateV3ToV5(const PersistedPayloadV3& source, PersistedPayloadV5& target) {
+  target.radio = source.radio;
+  migrateGlobalV3(source.global, target.global);
+
+  for (uint8_t i = 0; i < app::kBandCount; ++i) {
+    target.perBand[i] = source.perBand[i];
+  }
+
+  for (uint8_t i = 0; i < app::kMemoryCount; ++i) {
+    target.memories[i] = source.memories[i];
+  }
+
+  target.network = source.network;
+}
+
+void migrateV2LegacyToV5(const PersistedPayloadV2Legacy& source, PersistedPayloadV5& target) {
   target.radio.bandIndex = source.radio.bandIndex;
   target.radio.frequencyKhz = source.radio.frequencyKhz;
   target.radio.modulation = sanitizeModulationValue(source.radio.modulation);
@@ -754,34 +958,106 @@ void migrateV2LegacyToV3(const PersistedPayloadV2Legacy& source, PersistedPayloa
   }
 }
 
+bool loadV5Blob(app::AppState& state) {
+  const size_t blobSize = g_prefs.getBytesLength(kBlobKey);
+  if (blobSize != sizeof(PersistedBlobV5)) {
+    return false;
+  }
+
+  PersistedBlobV5 blob{};
+  if (g_prefs.getBytes(kBlobKey, &blob, sizeof(blob)) != sizeof(blob)) {
+    Serial.println("[settings] failed to read v5 blob");
+    return false;
+  }
+
+  if (blob.magic != kMagic || blob.schema != kSchemaV5 || blob.payloadSize != sizeof(PersistedPayloadV5)) {
+    Serial.println("[settings] invalid v5 header");
+    return false;
+  }
+
+  const uint32_t expectedChecksum = checksumForBytes(reinterpret_cast<const uint8_t*>(&blob.payload), sizeof(PersistedPayloadV5));
+  if (blob.checksum != expectedChecksum) {
+    Serial.println("[settings] v5 checksum mismatch");
+    return false;
+  }
+
+  PersistedPayloadV5 payload = blob.payload;
+  sanitizePayload(payload);
+  applyPayloadToState(payload, state);
+
+  Serial.println("[settings] restored v5 state");
+  return true;
+}
+
+bool loadV4Blob(app::AppState& state) {
+  const size_t blobSize = g_prefs.getBytesLength(kBlobKey);
+  if (blobSize != sizeof(PersistedBlobV4)) {
+    return false;
+  }
+
+  PersistedBlobV4 legacyBlob{};
+  if (g_prefs.getBytes(kBlobKey, &legacyBlob, sizeof(legacyBlob)) != sizeof(legacyBlob)) {
+    Serial.println("[settings] failed to read v4 blob");
+    return false;
+  }
+
+  if (legacyBlob.magic != kMagic || legacyBlob.schema != kSchemaV4 || legacyBlob.payloadSize != sizeof(PersistedPayloadV4)) {
+    Serial.println("[settings] invalid v4 header");
+    return false;
+  }
+
+  const uint32_t expectedChecksum =
+      checksumForBytes(reinterpret_cast<const uint8_t*>(&legacyBlob.payload), sizeof(PersistedPayloadV4));
+  if (legacyBlob.checksum != expectedChecksum) {
+    Serial.println("[settings] v4 checksum mismatch");
+    return false;
+  }
+
+  PersistedPayloadV5 migrated{};
+  migrateV4ToV5(legacyBlob.payload, migrated);
+  sanitizePayload(migrated);
+  applyPayloadToState(migrated, state);
+
+  g_dirty = true;
+  g_lastDirtyMs = millis() - app::kSettingsSaveDebounceMs;
+
+  Serial.println("[settings] migrated v4 state to v5");
+  return true;
+}
+
 bool loadV3Blob(app::AppState& state) {
   const size_t blobSize = g_prefs.getBytesLength(kBlobKey);
   if (blobSize != sizeof(PersistedBlobV3)) {
     return false;
   }
 
-  PersistedBlobV3 blob{};
-  if (g_prefs.getBytes(kBlobKey, &blob, sizeof(blob)) != sizeof(blob)) {
+  PersistedBlobV3 legacyBlob{};
+  if (g_prefs.getBytes(kBlobKey, &legacyBlob, sizeof(legacyBlob)) != sizeof(legacyBlob)) {
     Serial.println("[settings] failed to read v3 blob");
     return false;
   }
 
-  if (blob.magic != kMagic || blob.schema != kSchemaV3 || blob.payloadSize != sizeof(PersistedPayloadV3)) {
+  if (legacyBlob.magic != kMagic || legacyBlob.schema != kSchemaV3 || legacyBlob.payloadSize != sizeof(PersistedPayloadV3)) {
     Serial.println("[settings] invalid v3 header");
     return false;
   }
 
-  const uint32_t expectedChecksum = checksumForBytes(reinterpret_cast<const uint8_t*>(&blob.payload), sizeof(PersistedPayloadV3));
-  if (blob.checksum != expectedChecksum) {
+  const uint32_t expectedChecksum =
+      checksumForBytes(reinterpret_cast<const uint8_t*>(&legacyBlob.payload), sizeof(PersistedPayloadV3));
+  if (legacyBlob.checksum != expectedChecksum) {
     Serial.println("[settings] v3 checksum mismatch");
     return false;
   }
 
-  PersistedPayloadV3 payload = blob.payload;
-  sanitizePayload(payload);
-  applyPayloadToState(payload, state);
+  PersistedPayloadV5 migrated{};
+  migrateV3ToV5(legacyBlob.payload, migrated);
+  sanitizePayload(migrated);
+  applyPayloadToState(migrated, state);
 
-  Serial.println("[settings] restored v3 state");
+  g_dirty = true;
+  g_lastDirtyMs = millis() - app::kSettingsSaveDebounceMs;
+
+  Serial.println("[settings] migrated v3 state to v5");
   return true;
 }
 
@@ -807,15 +1083,15 @@ bool loadV2Blob(app::AppState& state) {
       return false;
     }
 
-    PersistedPayloadV3 migrated{};
-    migrateV2ToV3(legacyBlob.payload, migrated);
+    PersistedPayloadV5 migrated{};
+    migrateV2ToV5(legacyBlob.payload, migrated);
     sanitizePayload(migrated);
     applyPayloadToState(migrated, state);
 
     g_dirty = true;
     g_lastDirtyMs = millis() - app::kSettingsSaveDebounceMs;
 
-    Serial.println("[settings] migrated v2 state to v3");
+    Serial.println("[settings] migrated v2 state to v5");
     return true;
   }
 
@@ -839,15 +1115,15 @@ bool loadV2Blob(app::AppState& state) {
       return false;
     }
 
-    PersistedPayloadV3 migrated{};
-    migrateV2LegacyToV3(legacyBlob.payload, migrated);
+    PersistedPayloadV5 migrated{};
+    migrateV2LegacyToV5(legacyBlob.payload, migrated);
     sanitizePayload(migrated);
     applyPayloadToState(migrated, state);
 
     g_dirty = true;
     g_lastDirtyMs = millis() - app::kSettingsSaveDebounceMs;
 
-    Serial.println("[settings] migrated legacy-sized v2 state to v3");
+    Serial.println("[settings] migrated legacy-sized v2 state to v5");
     return true;
   }
 
@@ -884,7 +1160,7 @@ bool loadLegacyV1(app::AppState& state) {
     radio.bandIndex = inferBandIndexFromFrequency(radio.frequencyKhz, radio.modulation);
   }
 
-  PersistedPayloadV3 migrated{};
+  PersistedPayloadV5 migrated{};
   fillPayloadFromState(state, migrated);
 
   migrated.radio.bandIndex = radio.bandIndex;
@@ -918,20 +1194,20 @@ bool loadLegacyV1(app::AppState& state) {
   g_dirty = true;
   g_lastDirtyMs = millis() - app::kSettingsSaveDebounceMs;
 
-  Serial.println("[settings] migrated legacy v1 state to v3");
+  Serial.println("[settings] migrated legacy v1 state to v5");
   return true;
 }
 
 void saveNow(const app::AppState& state) {
-  PersistedBlobV3 blob{};
+  PersistedBlobV5 blob{};
   blob.magic = kMagic;
-  blob.schema = kSchemaV3;
-  blob.payloadSize = sizeof(PersistedPayloadV3);
+  blob.schema = kSchemaV5;
+  blob.payloadSize = sizeof(PersistedPayloadV5);
 
   fillPayloadFromState(state, blob.payload);
   sanitizePayload(blob.payload);
 
-  blob.checksum = checksumForBytes(reinterpret_cast<const uint8_t*>(&blob.payload), sizeof(PersistedPayloadV3));
+  blob.checksum = checksumForBytes(reinterpret_cast<const uint8_t*>(&blob.payload), sizeof(PersistedPayloadV5));
 
   const size_t written = g_prefs.putBytes(kBlobKey, &blob, sizeof(blob));
   if (written != sizeof(blob)) {
@@ -961,6 +1237,14 @@ bool load(app::AppState& state) {
     return false;
   }
 
+  if (loadV5Blob(state)) {
+    return true;
+  }
+
+  if (loadV4Blob(state)) {
+    return true;
+  }
+
   if (loadV3Blob(state)) {
     return true;
   }
@@ -0,0 +1,948 @@
+#if defined(APP_TUNER_SIM)
+
+#include <Arduino.h>
+
+#include <string.h>
+
+#include "../../include/tuner_sim.h"
+
+namespace services::radio::sim {
+namespace {
+
+// RDS runs at 1187.5 bit/s, 104 bits per group: one group every ~87.6 ms.
+constexpr uint32_t kRdsGroupPeriodMs = 88;
+constexpr uint8_t kRdsFifoDepth = 25;
+constexpr uint32_t kRdsSyncAcquireMs = 120;
+constexpr uint16_t kRdsCtMjd = 60000;
+
+constexpr SimCarrier kDefaultFmCarriers[] = {
+    {8790, 48, 22, 10, 0, true, 4, 0x2201, 10, "CLASSIC ", "Morning concert with the city symphony orchestra"},
+    {9040, 62, 30, 15, 1, true, 2, 0x2202, 1, "NEWS 904", "Traffic and weather together on the nines"},
+    {9110, 20, 6, 10, 3, false, 35, 0, 0, nullptr, nullptr},
+    {9580, 55, 26, 15, -1, true, 6, 0x2204, 10, "POP 958 ", "Now playing: the countdown"},
+    {9600, 30, 9, 10, 2, false, 20, 0x2205, 5, "ROCK 96 ", nullptr},
+    {10210, 44, 18, 10, 0, true, 10, 0x2206, 3, "TALK    ", "Call in now"},
+    {10590, 12, 3, 10, 4, false, 60, 0, 0, nullptr, nullptr},
+};
+
+constexpr SimCarrier kDefaultMwCarriers[] = {
+    {531, 40, 18, 4, 0, false, 0, 0, 0, nullptr, nullptr},
+    {693, 52, 24, 5, 0, false, 0, 0, 0, nullptr, nullptr},
+    {810, 28, 11, 4, 0, false, 0, 0, 0, nullptr, nullptr},
+    {909, 46, 20, 5, 0, false, 0, 0, 0, nullptr, nullptr},
+    {1089, 36, 14, 4, 0, false, 0, 0, 0, nullptr, nullptr},
+    {1215, 22, 7, 4, 0, false, 0, 0, 0, nullptr, nullptr},
+    {1548, 44, 19, 5, 0, false, 0, 0, 0, nullptr, nullptr},
+};
+
+// 49m broadcast band at night: mostly empty raster with one cluster of adjacent channels.
+constexpr SimCarrier kDefaultSwCarriers[] = {
+    {5825, 30, 12, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5905, 44, 19, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6070, 38, 15, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6075, 26, 9, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6080, 41, 17, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6155, 50, 22, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6280, 24, 8, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+};
+
+constexpr SimScenario kDefaultFmScenario = {
+    kDefaultFmCarriers,
+    static_cast<uint8_t>(sizeof(kDefaultFmCarriers) / sizeof(kDefaultFmCarriers[0])),
+    4,
+    0,
+    1,
+    25,
+    40,
+    8,
+    0x5EED0001UL,
+};
+
+constexpr SimScenario kDefaultMwScenario = {
+    kDefaultMwCarriers,
+    static_cast<uint8_t>(sizeof(kDefaultMwCarriers) / sizeof(kDefaultMwCarriers[0])),
+    8,
+    0,
+    2,
+    70,
+    60,
+    255,
+    0x5EED0002UL,
+};
+
+constexpr SimScenario kDefaultSwScenario = {
+    kDefaultSwCarriers,
+    static_cast<uint8_t>(sizeof(kDefaultSwCarriers) / sizeof(kDefaultSwCarriers[0])),
+    8,
+    0,
+    2,
+    70,
+    25,
+    255,
+    0x5EED0003UL,
+};
+
+// --- Benchmark library (host scan benchmark) ---
+
+// Dense urban FM: a transmitter every 300-600 kHz, several strong ones with wide skirts, two on the
+// adjacent 200 kHz channel, mixed pilot and multipath.
+constexpr SimCarrier kUrbanFmCarriers[] = {
+    {8770, 52, 24, 15, 0, true, 5, 0, 0, nullptr, nullptr},
+    {8810, 38, 15, 10, 1, true, 12, 0, 0, nullptr, nullptr},
+    {8860, 60, 28, 15, -1, true, 3, 0, 0, nullptr, nullptr},
+    {8900, 33, 12, 10, 2, false, 25, 0, 0, nullptr, nullptr},
+    {8950, 47, 21, 12, 0, true, 8, 0, 0, nullptr, nullptr},
+    {9010, 65, 30, 18, 0, true, 2, 0, 0, nullptr, nullptr},
+    {9030, 29, 10, 10, 3, false, 30, 0, 0, nullptr, nullptr},
+    {9080, 44, 19, 12, -2, true, 9, 0, 0, nullptr, nullptr},
+    {9140, 55, 25, 15, 1, true, 4, 0, 0, nullptr, nullptr},
+    {9190, 36, 14, 10, 0, false, 18, 0, 0, nullptr, nullptr},
+    {9250, 49, 22, 12, 0, true, 6, 0, 0, nullptr, nullptr},
+    {9300, 41, 17, 10, -1, true, 14, 0, 0, nullptr, nullptr},
+    {9370, 58, 27, 15, 0, true, 3, 0, 0, nullptr, nullptr},
+    {9430, 31, 11, 10, 2, false, 28, 0, 0, nullptr, nullptr},
+    {9480, 46, 20, 12, 1, true, 7, 0, 0, nullptr, nullptr},
+    {9540, 62, 29, 18, 0, true, 2, 0, 0, nullptr, nullptr},
+    {9560, 34, 13, 10, -3, false, 22, 0, 0, nullptr, nullptr},
+    {9620, 43, 18, 12, 0, true, 10, 0, 0, nullptr, nullptr},
+    {9690, 53, 24, 15, 1, true, 5, 0, 0, nullptr, nullptr},
+    {9750, 37, 15, 10, 0, false, 16, 0, 0, nullptr, nullptr},
+    {9810, 50, 23, 12, -1, true, 6, 0, 0, nullptr, nullptr},
+    {9880, 40, 16, 10, 2, true, 13, 0, 0, nullptr, nullptr},
+    {9940, 57, 26, 15, 0, true, 4, 0, 0, nullptr, nullptr},
+    {10000, 32, 12, 10, 1, false, 26, 0, 0, nullptr, nullptr},
+    {10050, 48, 21, 12, 0, true, 8, 0, 0, nullptr, nullptr},
+    {10120, 61, 28, 15, -1, true, 3, 0, 0, nullptr, nullptr},
+    {10180, 35, 13, 10, 0, false, 20, 0, 0, nullptr, nullptr},
+    {10240, 45, 19, 12, 2, true, 9, 0, 0, nullptr, nullptr},
+    {10300, 54, 25, 15, 0, true, 5, 0, 0, nullptr, nullptr},
+    {10370, 39, 16, 10, -2, true, 15, 0, 0, nullptr, nullptr},
+    {10430, 51, 23, 12, 0, true, 6, 0, 0, nullptr, nullptr},
+    {10500, 42, 17, 10, 1, false, 12, 0, 0, nullptr, nullptr},
+    {10570, 59, 27, 15, 0, true, 4, 0, 0, nullptr, nullptr},
+    {10640, 30, 11, 10, 3, false, 32, 0, 0, nullptr, nullptr},
+    {10720, 47, 20, 12, 0, true, 7, 0, 0, nullptr, nullptr},
+};
+
+// Weak DX: distant transmitters a few dB above a jittery floor, some right at the default sensitivity.
+constexpr SimCarrier kDxFmCarriers[] = {
+    {8830, 10, 3, 5, 2, false, 40, 0, 0, nullptr, nullptr},
+    {8970, 8, 2, 5, -3, false, 55, 0, 0, nullptr, nullptr},
+    {9160, 14, 5, 8, 1, false, 30, 0, 0, nullptr, nullptr},
+    {9350, 9, 3, 5, 4, false, 45, 0, 0, nullptr, nullptr},
+    {9590, 12, 4, 5, 0, true, 35, 0, 0, nullptr, nullptr},
+    {9820, 7, 2, 5, -2, false, 60, 0, 0, nullptr, nullptr},
+    {10060, 11, 3, 8, 3, false, 42, 0, 0, nullptr, nullptr},
+    {10290, 16, 6, 8, -1, false, 28, 0, 0, nullptr, nullptr},
+    {10480, 8, 2, 5, 2, false, 50, 0, 0, nullptr, nullptr},
+    {10690, 10, 3, 5, 0, false, 38, 0, 0, nullptr, nullptr},
+};
+
+// Adjacent-channel splatter: strong local transmitters whose skirts reach +-250 kHz, each with a weak
+// station 200-300 kHz away that is only distinguishable by its own peak.
+constexpr SimCarrier kSplatterFmCarriers[] = {
+    {8900, 72, 32, 25, 0, true, 2, 0, 0, nullptr, nullptr},
+    {8920, 30, 10, 8, 2, false, 20, 0, 0, nullptr, nullptr},
+    {9370, 34, 12, 8, -2, true, 15, 0, 0, nullptr, nullptr},
+    {9400, 75, 34, 25, 0, true, 1, 0, 0, nullptr, nullptr},
+    {9430, 28, 9, 8, 3, false, 25, 0, 0, nullptr, nullptr},
+    {9900, 70, 31, 25, 0, true, 2, 0, 0, nullptr, nullptr},
+    {9930, 36, 13, 8, 1, true, 12, 0, 0, nullptr, nullptr},
+    {10380, 29, 9, 8, -1, false, 22, 0, 0, nullptr, nullptr},
+    {10400, 74, 33, 25, 0, true, 1, 0, 0, nullptr, nullptr},
+    {10650, 45, 20, 12, 0, true, 6, 0, 0, nullptr, nullptr},
+};
+
+// 41m/49m evening: crowded 5 kHz raster with runs of adjacent channels, fading (jitter) and a raised floor.
+constexpr SimCarrier kSwEveningCarriers[] = {
+    {5830, 34, 13, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5850, 28, 10, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5860, 45, 19, 3, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5865, 31, 11, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5895, 39, 16, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5920, 52, 23, 3, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5935, 26, 9, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5950, 47, 20, 3, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5955, 33, 12, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5960, 41, 17, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {5985, 30, 11, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6000, 55, 25, 3, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6010, 36, 14, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6030, 43, 18, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6040, 27, 9, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6055, 49, 21, 3, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6070, 38, 15, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6090, 32, 12, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6100, 46, 19, 3, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6115, 29, 10, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6135, 40, 16, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6145, 35, 13, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6160, 50, 22, 3, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6175, 31, 11, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+    {6190, 42, 17, 2, 0, false, 0, 0, 0, nullptr, nullptr},
+};
+
+constexpr SimScenario kUrbanFmScenario = {
+    kUrbanFmCarriers,
+    static_cast<uint16_t>(sizeof(kUrbanFmCarriers) / sizeof(kUrbanFmCarriers[0])),
+    6,
+    0,
+    2,
+    25,
+    40,
+    8,
+    0x5EED0101UL,
+};
+
+constexpr SimScenario kDxFmScenario = {
+    kDxFmCarriers,
+    static_cast<uint16_t>(sizeof(kDxFmCarriers) / sizeof(kDxFmCarriers[0])),
+    4,
+    0,
+    2,
+    25,
+    40,
+    8,
+    0x5EED0102UL,
+};
+
+constexpr SimScenario kSplatterFmScenario = {
+    kSplatterFmCarriers,
+    static_cast<uint16_t>(sizeof(kSplatterFmCarriers) / sizeof(kSplatterFmCarriers[0])),
+    4,
+    0,
+    1,
+    25,
+    40,
+    8,
+    0x5EED0103UL,
+};
+
+constexpr SimScenario kSwEveningScenario = {
+    kSwEveningCarriers,
+    static_cast<uint16_t>(sizeof(kSwEveningCarriers) / sizeof(kSwEveningCarriers[0])),
+    12,
+    1,
+    3,
+    70,
+    25,
+    255,
+    0x5EED0104UL,
+};
+
+// Regional RDS network: one programme (PI 0x2202) on three transmitters of different strength, two other
+// programmes heard as EON, and a music station tagging artist and title with RT+.
+constexpr SimCarrier kRdsNetworkFmCarriers[] = {
+    {8830, 34, 13, 10, 0, true, 8, 0x2202, 1, "NEWS 904", "Traffic and weather together on the nines"},
+    {9040, 58, 28, 15, 1, true, 2, 0x2202, 1, "NEWS 904", "Traffic and weather together on the nines"},
+    {9580, 55, 26, 15, -1, true, 6, 0x2204, 10, "POP 958 ", "Now playing: The Northern Lines - Harbour Lights"},
+    {10210, 44, 18, 10, 0, true, 10, 0x2206, 3, "TALK    ", "Call in now"},
+    {10470, 26, 9, 10, 0, true, 12, 0x2202, 1, "NEWS 904", "Traffic and weather together on the nines"},
+};
+
+constexpr SimScenario kRdsNetworkFmScenario = {
+    kRdsNetworkFmCarriers,
+    static_cast<uint16_t>(sizeof(kRdsNetworkFmCarriers) / sizeof(kRdsNetworkFmCarriers[0])),
+    4,
+    0,
+    1,
+    25,
+    40,
+    8,
+    0x5EED0201UL,
+};
+
+constexpr uint8_t kRdsAfListMax = 25;
+constexpr uint16_t kRtPlusAid = 0x4BD7;
+constexpr uint8_t kRtPlusGroupType = 11;
+
+SimScenario g_scenario = kDefaultFmScenario;
+SimStats g_stats{};
+bool g_afMethodB = false;
+uint16_t g_afExtraKhz = 0;
+uint16_t g_fadeKhz = 0;
+uint8_t g_fadeDb = 0;
+uint8_t g_blockErrorPercent = 0;
+// RSQ reads per raster point since loadScenario(): the jitter of a reading depends only on the scenario seed,
+// the frequency and how often that frequency was read, so a scan's noise does not shift with whatever ran
+// before it in the process. Indexed by kHz modulo the table size; a scenario spans far less than that.
+constexpr uint16_t kRsqReadSlots = 4096;
+uint16_t g_rsqReads[kRsqReadSlots] = {};
+
+// Trace playback: the harness queues recorded groups into a FIFO of the chip's depth and sets the RSQ levels.
+struct PlaybackGroup {
+  uint16_t blocks[4];
+  uint8_t ble[4];
+  bool syncFound;
+  bool groupLost;
+};
+bool g_playback = false;
+PlaybackGroup g_playbackFifo[kRdsFifoDepth];
+uint8_t g_playbackHead = 0;
+uint8_t g_playbackCount = 0;
+bool g_playbackSync = false;
+bool g_playbackLost = false;
+uint8_t g_playbackRssi = 0;
+uint8_t g_playbackSnr = 0;
+
+void clearPlaybackFifo() {
+  g_playbackHead = 0;
+  g_playbackCount = 0;
+  g_playbackSync = false;
+  g_playbackLost = false;
+}
+
+// Carrier peak after the fade knob: the faded carrier loses dropDb of RSSI and SNR (not below the floor).
+uint8_t fadedPeak(const SimCarrier& carrier, uint8_t peak, uint8_t floor) {
+  if (carrier.frequencyKhz != g_fadeKhz || g_fadeDb == 0) {
+    return peak;
+  }
+  return peak > floor + g_fadeDb ? static_cast<uint8_t>(peak - g_fadeDb) : floor;
+}
+
+uint32_t mixHash(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7FEB352DUL;
+  x ^= x >> 15;
+  x *= 0x846CA68BUL;
+  x ^= x >> 16;
+  return x;
+}
+
+int8_t jitterFor(uint16_t frequencyKhz) {
+  if (g_scenario.jitter == 0) {
+    return 0;
+  }
+  const uint32_t sequence = g_rsqReads[frequencyKhz % kRsqReadSlots]++;
+  const uint32_t h = mixHash(g_scenario.seed ^ (static_cast<uint32_t>(frequencyKhz) << 12) ^ sequence);
+  const uint32_t span = static_cast<uint32_t>(g_scenario.jitter) * 2U + 1U;
+  return static_cast<int8_t>(static_cast<int32_t>(h % span) - g_scenario.jitter);
+}
+
+uint8_t clampLevel(int32_t value) {
+  if (value < 0) {
+    return 0;
+  }
+  if (value > 127) {
+    return 127;
+  }
+  return static_cast<uint8_t>(value);
+}
+
+uint16_t distanceKhz(uint16_t a, uint16_t b) { return a >= b ? static_cast<uint16_t>(a - b) : static_cast<uint16_t>(b - a); }
+
+// Linear falloff from the carrier peak to the floor across halfWidthKhz + 1 tuner units.
+uint8_t levelAt(uint8_t peak, uint8_t floor, uint16_t distance, uint8_t halfWidthKhz) {
+  if (peak <= floor) {
+    return floor;
+  }
+  const uint32_t span = static_cast<uint32_t>(halfWidthKhz) + 1U;
+  if (distance >= span) {
+    return floor;
+  }
+  return static_cast<uint8_t>(peak - ((peak - floor) * distance) / span);
+}
+
+const SimCarrier* strongestCarrierAt(uint16_t frequencyKhz, uint16_t* outDistance) {
+  const SimCarrier* best = nullptr;
+  uint8_t bestLevel = 0;
+  for (uint16_t i = 0; i < g_scenario.carrierCount; ++i) {
+    const SimCarrier& c = g_scenario.carriers[i];
+    const uint16_t d = distanceKhz(c.frequencyKhz, frequencyKhz);
+    if (d > c.halfWidthKhz) {
+      continue;
+    }
+    const uint8_t level = levelAt(c.rssi, g_scenario.noiseRssi, d, c.halfWidthKhz);
+    if (best == nullptr || level > bestLevel) {
+      best = &c;
+      bestLevel = level;
+      if (outDistance != nullptr) {
+        *outDistance = d;
+      }
+    }
+  }
+  return best;
+}
+
+uint8_t psChar(const char* text, uint8_t index) {
+  if (text == nullptr) {
+    return ' ';
+  }
+  const size_t len = strlen(text);
+  return index < len ? static_cast<uint8_t>(text[index]) : ' ';
+}
+
+uint8_t rtSegmentCount(const char* text) {
+  if (text == nullptr) {
+    return 0;
+  }
+  size_t len = strlen(text);
+  if (len > 64) {
+    len = 64;
+  }
+  // One extra character for the 0x0D terminator when the text is shorter than 64.
+  const size_t chars = len < 64 ? len + 1 : len;
+  return static_cast<uint8_t>((chars + 3) / 4);
+}
+
+uint8_t rtChar(const char* text, uint8_t index) {
+  const size_t len = strlen(text);
+  if (index < len && index < 64) {
+    return static_cast<uint8_t>(text[index]);
+  }
+  return index == len ? 0x0D : ' ';
+}
+
+uint8_t afCode(uint16_t frequencyKhz) {
+  return (frequencyKhz > 8750 && frequencyKhz <= 10790) ? static_cast<uint8_t>((frequencyKhz - 8750) / 10) : 0;
+}
+
+// AF codes of every carrier sharing this carrier's PI, itself included, ascending.
+uint8_t networkAfCodes(const SimCarrier& carrier, uint8_t* codes) {
+  uint8_t count = 0;
+  for (uint16_t i = 0; i < g_scenario.carrierCount && count < kRdsAfListMax; ++i) {
+    const SimCarrier& c = g_scenario.carriers[i];
+    if (c.rdsPi == carrier.rdsPi && afCode(c.frequencyKhz) != 0) {
+      codes[count++] = afCode(c.frequencyKhz);
+    }
+  }
+  if (g_afExtraKhz != 0 && g_afExtraKhz != carrier.frequencyKhz && count > 0 && count < kRdsAfListMax) {
+    uint8_t at = count;
+    while (at > 0 && codes[at - 1] > afCode(g_afExtraKhz)) {
+      codes[at] = codes[at - 1];
+      --at;
+    }
+    codes[at] = afCode(g_afExtraKhz);
+    ++count;
+  }
+  return count;
+}
+
+// The pair of AF codes a 0A group carries in block C, cycling through the list. Method A sends the count and
+// the list; method B sends the count with the own frequency, then one (own, alternative) pair per entry.
+uint16_t afPair(const SimCarrier& carrier, uint32_t ordinal) {
+  uint8_t codes[kRdsAfListMax];
+  const uint8_t count = networkAfCodes(carrier, codes);
+  if (count <= 1) {
+    return 0xE0CD;  // no AF list, filler
+  }
+  uint8_t seq[2 * kRdsAfListMax + 2];
+  uint8_t len = 0;
+  if (!g_afMethodB) {
+    seq[len++] = static_cast<uint8_t>(224 + count);
+    for (uint8_t i = 0; i < count; ++i) {
+      seq[len++] = codes[i];
+    }
+  } else {
+    const uint8_t own = afCode(carrier.frequencyKhz);
+    seq[len++] = static_cast<uint8_t>(224 + 2 * (count - 1) + 1);
+    seq[len++] = own;
+    for (uint8_t i = 0; i < count; ++i) {
+      if (codes[i] == own) {
+        continue;
+      }
+      seq[len++] = own < codes[i] ? own : codes[i];
+      seq[len++] = own < codes[i] ? codes[i] : own;
+    }
+  }
+  if (len % 2 != 0) {
+    seq[len++] = 205;
+  }
+  const uint8_t pair = static_cast<uint8_t>(ordinal % (len / 2));
+  return static_cast<uint16_t>((seq[pair * 2] << 8) | seq[pair * 2 + 1]);
+}
+
+// The ordinal-th other programme (distinct PI) for EON, in scenario order.
+const SimCarrier* eonCarrier(const SimCarrier& carrier, uint32_t ordinal, uint8_t* outCount) {
+  const SimCarrier* others[8];
+  uint8_t count = 0;
+  for (uint16_t i = 0; i < g_scenario.carrierCount && count < 8; ++i) {
+    const SimCarrier& c = g_scenario.carriers[i];
+    if (c.rdsPi == 0 || c.rdsPi == carrier.rdsPi) {
+      continue;
+    }
+    bool seen = false;
+    for (uint8_t j = 0; j < count; ++j) {
+      seen |= others[j]->rdsPi == c.rdsPi;
+    }
+    if (!seen) {
+      others[count++] = &c;
+    }
+  }
+  *outCount = count;
+  return count == 0 ? nullptr : others[ordinal % count];
+}
+
+// RT+ tags for an "...: ARTIST - TITLE" radiotext: title as the first tag, artist as the second.
+bool rtPlusTags(const char* rt, uint8_t* titleStart, uint8_t* titleLen, uint8_t* artistStart, uint8_t* artistLen) {
+  if (rt == nullptr) {
+    return false;
+  }
+  const char* colon = strstr(rt, ": ");
+  const char* artist = colon != nullptr ? colon + 2 : rt;
+  const char* dash = strstr(artist, " - ");
+  if (dash == nullptr || dash == artist) {
+    return false;
+  }
+  const size_t len = strlen(rt) < 64 ? strlen(rt) : 64;
+  const size_t title = static_cast<size_t>(dash - rt) + 3;
+  if (title >= len || dash - artist > 32 || len - title > 64) {
+    return false;
+  }
+  *artistStart = static_cast<uint8_t>(artist - rt);
+  *artistLen = static_cast<uint8_t>(dash - artist);
+  *titleStart = static_cast<uint8_t>(title);
+  *titleLen = static_cast<uint8_t>(len - title);
+  return true;
+}
+
+}  // namespace
+
+void loadScenario(const SimScenario& scenario) {
+  g_scenario = scenario;
+  memset(g_rsqReads, 0, sizeof(g_rsqReads));
+  resetStats();
+}
+
+const SimScenario& scenario() { return g_scenario; }
+
+const SimStats& stats() { return g_stats; }
+
+void resetStats() { g_stats = SimStats{}; }
+
+const SimScenario& defaultFmScenario() { return kDefaultFmScenario; }
+
+const SimScenario& defaultMwScenario() { return kDefaultMwScenario; }
+
+const SimScenario& defaultSwScenario() { return kDefaultSwScenario; }
+
+const SimScenario& urbanFmScenario() { return kUrbanFmScenario; }
+
+const SimScenario& dxFmScenario() { return kDxFmScenario; }
+
+const SimScenario& splatterFmScenario() { return kSplatterFmScenario; }
+
+const SimScenario& swEveningScenario() { return kSwEveningScenario; }
+
+const SimScenario& rdsNetworkFmScenario() { return kRdsNetworkFmScenario; }
+
+void setAfMethodB(bool methodB) { g_afMethodB = methodB; }
+
+void setAfExtra(uint16_t frequencyKhz) { g_afExtraKhz = frequencyKhz; }
+
+void setCarrierFade(uint16_t frequencyKhz, uint8_t dropDb) {
+  g_fadeKhz = frequencyKhz;
+  g_fadeDb = dropDb;
+}
+
+void setRdsBlockErrors(uint8_t percent) { g_blockErrorPercent = percent > 100 ? 100 : percent; }
+
+void setRdsPlayback(bool enabled) {
+  g_playback = enabled;
+  clearPlaybackFifo();
+}
+
+void queueRdsGroup(const uint16_t blocks[4], const uint8_t ble[4], bool syncFound, bool groupLost) {
+  if (!g_playback) {
+    return;
+  }
+  if (g_playbackCount == kRdsFifoDepth) {
+    // Oldest group falls out of the chip FIFO, as on air.
+    g_playbackHead = static_cast<uint8_t>((g_playbackHead + 1) % kRdsFifoDepth);
+    --g_playbackCount;
+    ++g_stats.rdsGroupsLost;
+    g_playbackLost = true;
+  }
+  PlaybackGroup& group = g_playbackFifo[(g_playbackHead + g_playbackCount) % kRdsFifoDepth];
+  memcpy(group.blocks, blocks, sizeof(group.blocks));
+  memcpy(group.ble, ble, sizeof(group.ble));
+  group.syncFound = syncFound;
+  group.groupLost = groupLost;
+  ++g_playbackCount;
+}
+
+void setPlaybackRsq(uint8_t rssi, uint8_t snr) {
+  g_playbackRssi = rssi;
+  g_playbackSnr = snr;
+}
+
+void SimTuner::setFM(uint16_t minKhz, uint16_t maxKhz, uint16_t frequencyKhz, uint16_t stepKhz) {
+  fm_ = true;
+  minKhz_ = minKhz;
+  maxKhz_ = maxKhz;
+  stepKhz_ = stepKhz;
+  setSeekLimits(minKhz, maxKhz);
+  retune(frequencyKhz);
+}
+
+void SimTuner::setAM(uint16_t minKhz, uint16_t maxKhz, uint16_t frequencyKhz, uint16_t stepKhz) {
+  fm_ = false;
+  minKhz_ = minKhz;
+  maxKhz_ = maxKhz;
+  stepKhz_ = stepKhz;
+  setSeekLimits(minKhz, maxKhz);
+  retune(frequencyKhz);
+}
+
+void SimTuner::setSSB(uint16_t minKhz, uint16_t maxKhz, uint16_t frequencyKhz, uint16_t stepKhz, uint8_t usblsb) {
+  (void)usblsb;
+  setAM(minKhz, maxKhz, frequencyKhz, stepKhz);
+}
+
+void SimTuner::setFrequency(uint16_t frequencyKhz) { retune(frequencyKhz); }
+
+void SimTuner::retune(uint16_t frequencyKhz) {
+  if (frequencyKhz < minKhz_) {
+    frequencyKhz = minKhz_;
+  } else if (frequencyKhz > maxKhz_) {
+    frequencyKhz = maxKhz_;
+  }
+  seeking_ = false;  // a tune ends a running seek
+  frequencyKhz_ = frequencyKhz;
+  tunedAtMs_ = millis();
+  rdsClockMs_ = tunedAtMs_;
+  rdsGroupIndex_ = 0;
+  rdsFifo_ = 0;
+  rdsSync_ = false;
+  rdsGroupLost_ = false;
+  clearPlaybackFifo();
+  ++g_stats.tunes;
+  g_stats.lastTuneKhz = frequencyKhz_;
+  g_stats.lastTuneMs = tunedAtMs_;
+}
+
+void SimTuner::sampleAt(uint16_t frequencyKhz, uint32_t sinceTuneMs) {
+  if (g_playback) {
+    // The recorded levels, without advancing the noise sequence the synthetic band uses.
+    rsqRssi_ = g_playbackRssi;
+    rsqSnr_ = g_playbackSnr;
+    rsqFreqOff_ = 0;
+    rsqPilot_ = true;
+    rsqMultipath_ = 0;
+    return;
+  }
+  uint16_t distance = 0;
+  const SimCarrier* carrier = strongestCarrierAt(frequencyKhz, &distance);
+  uint8_t rssi = g_scenario.noiseRssi;
+  uint8_t snr = g_scenario.noiseSnr;
+  int8_t freqOff = 0;
+  bool pilot = false;
+  uint8_t multipath = 0;
+
+  if (carrier != nullptr) {
+    rssi = levelAt(fadedPeak(*carrier, carrier->rssi, g_scenario.noiseRssi), g_scenario.noiseRssi, distance,
+                   carrier->halfWidthKhz);
+    snr = levelAt(fadedPeak(*carrier, carrier->snr, g_scenario.noiseSnr), g_scenario.noiseSnr, distance,
+                  carrier->halfWidthKhz);
+    if (fm_) {
+      // FM tuner units are 10 kHz; FREQOFF reports the residual in ~1 kHz units.
+      const int32_t delta = (static_cast<int32_t>(carrier->frequencyKhz) - frequencyKhz) * 10 + carrier->freqOffKhz;
+      freqOff = static_cast<int8_t>(delta > 127 ? 127 : (delta < -127 ? -127 : delta));
+      pilot = carrier->pilot && distance * 2U <= carrier->halfWidthKhz;
+      multipath = carrier->multipath;
+    }
+  }
+
+  // Model the AGC/RSQ ramp: readings taken before the settle time under-report the carrier.
+  if (g_scenario.settleMs > 0 && sinceTuneMs < g_scenario.settleMs) {
+    rssi = static_cast<uint8_t>(g_scenario.noiseRssi + ((rssi - g_scenario.noiseRssi) * sinceTuneMs) / g_scenario.settleMs);
+    snr = static_cast<uint8_t>(g_scenario.noiseSnr + ((snr - g_scenario.noiseSnr) * sinceTuneMs) / g_scenario.settleMs);
+    pilot = false;
+  }
+
+  const int8_t noise = jitterFor(frequencyKhz);
+  rsqRssi_ = clampLevel(static_cast<int32_t>(rssi) + noise);
+  rsqSnr_ = clampLevel(static_cast<int32_t>(snr) + (snr > 0 ? noise : 0));
+  rsqFreqOff_ = freqOff;
+  rsqPilot_ = pilot;
+  rsqMultipath_ = multipath;
+}
+
+void SimTuner::getCurrentReceivedSignalQuality() {
+  ++g_stats.rsqReads;
+  sampleAt(frequencyKhz_, static_cast<uint32_t>(millis() - tunedAtMs_));
+}
+
+void SimTuner::seekStation(uint8_t seekUp, uint8_t wrap) {
+  (void)wrap;  // radio_service never asks for wrap; the seek stops at the limit instead
+  seeking_ = true;
+  seekUp_ = seekUp != 0;
+  seekStepsDone_ = 0;
+  seekStartMs_ = millis();
+  statusStc_ = false;
+  statusValid_ = false;
+  statusBandLimit_ = false;
+}
+
+void SimTuner::getStatus(uint8_t intAck, uint8_t cancel) {
+  if (intAck != 0) {
+    statusStc_ = false;
+  }
+  if (!seeking_) {
+    return;
+  }
+  if (cancel != 0) {
+    finishSeek(false, false);
+    return;
+  }
+
+  // Catch up with the raster points the seek has covered since SEEK_START.
+  const uint16_t spacing = seekSpacingKhz_ == 0 ? 1 : seekSpacingKhz_;
+  const uint32_t stepMs = g_scenario.seekStepMs == 0 ? 1 : g_scenario.seekStepMs;
+  const uint32_t due = static_cast<uint32_t>(millis() - seekStartMs_) / stepMs;
+  while (seekStepsDone_ < due) {
+    if (seekUp_ ? frequencyKhz_ >= seekMaxKhz_ : frequencyKhz_ <= seekMinKhz_) {
+      finishSeek(false, true);
+      return;
+    }
+    if (seekUp_) {
+      frequencyKhz_ = static_cast<uint16_t>(frequencyKhz_ + spacing > seekMaxKhz_ ? seekMaxKhz_ : frequencyKhz_ + spacing);
+    } else {
+      frequencyKhz_ = static_cast<uint16_t>(frequencyKhz_ < seekMinKhz_ + spacing ? seekMinKhz_ : frequencyKhz_ - spacing);
+    }
+    ++seekStepsDone_;
+    ++g_stats.seekSteps;
+    sampleAt(frequencyKhz_, g_scenario.settleMs);
+    if (rsqRssi_ >= seekRssiMin_ && rsqSnr_ >= seekSnrMin_) {
+      finishSeek(true, false);
+      return;
+    }
+  }
+}
+
+void SimTuner::finishSeek(bool valid, bool bandLimit) {
+  seeking_ = false;
+  statusStc_ = true;
+  statusValid_ = valid;
+  statusBandLimit_ = bandLimit;
+  retune(frequencyKhz_);
+  // Seek ends with the tuner already settled on the stop channel.
+  tunedAtMs_ = millis() - g_scenario.settleMs;
+}
+
+const SimCarrier* SimTuner::rdsCarrier() const {
+  if (!fm_) {
+    return nullptr;
+  }
+  uint16_t distance = 0;
+  const SimCarrier* carrier = strongestCarrierAt(frequencyKhz_, &distance);
+  if (carrier == nullptr || carrier->rdsPi == 0 || distance * 2U > carrier->halfWidthKhz) {
+    return nullptr;
+  }
+  if (fadedPeak(*carrier, carrier->snr, g_scenario.noiseSnr) < g_scenario.rdsMinSnr) {
+    return nullptr;
+  }
+  return carrier;
+}
+
+void SimTuner::buildGroup(const SimCarrier& carrier, uint16_t blocks[4]) {
+  const uint32_t index = rdsGroupIndex_++;
+  const uint8_t rtSegments = rtSegmentCount(carrier.rdsRt);
+  blocks[0] = carrier.rdsPi;
+  const uint16_t ptyBits = static_cast<uint16_t>((carrier.rdsPty & 0x1F) << 5);
+
+  if (index % 32 == 31) {
+    // 4A clock-time group, fixed timestamp.
+    const uint16_t mjd = kRdsCtMjd;
+    const uint8_t hour = 12;
+    const uint8_t minute = static_cast<uint8_t>((millis() / 60000U) % 60U);
+    blocks[1] = static_cast<uint16_t>((4U << 12) | ptyBits | ((mjd >> 15) & 0x03));
+    blocks[2] = static_cast<uint16_t>(((mjd & 0x7FFF) << 1) | (hour >> 4));
+    blocks[3] = static_cast<uint16_t>(((hour & 0x0F) << 12) | (minute << 6));
+    return;
+  }
+
+  // 14A EON twice per 32 groups: each other programme in turn, PS segments then its AF.
+  uint8_t eonCount = 0;
+  const SimCarrier* on = eonCarrier(carrier, 0, &eonCount);
+  if (on != nullptr && (index % 32 == 15 || index % 32 == 23)) {
+    const uint32_t ordinal = (index / 32) * 2 + (index % 32 == 23 ? 1 : 0);
+    on = eonCarrier(carrier, ordinal, &eonCount);
+    const uint8_t variant = static_cast<uint8_t>((ordinal / eonCount) % 5);
+    blocks[1] = static_cast<uint16_t>((14U << 12) | ptyBits | variant);
+    blocks[2] = variant < 4 ? static_cast<uint16_t>((psChar(on->rdsPs, variant * 2) << 8) |
+                                                    psChar(on->rdsPs, variant * 2 + 1))
+                            : static_cast<uint16_t>((225U << 8) | afCode(on->frequencyKhz));
+    blocks[3] = on->rdsPi;
+    return;
+  }
+
+  // RT+: 3A announces the ODA on 11A, 11A tags title and artist in the radiotext.
+  uint8_t titleStart = 0, titleLen = 0, artistStart = 0, artistLen = 0;
+  if ((index % 32 == 11 || index % 32 == 27) &&
+      rtPlusTags(carrier.rdsRt, &titleStart, &titleLen, &artistStart, &artistLen)) {
+    if (index % 32 == 27) {
+      blocks[1] = static_cast<uint16_t>((3U << 12) | ptyBits | (kRtPlusGroupType << 1));
+      blocks[2] = 0x0000;
+      blocks[3] = kRtPlusAid;
+      return;
+    }
+    const uint8_t title = 1;   // ITEM.TITLE
+    const uint8_t artist = 4;  // ITEM.ARTIST
+    blocks[1] = static_cast<uint16_t>((static_cast<uint16_t>(kRtPlusGroupType) << 12) | ptyBits | (1U << 3) |
+                                      (title >> 3));
+    blocks[2] = static_cast<uint16_t>(((title & 0x07U) << 13) | (titleStart << 7) | ((titleLen - 1U) << 1) |
+                                      (artist >> 5));
+    blocks[3] = static_cast<uint16_t>(((artist & 0x1FU) << 11) | (artistStart << 5) | (artistLen - 1U));
+    return;
+  }
+
+  if (rtSegments == 0 || index % 2 == 0) {
+    const uint32_t ordinal = index / (rtSegments == 0 ? 1 : 2);
+    const uint8_t seg = static_cast<uint8_t>(ordinal % 4);
+    blocks[1] = static_cast<uint16_t>((0U << 12) | ptyBits | seg);
+    blocks[2] = afPair(carrier, ordinal);
+    blocks[3] = static_cast<uint16_t>((psChar(carrier.rdsPs, seg * 2) << 8) | psChar(carrier.rdsPs, seg * 2 + 1));
+    return;
+  }
+
+  const uint8_t seg = static_cast<uint8_t>((index / 2) % rtSegments);
+  const uint8_t base = static_cast<uint8_t>(seg * 4);
+  blocks[1] = static_cast<uint16_t>((2U << 12) | ptyBits | seg);
+  blocks[2] = static_cast<uint16_t>((rtChar(carrier.rdsRt, base) << 8) | rtChar(carrier.rdsRt, base + 1));
+  blocks[3] = static_cast<uint16_t>((rtChar(carrier.rdsRt, base + 2) << 8) | rtChar(carrier.rdsRt, base + 3));
+}
+
+void SimTuner::flushRdsFifo() {
+  rdsClockMs_ = millis();
+  rdsFifo_ = 0;
+  rdsGroupLost_ = false;
+  if (g_playback) {
+    g_playbackCount = 0;
+    g_playbackLost = false;
+  }
+}
+
+bool SimTuner::readPlaybackStatus(SimRdsStatus& out, uint8_t mtFifo, uint8_t statusOnly) {
+  out.resp.RDSSYNC = g_playbackSync || g_playbackCount > 0 ? 1 : 0;
+  if (mtFifo != 0) {
+    g_playbackCount = 0;
+  }
+  out.resp.GRPLOST = g_playbackLost ? 1 : 0;
+  out.resp.RDSFIFOUSED = g_playbackCount;
+  if (statusOnly != 0 || g_playbackCount == 0) {
+    return true;
+  }
+
+  const PlaybackGroup& group = g_playbackFifo[g_playbackHead];
+  g_playbackHead = static_cast<uint8_t>((g_playbackHead + 1) % kRdsFifoDepth);
+  --g_playbackCount;
+  out.resp.RDSSYNCFOUND = (group.syncFound || !g_playbackSync) ? 1 : 0;
+  out.resp.GRPLOST = (g_playbackLost || group.groupLost) ? 1 : 0;
+  g_playbackSync = true;
+  g_playbackLost = false;
+  ++g_stats.rdsGroups;
+
+  out.resp.RDSRECV = 1;
+  out.resp.RDSFIFOUSED = g_playbackCount;
+  out.resp.BLOCKAH = static_cast<uint8_t>(group.blocks[0] >> 8);
+  out.resp.BLOCKAL = static_cast<uint8_t>(group.blocks[0] & 0xFF);
+  out.resp.BLOCKBH = static_cast<uint8_t>(group.blocks[1] >> 8);
+  out.resp.BLOCKBL = static_cast<uint8_t>(group.blocks[1] & 0xFF);
+  out.resp.BLOCKCH = static_cast<uint8_t>(group.blocks[2] >> 8);
+  out.resp.BLOCKCL = static_cast<uint8_t>(group.blocks[2] & 0xFF);
+  out.resp.BLOCKDH = static_cast<uint8_t>(group.blocks[3] >> 8);
+  out.resp.BLOCKDL = static_cast<uint8_t>(group.blocks[3] & 0xFF);
+  out.resp.BLEA = group.ble[0];
+  out.resp.BLEB = group.ble[1];
+  out.resp.BLEC = group.ble[2];
+  out.resp.BLED = group.ble[3];
+  return true;
+}
+
+bool SimTuner::readRdsStatusRaw(SimRdsStatus& out, uint8_t intAck, uint8_t mtFifo, uint8_t statusOnly) {
+  (void)intAck;
+  ++g_stats.rdsReads;
+  out = SimRdsStatus{};
+  if (g_playback) {
+    return readPlaybackStatus(out, mtFifo, statusOnly);
+  }
+
+  const uint32_t nowMs = millis();
+  const SimCarrier* carrier = rdsCarrier();
+  if (carrier == nullptr) {
+    rdsClockMs_ = nowMs;
+    out.resp.RDSSYNCLOST = rdsSync_ ? 1 : 0;
+    rdsSync_ = false;
+    rdsFifo_ = 0;
+    return true;
+  }
+
+  const uint32_t sinceTuneMs = static_cast<uint32_t>(nowMs - tunedAtMs_);
+  if (sinceTuneMs < kRdsSyncAcquireMs) {
+    rdsClockMs_ = nowMs;
+    return true;
+  }
+  if (!rdsSync_) {
+    rdsSync_ = true;
+    out.resp.RDSSYNCFOUND = 1;
+  }
+  out.resp.RDSSYNC = 1;
+
+  const uint32_t arrived = static_cast<uint32_t>(nowMs - rdsClockMs_) / kRdsGroupPeriodMs;
+  rdsClockMs_ += arrived * kRdsGroupPeriodMs;
+  for (uint32_t i = 0; i < arrived; ++i) {
+    if (rdsFifo_ < kRdsFifoDepth) {
+      ++rdsFifo_;
+    } else {
+      // Oldest group falls out of the chip FIFO.
+      ++rdsGroupIndex_;
+      ++g_stats.rdsGroupsLost;
+      rdsGroupLost_ = true;
+    }
+  }
+
+  if (mtFifo != 0) {
+    rdsFifo_ = 0;
+  }
+  out.resp.GRPLOST = rdsGroupLost_ ? 1 : 0;
+  if (statusOnly != 0 || rdsFifo_ == 0) {
+    out.resp.RDSFIFOUSED = rdsFifo_;
+    return true;
+  }
+
+  uint16_t blocks[4] = {0, 0, 0, 0};
+  buildGroup(*carrier, blocks);
+  --rdsFifo_;
+  rdsGroupLost_ = false;
+  ++g_stats.rdsGroups;
+
+  // Marginal carriers get occasional uncorrectable C/D blocks.
+  const uint8_t errorRoll = static_cast<uint8_t>(mixHash(g_scenario.seed ^ rdsGroupIndex_ ^ carrier->rdsPi) & 0x0F);
+  const bool marginal = carrier->snr < static_cast<uint8_t>(g_scenario.rdsMinSnr + 8);
+
+  uint8_t bleC = (marginal && errorRoll < 3) ? 3 : 0;
+  uint8_t bleD = (marginal && errorRoll >= 3 && errorRoll < 5) ? 3 : 0;
+  for (uint8_t b = 0; g_blockErrorPercent != 0 && b < 2; ++b) {
+    const uint32_t hit = mixHash(g_scenario.seed ^ (rdsGroupIndex_ * 2U + b) ^ 0xB10C0000UL);
+    if (hit % 100U >= g_blockErrorPercent) {
+      continue;
+    }
+    uint8_t& ble = b == 0 ? bleC : bleD;
+    if (((hit >> 12) & 0x03) == 0) {
+      // Miscorrected: the decoder reports a fixed block that still carries a wrong character.
+      blocks[2 + b] = static_cast<uint16_t>(blocks[2 + b] ^ (1U << ((hit >> 16) & 0x0F)));
+      ble = 1;
+    } else {
+      ble = 3;
+    }
+  }
+
+  out.resp.RDSRECV = 1;
+  out.resp.RDSFIFOUSED = rdsFifo_;
+  out.resp.BLOCKAH = static_cast<uint8_t>(blocks[0] >> 8);
+  out.resp.BLOCKAL = static_cast<uint8_t>(blocks[0] & 0xFF);
+  out.resp.BLOCKBH = static_cast<uint8_t>(blocks[1] >> 8);
+  out.resp.BLOCKBL = static_cast<uint8_t>(blocks[1] & 0xFF);
+  out.resp.BLOCKCH = static_cast<uint8_t>(blocks[2] >> 8);
+  out.resp.BLOCKCL = static_cast<uint8_t>(blocks[2] & 0xFF);
+  out.resp.BLOCKDH = static_cast<uint8_t>(blocks[3] >> 8);
+  out.resp.BLOCKDL = static_cast<uint8_t>(blocks[3] & 0xFF);
+  out.resp.BLEC = bleC;
+  out.resp.BLED = bleD;
+  return true;
+}
+
+}  // namespace services::radio::sim
+
+#endif  // APP_TUNER_SIM
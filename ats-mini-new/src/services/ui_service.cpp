@@ -1,8 +1,15 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
 
+#include <stdlib.h>
 #include <string.h>
 
+#include <atomic>
+
 #include "../../include/app_services.h"
 #include "../../include/bandplan.h"
 #include "../../include/hardware_pins.h"
@@ -37,9 +44,18 @@ constexpr float kBatteryPctMaxVolts = 4.20f;
 #define ATS_UI_DEBUG_LOG 0
 #endif
 
+// Check every partial frame against a full redraw of the same state (costs a second frame buffer).
+#ifndef ATS_UI_VERIFY_PARTIAL
+#define ATS_UI_VERIFY_PARTIAL 0
+#endif
+
 TFT_eSPI g_tft = TFT_eSPI();
 TFT_eSprite g_spr = TFT_eSprite(&g_tft);
 bool g_tftReady = false;
+// Double buffering: frames are composed in g_spr while the display task streams the previous frame from
+// g_front to the panel. Without the second buffer (no PSRAM) render() pushes straight from g_spr.
+TFT_eSprite g_front = TFT_eSprite(&g_tft);
+bool g_frontReady = false;
 
 struct UiRenderKey {
   uint8_t layer;
@@ -82,11 +98,13 @@ struct UiRenderKey {
   uint16_t rdsCtMinuteOfDay;
   uint32_t rdsPsHash;
   uint32_t rdsRtHash;
+  uint32_t scanPsHash;
   int8_t scrollDirection;
   uint8_t brightness;
   uint8_t theme;
   uint8_t uiLayout;
   uint8_t zoomMenu;
+  uint16_t scanSettings;  // sensitivity, speed, identify dwell and band rows of the settings list
 
   uint32_t favoritesHash;
   uint32_t favoriteNamesHash;
@@ -94,6 +112,56 @@ struct UiRenderKey {
   uint8_t dialPadCursor;
   uint32_t dialPadDigitsHash;
   uint8_t dialPadErrorShowing;
+
+  uint8_t currentFavorite;
+  int16_t calibrationHz;
+  uint8_t scanFine;
+  uint16_t scanPointsVisited;
+  uint16_t scanTotalPoints;
+  uint8_t batchBand;
+  uint16_t batchEtaS;
+  uint16_t bandscopeGeneration;
+};
+
+// Now-playing screen regions for partial redraws. A dirty region is redrawn by replaying drawScreen()
+// clipped to its rectangle and only that rectangle is pushed; sections whose bounds miss the clip are
+// skipped. Rectangles are deliberately generous: a section must never draw outside its own region.
+struct UiRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+enum class UiRegion : uint8_t {
+  Chips,
+  Status,
+  Battery,
+  Clock,
+  Frequency,
+  RdsInfo,
+  RdsText,
+  Scale,
+  Meters,
+  VolumeHud,
+  TransientHud,
+  Count,
+};
+
+constexpr uint8_t kRegionCount = static_cast<uint8_t>(UiRegion::Count);
+constexpr UiRect kFullScreenRect = {0, 0, kUiWidth, kUiHeight};
+constexpr UiRect kRegionRects[kRegionCount] = {
+    {0, 0, kUiWidth, 53},    // quick-edit chip rows, SYS icons included
+    {0, 53, 56, 21},         // operation label + scan progress under the AVC chip
+    {270, 3, 44, 12},        // battery icon inside the SYS chip
+    {262, 52, 58, 17},       // clock
+    {0, 34, kUiWidth, 52},   // frequency digits with unit/stereo cluster
+    {246, 68, 74, 19},       // PI + PTY
+    {56, 86, 208, 26},       // PS + RT, or RSSI/SNR text off FM
+    {14, 113, 292, 43},      // bandscope trace, scale ticks, SW overlays, marker, band limits
+    {20, 156, 284, 6},       // RSSI/SNR bars
+    {70, 136, 180, 28},      // volume HUD
+    {55, 106, 210, 24},      // transient HUD
 };
 
 uint32_t g_lastRenderMs = 0;
@@ -130,6 +198,30 @@ char g_transientHudText[32] = {0};
 uint32_t g_transientHudUntilMs = 0;
 bool g_lastTransientHudVisible = false;
 uint32_t g_lastTransientTextHash = 0;
+uint8_t g_lastVolumeHudValue = 0;
+bool g_lastStereo = false;
+bool g_partialRedraw = true;
+bool g_bandscopeEnabled = true;
+UiRect g_clip = kFullScreenRect;
+RenderStats g_renderStats{};
+
+// A frame handed to the display task: the rectangles of g_front to stream. g_frameDone is the fence the
+// loop takes before touching g_front again.
+struct FrameJob {
+  uint8_t count;
+  UiRect rects[kRegionCount];
+};
+
+constexpr uint32_t kDisplayStackBytes = 3072;
+TaskHandle_t g_displayTask = nullptr;
+QueueHandle_t g_frameQueue = nullptr;
+SemaphoreHandle_t g_frameDone = nullptr;
+bool g_frameInFlight = false;
+std::atomic<uint32_t> g_lastPushUs{0};
+std::atomic<uint32_t> g_maxPushUs{0};
+#if ATS_UI_VERIFY_PARTIAL
+uint16_t* g_verifyFrame = nullptr;
+#endif
 
 #if ATS_UI_DEBUG_LOG
 uint32_t g_lastSerialLogMs = 0;
@@ -145,6 +237,13 @@ constexpr uint16_t kColorScaleHot = TFT_RED;
 constexpr uint16_t kColorRssi = 0x07E0;
 constexpr uint16_t kColorSwBroadcastRange = 0xFC10;  // light red
 constexpr uint16_t kColorSwAmateurRange = 0x7DFF;    // light blue
+constexpr uint16_t kColorBandscopeWeak = 0x3186;
+
+// Bandscope trace between the RDS text and the scale ruler: one column per scale pixel.
+constexpr int kBandscopeBaseY = 133;
+constexpr int kBandscopeHeight = 18;
+constexpr uint8_t kBandscopeFullScaleRssi = 60;
+constexpr uint8_t kBandscopeSnrLit = 6;  // columns at or above this SNR use the meter color
 
 const char* operationName(app::OperationMode operation) {
   switch (operation) {
@@ -196,6 +295,8 @@ uint32_t hashMix(uint32_t hash, uint32_t value) {
 }
 
 uint32_t textHashN(const char* text, size_t maxLen);
+const char* scanMemoryPs(const app::AppState& state);
+bool isCurrentFavorite(const app::AppState& state);
 
 uint32_t favoritesHash(const app::AppState& state) {
   uint32_t hash = 2166136261UL;
@@ -286,7 +387,8 @@ UiRenderKey buildRenderKey(const app::AppState& state) {
                                       (state.rds.hasRt ? 0x02 : 0) |
                                       (state.rds.hasPi ? 0x04 : 0) |
                                       (state.rds.hasPty ? 0x08 : 0) |
-                                      (state.rds.hasCt ? 0x10 : 0));
+                                      (state.rds.hasCt ? 0x10 : 0) |
+                                      (state.rds.psCached ? 0x20 : 0));
   key.rdsPty = state.rds.pty;
   key.rdsQuality = state.rds.quality;
   key.rdsPi = state.rds.pi;
@@ -294,11 +396,17 @@ UiRenderKey buildRenderKey(const app::AppState& state) {
   key.rdsCtMinuteOfDay = static_cast<uint16_t>(state.rds.ctHour * 60U + state.rds.ctMinute);
   key.rdsPsHash = textHashN(state.rds.ps, sizeof(state.rds.ps));
   key.rdsRtHash = textHashN(state.rds.rt, sizeof(state.rds.rt));
+  const char* scanPs = scanMemoryPs(state);
+  key.scanPsHash = scanPs != nullptr ? textHashN(scanPs, sizeof(state.seekScan.cursorRdsPs)) : 0;
   key.scrollDirection = state.global.scrollDirection;
   key.brightness = state.global.brightness;
   key.theme = static_cast<uint8_t>(state.global.theme);
   key.uiLayout = static_cast<uint8_t>(state.global.uiLayout);
   key.zoomMenu = state.global.zoomMenu;
+  key.scanSettings = static_cast<uint16_t>((static_cast<uint8_t>(state.global.scanSensitivity) & 0x01) |
+                                           ((static_cast<uint8_t>(state.global.scanSpeed) & 0x03) << 1) |
+                                           (app::settings::identifyDwellToIndex(state.global.scanIdentifyDwellMs) << 3) |
+                                           (app::etmBatchPresetIndex(state.global.scanBandMask) << 6));
 
   refreshFavoriteHashCacheIfNeeded(state);
   key.favoritesHash = g_cachedFavoritesHash;
@@ -320,6 +428,23 @@ UiRenderKey buildRenderKey(const app::AppState& state) {
     key.dialPadErrorShowing = 0;
   }
 
+  key.currentFavorite = static_cast<uint8_t>(isCurrentFavorite(state) ? 1 : 0);
+  const app::BandRuntimeState& bandState = state.perBand[bandIndex];
+  key.calibrationHz = state.radio.modulation == app::Modulation::USB
+                          ? bandState.usbCalibrationHz
+                          : (state.radio.modulation == app::Modulation::LSB ? bandState.lsbCalibrationHz : 0);
+  key.scanFine = static_cast<uint8_t>(state.ui.operation == app::OperationMode::Scan && state.seekScan.fineScanActive ? 1 : 0);
+  if (state.seekScan.active && state.seekScan.scanning && state.seekScan.totalPoints > 0) {
+    key.scanPointsVisited = state.seekScan.pointsVisited;
+    key.scanTotalPoints = state.seekScan.totalPoints;
+  }
+  if (state.seekScan.active && state.seekScan.batchBandCount > 0) {
+    key.batchBand = state.seekScan.batchBand;
+    key.batchEtaS = static_cast<uint16_t>(state.seekScan.batchEtaMs / 1000U);
+  }
+  const app::EtmBandscope* scope = g_bandscopeEnabled ? services::etm::bandscope() : nullptr;
+  key.bandscopeGeneration = scope != nullptr ? scope->generation : 0;
+
   return key;
 }
 
@@ -362,16 +487,160 @@ bool sameRenderKey(const UiRenderKey& lhs, const UiRenderKey& rhs) {
          lhs.rdsCtMinuteOfDay == rhs.rdsCtMinuteOfDay &&
          lhs.rdsPsHash == rhs.rdsPsHash &&
          lhs.rdsRtHash == rhs.rdsRtHash &&
+         lhs.scanPsHash == rhs.scanPsHash &&
          lhs.scrollDirection == rhs.scrollDirection &&
          lhs.brightness == rhs.brightness &&
          lhs.theme == rhs.theme &&
          lhs.uiLayout == rhs.uiLayout &&
          lhs.zoomMenu == rhs.zoomMenu &&
+         lhs.scanSettings == rhs.scanSettings &&
          lhs.favoritesHash == rhs.favoritesHash &&
          lhs.favoriteNamesHash == rhs.favoriteNamesHash &&
          lhs.dialPadCursor == rhs.dialPadCursor &&
          lhs.dialPadDigitsHash == rhs.dialPadDigitsHash &&
-         lhs.dialPadErrorShowing == rhs.dialPadErrorShowing;
+         lhs.dialPadErrorShowing == rhs.dialPadErrorShowing &&
+         lhs.currentFavorite == rhs.currentFavorite &&
+         lhs.calibrationHz == rhs.calibrationHz &&
+         lhs.scanFine == rhs.scanFine &&
+         lhs.scanPointsVisited == rhs.scanPointsVisited &&
+         lhs.scanTotalPoints == rhs.scanTotalPoints &&
+         lhs.batchBand == rhs.batchBand &&
+         lhs.batchEtaS == rhs.batchEtaS &&
+         lhs.bandscopeGeneration == rhs.bandscopeGeneration;
+}
+
+// Whole-frame changes: other screens, the quick-edit popup, and anything that moves every region at once.
+bool needsFullRedraw(const app::AppState& state, const UiRenderKey& prev, const UiRenderKey& next) {
+  if (state.ui.layer == app::UiLayer::Settings || state.ui.layer == app::UiLayer::DialPad ||
+      (state.ui.layer == app::UiLayer::QuickEdit && state.ui.quickEditEditing)) {
+    return true;
+  }
+
+  return prev.layer != next.layer ||
+         prev.operation != next.operation ||
+         prev.quickEditEditing != next.quickEditEditing ||
+         prev.quickEditPopupIndex != next.quickEditPopupIndex ||
+         prev.settingsChipArmed != next.settingsChipArmed ||
+         prev.bandIndex != next.bandIndex ||
+         prev.modulation != next.modulation ||
+         prev.fmRegion != next.fmRegion ||
+         prev.scrollDirection != next.scrollDirection ||
+         prev.brightness != next.brightness ||
+         prev.theme != next.theme ||
+         prev.uiLayout != next.uiLayout ||
+         prev.zoomMenu != next.zoomMenu ||
+         prev.favoriteNamesHash != next.favoriteNamesHash ||
+         prev.dialPadCursor != next.dialPadCursor ||
+         prev.dialPadDigitsHash != next.dialPadDigitsHash ||
+         prev.dialPadErrorShowing != next.dialPadErrorShowing;
+}
+
+uint16_t regionBit(UiRegion region) {
+  return static_cast<uint16_t>(1U << static_cast<uint8_t>(region));
+}
+
+// Regions touched by render-key changes that do not need a full frame. RDS quality and CT are not drawn
+// on the now-playing screen (the clock follows state.clock), so they map to nothing.
+uint16_t dirtyRegions(const UiRenderKey& prev, const UiRenderKey& next) {
+  uint16_t dirty = 0;
+
+  if (prev.frequencyKhz != next.frequencyKhz || prev.ssbTuneOffsetHz != next.ssbTuneOffsetHz) {
+    dirty |= regionBit(UiRegion::Frequency) | regionBit(UiRegion::Scale);
+  }
+
+  if (prev.quickEditItem != next.quickEditItem ||
+      prev.ssbStepHz != next.ssbStepHz ||
+      prev.amStepKhz != next.amStepKhz ||
+      prev.fmStepKhz != next.fmStepKhz ||
+      prev.bandwidthIndex != next.bandwidthIndex ||
+      prev.agcEnabled != next.agcEnabled ||
+      prev.avcLevel != next.avcLevel ||
+      prev.avcAmLevel != next.avcAmLevel ||
+      prev.avcSsbLevel != next.avcSsbLevel ||
+      prev.squelch != next.squelch ||
+      prev.softMuteAmLevel != next.softMuteAmLevel ||
+      prev.softMuteSsbLevel != next.softMuteSsbLevel ||
+      prev.wifiMode != next.wifiMode ||
+      prev.sleepMode != next.sleepMode ||
+      prev.sleepTimerMinutes != next.sleepTimerMinutes ||
+      prev.favoritesHash != next.favoritesHash ||
+      prev.currentFavorite != next.currentFavorite ||
+      prev.calibrationHz != next.calibrationHz) {
+    dirty |= regionBit(UiRegion::Chips);
+  }
+
+  if (prev.utcOffsetMinutes != next.utcOffsetMinutes ||
+      prev.clockHour != next.clockHour ||
+      prev.clockMinute != next.clockMinute ||
+      prev.clockUsingRdsCt != next.clockUsingRdsCt) {
+    dirty |= regionBit(UiRegion::Clock);
+  }
+
+  if (prev.rdsMode != next.rdsMode ||
+      prev.rdsFlags != next.rdsFlags ||
+      prev.rdsPty != next.rdsPty ||
+      prev.rdsPi != next.rdsPi) {
+    dirty |= regionBit(UiRegion::RdsInfo) | regionBit(UiRegion::RdsText);
+  }
+  if (prev.rdsPsHash != next.rdsPsHash || prev.rdsRtHash != next.rdsRtHash || prev.scanPsHash != next.scanPsHash) {
+    dirty |= regionBit(UiRegion::RdsText);
+  }
+
+  if (prev.bandscopeGeneration != next.bandscopeGeneration) {
+    dirty |= regionBit(UiRegion::Scale);
+  }
+
+  if (prev.scanFine != next.scanFine ||
+      prev.scanPointsVisited != next.scanPointsVisited ||
+      prev.scanTotalPoints != next.scanTotalPoints ||
+      prev.batchBand != next.batchBand ||
+      prev.batchEtaS != next.batchEtaS) {
+    dirty |= regionBit(UiRegion::Status);
+  }
+
+  return dirty;
+}
+
+bool rectsOverlap(const UiRect& a, const UiRect& b) {
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+UiRect rectUnion(const UiRect& a, const UiRect& b) {
+  const int16_t x0 = a.x < b.x ? a.x : b.x;
+  const int16_t y0 = a.y < b.y ? a.y : b.y;
+  const int16_t x1 = (a.x + a.w) > (b.x + b.w) ? (a.x + a.w) : (b.x + b.w);
+  const int16_t y1 = (a.y + a.h) > (b.y + b.h) ? (a.y + a.h) : (b.y + b.h);
+  return {x0, y0, static_cast<int16_t>(x1 - x0), static_cast<int16_t>(y1 - y0)};
+}
+
+// Collapses overlapping rectangles so no pixel is redrawn or pushed twice in one frame.
+uint8_t collectDirtyRects(uint16_t dirty, UiRect* out) {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < kRegionCount; ++i) {
+    if (dirty & (1U << i)) {
+      out[count++] = kRegionRects[i];
+    }
+  }
+
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < count && !merged; ++i) {
+      for (uint8_t j = static_cast<uint8_t>(i + 1); j < count; ++j) {
+        if (rectsOverlap(out[i], out[j])) {
+          out[i] = rectUnion(out[i], out[j]);
+          out[j] = out[--count];
+          merged = true;
+          break;
+        }
+      }
+    }
+  }
+  return count;
+}
+
+bool clipTouches(UiRegion region) {
+  return rectsOverlap(g_clip, kRegionRects[static_cast<uint8_t>(region)]);
 }
 
 uint16_t modeAccent(app::OperationMode operation) {
@@ -532,6 +801,15 @@ void copyEllipsized(const char* src, char* out, size_t outSize, size_t maxChars)
   out[copyLen + 3] = '\0';
 }
 
+// Scan-mode navigation: the ETM identify pass names the cursor station until RDS has a PS of its own.
+const char* scanMemoryPs(const app::AppState& state) {
+  if (state.ui.operation != app::OperationMode::Scan || state.seekScan.active || state.rds.hasPs ||
+      state.seekScan.cursorRdsPs[0] == '\0') {
+    return nullptr;
+  }
+  return state.seekScan.cursorRdsPs;
+}
+
 void buildFmRdsDisplayLines(const app::AppState& state,
                             char* psOut,
                             size_t psOutSize,
@@ -571,6 +849,9 @@ void buildFmRdsDisplayLines(const app::AppState& state,
     char psText[app::kRdsPsCapacity];
     copyEllipsized(state.rds.ps, psText, sizeof(psText), 8);
     snprintf(psOut, psOutSize, "%s", psText);
+  } else if (const char* scanPs = scanMemoryPs(state)) {
+    // Muted like a cached PS: showPsStrong needs a live one.
+    snprintf(psOut, psOutSize, "%s", scanPs);
   }
 
   if (state.global.rdsMode == app::RdsMode::Ps) {
@@ -968,6 +1249,26 @@ int scaleXFor(const app::AppState& state, int x0, int x1) {
   return scaleXForFrequencyKhz(state.radio.frequencyKhz, bandMinKhz, bandMaxKhz, x0, x1);
 }
 
+// One pass over the cached sweep of this band; columns are never re-measured here.
+void drawBandscope(int x0) {
+  const app::EtmBandscope* scope = g_bandscopeEnabled ? services::etm::bandscope() : nullptr;
+  if (scope == nullptr) {
+    return;
+  }
+
+  for (uint16_t column = 0; column < app::kBandscopeColumns; ++column) {
+    const uint8_t rssi = scope->rssi[column];
+    if (rssi == app::kBandscopeUnmeasured || rssi == 0) {
+      continue;
+    }
+    const int h = rssi >= kBandscopeFullScaleRssi
+                      ? kBandscopeHeight
+                      : (static_cast<int>(rssi) * kBandscopeHeight + kBandscopeFullScaleRssi - 1) / kBandscopeFullScaleRssi;
+    const uint16_t color = scope->snr[column] >= kBandscopeSnrLit ? kColorRssi : kColorBandscopeWeak;
+    g_spr.drawFastVLine(x0 + column, kBandscopeBaseY - h + 1, h, color);
+  }
+}
+
 void drawBottomScale(const app::AppState& state) {
   const app::BandDef& band = app::kBandPlan[state.radio.bandIndex];
   const uint16_t bandMinKhz = app::bandMinKhzFor(band, state.global.fmRegion);
@@ -976,6 +1277,7 @@ void drawBottomScale(const app::AppState& state) {
   const int x1 = 300;
   const int y = 140;
 
+  drawBandscope(x0);
   g_spr.drawLine(x0, y, x1, y, kColorScale);
   for (int i = 0; i <= 10; ++i) {
     const int x = x0 + ((x1 - x0) * i) / 10;
@@ -1033,7 +1335,9 @@ void drawBottomScale(const app::AppState& state) {
   g_spr.drawString(limLo, x0 - 2, y + 8);
   g_spr.setTextDatum(TR_DATUM);
   g_spr.drawString(limHi, x1 + 2, y + 8);
+}
 
+void drawSignalMeters(const app::AppState& state) {
   constexpr int kTotalBars = 24;
   constexpr int kHalfBars = kTotalBars / 2;
   const int rssiStrength49 = signalscaleInterpolatedStrength49(g_lastRssi, state.radio.modulation);
@@ -1269,8 +1573,6 @@ void drawSettingsScreen(const app::AppState& state) {
   if (transientHudVisible(millis())) {
     drawTransientHud();
   }
-
-  g_spr.pushSprite(0, 0);
 }
 
 void drawDialPadScreen(const app::AppState& state) {
@@ -1356,169 +1658,18 @@ void drawDialPadScreen(const app::AppState& state) {
   if (transientHudVisible(millis())) {
     drawTransientHud();
   }
-
-  g_spr.pushSprite(0, 0);
 }
 
-void drawScreen(const app::AppState& state) {
-  if (state.ui.layer == app::UiLayer::DialPad && state.ui.dialPadEnteredByUser) {
-    drawDialPadScreen(state);
-    return;
-  }
-  if (state.ui.layer == app::UiLayer::Settings) {
-    drawSettingsScreen(state);
-    return;
-  }
-
-  const app::BandDef& band = app::kBandPlan[state.radio.bandIndex];
-
-  const bool quickEdit = state.ui.layer == app::UiLayer::QuickEdit;
-  const bool popupOpen = quickEdit && state.ui.quickEditEditing;
-
-  const bool focusBand = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Band;
-  const bool focusStep = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Step;
-  const bool focusBw = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Bandwidth;
-  const bool focusAgc = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Agc;
-  const bool focusSql = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Sql;
-  const bool focusSys = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Sys;
-  const bool focusSettings = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Settings;
-  const bool focusFav = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Favorite;
-  const bool focusCal = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Cal;
-  const bool focusAvc = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Avc;
-  const bool focusMode = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Mode;
-  const bool editableCal = app::quickedit::itemEditable(state, app::QuickEditItem::Cal);
-  const bool editableAvc = app::quickedit::itemEditable(state, app::QuickEditItem::Avc);
-  const bool editableMode = app::quickedit::itemEditable(state, app::QuickEditItem::Mode);
-
-  char stepText[16];
-  if (state.radio.modulation == app::Modulation::FM) {
-    snprintf(stepText, sizeof(stepText), "STEP:%uk", static_cast<unsigned>(state.radio.fmStepKhz));
-  } else if (app::isSsb(state.radio.modulation)) {
-    const uint16_t stepHz = state.radio.ssbStepHz > 0 ? state.radio.ssbStepHz : 1000;
-    if (stepHz >= 1000 && (stepHz % 1000U) == 0U) {
-      snprintf(stepText, sizeof(stepText), "STEP:%uk", static_cast<unsigned>(stepHz / 1000U));
-    } else {
-      snprintf(stepText, sizeof(stepText), "STEP:%uHz", static_cast<unsigned>(stepHz));
-    }
-  } else {
-    snprintf(stepText, sizeof(stepText), "STEP:%uk", static_cast<unsigned>(state.radio.amStepKhz));
-  }
-
-  char bwText[16];
-  char bwValue[8];
-  app::quickedit::formatBandwidthOption(state.radio, state.perBand[state.radio.bandIndex].bandwidthIndex, bwValue, sizeof(bwValue));
-  snprintf(bwText, sizeof(bwText), "BW:%s", bwValue);
-
-  char agcText[18];
-  if (state.global.agcEnabled) {
-    snprintf(agcText, sizeof(agcText), "AGC:AUTO");
-  } else {
-    snprintf(agcText, sizeof(agcText), "AGC:%u", static_cast<unsigned>(state.global.avcLevel));
-  }
-
-  char sqlText[16];
-  snprintf(sqlText, sizeof(sqlText), "SQL:%u", static_cast<unsigned>(state.global.squelch));
-
-  char clockText[8];
-  formatClock(state, clockText, sizeof(clockText));
-
-  char calText[16];
-  const app::BandRuntimeState& bandState = state.perBand[state.radio.bandIndex];
-  const int16_t calHz = state.radio.modulation == app::Modulation::USB
-                            ? bandState.usbCalibrationHz
-                            : (state.radio.modulation == app::Modulation::LSB ? bandState.lsbCalibrationHz : 0);
-  snprintf(calText, sizeof(calText), "CAL:%+d", static_cast<int>(calHz));
-
-  char avcText[16];
-  if (state.radio.modulation == app::Modulation::FM) {
-    snprintf(avcText, sizeof(avcText), "AVC:N/A");
-  } else if (app::isSsb(state.radio.modulation)) {
-    snprintf(avcText, sizeof(avcText), "AVC:%u", static_cast<unsigned>(state.global.avcSsbLevel));
-  } else {
-    snprintf(avcText, sizeof(avcText), "AVC:%u", static_cast<unsigned>(state.global.avcAmLevel));
-  }
-
-  const bool wifiOn = state.global.wifiMode != app::WifiMode::Off;
-  const bool sleepOn = state.global.sleepMode != app::SleepMode::Disabled || state.global.sleepTimerMinutes > 0;
-  const bool currentFavorite = isCurrentFavorite(state);
-
-  g_spr.fillSprite(kColorBg);
-  drawOperationSideFade(state.ui.operation);
-
-  const app::quickedit::ChipRect calRect = app::quickedit::chipRect(app::QuickEditItem::Cal);
-  const app::quickedit::ChipRect avcRect = app::quickedit::chipRect(app::QuickEditItem::Avc);
-  const app::quickedit::ChipRect favRect = app::quickedit::chipRect(app::QuickEditItem::Favorite);
-  const app::quickedit::ChipRect modeRect = app::quickedit::chipRect(app::QuickEditItem::Mode);
-  const app::quickedit::ChipRect bandRect = app::quickedit::chipRect(app::QuickEditItem::Band);
-  const app::quickedit::ChipRect stepRect = app::quickedit::chipRect(app::QuickEditItem::Step);
-  const app::quickedit::ChipRect bwRect = app::quickedit::chipRect(app::QuickEditItem::Bandwidth);
-  const app::quickedit::ChipRect agcRect = app::quickedit::chipRect(app::QuickEditItem::Agc);
-  const app::quickedit::ChipRect sqlRect = app::quickedit::chipRect(app::QuickEditItem::Sql);
-  const app::quickedit::ChipRect sysRect = app::quickedit::chipRect(app::QuickEditItem::Sys);
-  const app::quickedit::ChipRect setRect = app::quickedit::chipRect(app::QuickEditItem::Settings);
-
-  if (editableCal) {
-    drawChip(calRect.x, calRect.y, calRect.w, calRect.h, calText, focusCal, popupOpen && focusCal, 1, editableCal);
-  }
-  drawChip(avcRect.x, avcRect.y, avcRect.w, avcRect.h, avcText, focusAvc, popupOpen && focusAvc, 1, editableAvc);
-  drawFavoriteChip(favRect.x, favRect.y, favRect.w, favRect.h, focusFav, popupOpen && focusFav, currentFavorite);
-  g_spr.setTextDatum(MC_DATUM);
-  g_spr.setTextFont(1);
-  g_spr.setTextColor(modeAccent(state.ui.operation), kColorBg);
-  if (state.ui.operation == app::OperationMode::Scan && state.seekScan.fineScanActive) {
-    g_spr.drawString("SCAN FINE", avcRect.x + (avcRect.w / 2), avcRect.y + avcRect.h + 7);
-  } else {
-    g_spr.drawString(operationName(state.ui.operation), avcRect.x + (avcRect.w / 2), avcRect.y + avcRect.h + 7);
-  }
-  if (state.seekScan.active && state.seekScan.scanning && state.seekScan.totalPoints > 0) {
-    char prog[16];
-    const uint16_t pts = state.seekScan.pointsVisited > state.seekScan.totalPoints
-                             ? state.seekScan.totalPoints
-                             : state.seekScan.pointsVisited;
-    snprintf(prog, sizeof(prog), "%u/%u", static_cast<unsigned>(pts), static_cast<unsigned>(state.seekScan.totalPoints));
-    g_spr.setTextColor(kColorMuted, kColorBg);
-    g_spr.drawString(prog, avcRect.x + (avcRect.w / 2), avcRect.y + avcRect.h + 16);
-  }
-
-  drawChip(modeRect.x, modeRect.y, modeRect.w, modeRect.h, modulationName(state.radio.modulation), focusMode, popupOpen && focusMode, 2, editableMode);
-  drawChip(bandRect.x, bandRect.y, bandRect.w, bandRect.h, band.name, focusBand, popupOpen && focusBand, 2);
-  drawChip(stepRect.x, stepRect.y, stepRect.w, stepRect.h, stepText, focusStep, popupOpen && focusStep, 1);
-  drawChip(bwRect.x, bwRect.y, bwRect.w, bwRect.h, bwText, focusBw, popupOpen && focusBw, 1);
-  drawChip(agcRect.x, agcRect.y, agcRect.w, agcRect.h, agcText, focusAgc, popupOpen && focusAgc, 1);
-  drawChip(sqlRect.x, sqlRect.y, sqlRect.w, sqlRect.h, sqlText, focusSql, popupOpen && focusSql, 1);
-
-  drawChip(sysRect.x, sysRect.y, sysRect.w, sysRect.h, "", focusSys, popupOpen && focusSys, 1);
-  const uint8_t batteryPct = g_lastBatteryPct;
-  const int batteryW = sysRect.w - 6;
-  drawBatteryIcon(sysRect.x + 3, sysRect.y + 4, batteryPct, batteryW);
-  drawMoonIcon(sysRect.x + 13, sysRect.y + sysRect.h - 11, sleepOn);
-  drawWifiIcon(sysRect.x + sysRect.w - 11, sysRect.y + sysRect.h - 11, wifiOn);
-
-  drawChip(setRect.x, setRect.y, setRect.w, setRect.h, "SETTINGS", focusSettings, popupOpen && focusSettings, 1);
-  g_spr.setTextColor(kColorText, kColorBg);
-  g_spr.setTextFont(2);
-  g_spr.setTextDatum(MC_DATUM);
-  g_spr.drawString(clockText, 291, 60);
-
-  char rdsPsText[24];
-  char rdsRtText[40];
-  char rdsPiText[16];
-  char rdsPtyText[24];
-  buildFmRdsDisplayLines(state,
-                         rdsPsText,
-                         sizeof(rdsPsText),
-                         rdsRtText,
-                         sizeof(rdsRtText),
-                         rdsPiText,
-                         sizeof(rdsPiText),
-                         rdsPtyText,
-                         sizeof(rdsPtyText));
+bool stereoIndicator(const app::AppState& state) {
+  return state.radio.modulation == app::Modulation::FM && g_lastSnr >= 12;
+}
 
+void drawFrequencyReadout(const app::AppState& state) {
   char freqText[20];
   char unitText[8];
   formatFrequency(state.radio, freqText, sizeof(freqText), unitText, sizeof(unitText));
   const bool ssbDisplay = app::isSsb(state.radio.modulation);
-  const bool stereo = state.radio.modulation == app::Modulation::FM && g_lastSnr >= 12;
+  const bool stereo = stereoIndicator(state);
   const char* stereoText = stereo ? "ST" : "MO";
 
   const int kFreqY = 60;
@@ -1626,34 +1777,225 @@ void drawScreen(const app::AppState& state) {
     g_spr.setTextColor(stereo ? kColorRssi : kColorMuted, kColorBg);
     g_spr.drawString(stereoText, clusterX, kStereoY);
   }
+}
 
-  g_spr.setTextDatum(MC_DATUM);
-  g_spr.setTextFont(1);
-  g_spr.setTextColor(rdsPiText[0] != '\0' ? kColorText : kColorMuted, kColorBg);
-  g_spr.drawString(rdsPiText, 291, 73);
-  g_spr.setTextColor(rdsPtyText[0] != '\0' ? kColorText : kColorMuted, kColorBg);
-  g_spr.drawString(rdsPtyText, 291, 82);
+void drawScreen(const app::AppState& state) {
+  if (state.ui.layer == app::UiLayer::DialPad && state.ui.dialPadEnteredByUser) {
+    drawDialPadScreen(state);
+    return;
+  }
+  if (state.ui.layer == app::UiLayer::Settings) {
+    drawSettingsScreen(state);
+    return;
+  }
 
-  g_spr.setTextDatum(MC_DATUM);
-  g_spr.setTextFont(2);
-  const bool showPsStrong = state.radio.modulation == app::Modulation::FM && state.rds.hasPs && state.global.rdsMode != app::RdsMode::Off;
-  g_spr.setTextColor(showPsStrong ? kColorText : kColorMuted, kColorBg);
-  g_spr.drawString(state.radio.modulation == app::Modulation::FM ? rdsPsText : "EiBi ---",
-                   160,
-                   94);
+  const app::BandDef& band = app::kBandPlan[state.radio.bandIndex];
 
-  g_spr.setTextFont(1);
+  const bool quickEdit = state.ui.layer == app::UiLayer::QuickEdit;
+  const bool popupOpen = quickEdit && state.ui.quickEditEditing;
+
+  const bool focusBand = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Band;
+  const bool focusStep = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Step;
+  const bool focusBw = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Bandwidth;
+  const bool focusAgc = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Agc;
+  const bool focusSql = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Sql;
+  const bool focusSys = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Sys;
+  const bool focusSettings = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Settings;
+  const bool focusFav = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Favorite;
+  const bool focusCal = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Cal;
+  const bool focusAvc = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Avc;
+  const bool focusMode = quickEdit && state.ui.quickEditItem == app::QuickEditItem::Mode;
+  const bool editableCal = app::quickedit::itemEditable(state, app::QuickEditItem::Cal);
+  const bool editableAvc = app::quickedit::itemEditable(state, app::QuickEditItem::Avc);
+  const bool editableMode = app::quickedit::itemEditable(state, app::QuickEditItem::Mode);
+
+  char stepText[16];
+  if (state.radio.modulation == app::Modulation::FM) {
+    snprintf(stepText, sizeof(stepText), "STEP:%uk", static_cast<unsigned>(state.radio.fmStepKhz));
+  } else if (app::isSsb(state.radio.modulation)) {
+    const uint16_t stepHz = state.radio.ssbStepHz > 0 ? state.radio.ssbStepHz : 1000;
+    if (stepHz >= 1000 && (stepHz % 1000U) == 0U) {
+      snprintf(stepText, sizeof(stepText), "STEP:%uk", static_cast<unsigned>(stepHz / 1000U));
+    } else {
+      snprintf(stepText, sizeof(stepText), "STEP:%uHz", static_cast<unsigned>(stepHz));
+    }
+  } else {
+    snprintf(stepText, sizeof(stepText), "STEP:%uk", static_cast<unsigned>(state.radio.amStepKhz));
+  }
+
+  char bwText[16];
+  char bwValue[8];
+  app::quickedit::formatBandwidthOption(state.radio, state.perBand[state.radio.bandIndex].bandwidthIndex, bwValue, sizeof(bwValue));
+  snprintf(bwText, sizeof(bwText), "BW:%s", bwValue);
+
+  char agcText[18];
+  if (state.global.agcEnabled) {
+    snprintf(agcText, sizeof(agcText), "AGC:AUTO");
+  } else {
+    snprintf(agcText, sizeof(agcText), "AGC:%u", static_cast<unsigned>(state.global.avcLevel));
+  }
+
+  char sqlText[16];
+  snprintf(sqlText, sizeof(sqlText), "SQL:%u", static_cast<unsigned>(state.global.squelch));
+
+  char clockText[8];
+  formatClock(state, clockText, sizeof(clockText));
+
+  char calText[16];
+  const app::BandRuntimeState& bandState = state.perBand[state.radio.bandIndex];
+  const int16_t calHz = state.radio.modulation == app::Modulation::USB
+                            ? bandState.usbCalibrationHz
+                            : (state.radio.modulation == app::Modulation::LSB ? bandState.lsbCalibrationHz : 0);
+  snprintf(calText, sizeof(calText), "CAL:%+d", static_cast<int>(calHz));
+
+  char avcText[16];
   if (state.radio.modulation == app::Modulation::FM) {
-    g_spr.setTextColor(rdsRtText[0] != '\0' ? kColorText : kColorMuted, kColorBg);
-    g_spr.drawString(rdsRtText[0] != '\0' ? rdsRtText : "", 160, 108);
+    snprintf(avcText, sizeof(avcText), "AVC:N/A");
+  } else if (app::isSsb(state.radio.modulation)) {
+    snprintf(avcText, sizeof(avcText), "AVC:%u", static_cast<unsigned>(state.global.avcSsbLevel));
   } else {
-    char rssiText[24];
-    snprintf(rssiText, sizeof(rssiText), "RSSI:%u SNR:%u", static_cast<unsigned>(g_lastRssi), static_cast<unsigned>(g_lastSnr));
-    g_spr.setTextColor(kColorMuted, kColorBg);
-    g_spr.drawString(rssiText, 160, 108);
+    snprintf(avcText, sizeof(avcText), "AVC:%u", static_cast<unsigned>(state.global.avcAmLevel));
   }
 
-  drawBottomScale(state);
+  const bool wifiOn = state.global.wifiMode != app::WifiMode::Off;
+  const bool sleepOn = state.global.sleepMode != app::SleepMode::Disabled || state.global.sleepTimerMinutes > 0;
+  const bool currentFavorite = isCurrentFavorite(state);
+
+  g_spr.fillRect(g_clip.x, g_clip.y, g_clip.w, g_clip.h, kColorBg);
+  drawOperationSideFade(state.ui.operation);
+
+  const app::quickedit::ChipRect calRect = app::quickedit::chipRect(app::QuickEditItem::Cal);
+  const app::quickedit::ChipRect avcRect = app::quickedit::chipRect(app::QuickEditItem::Avc);
+  const app::quickedit::ChipRect favRect = app::quickedit::chipRect(app::QuickEditItem::Favorite);
+  const app::quickedit::ChipRect modeRect = app::quickedit::chipRect(app::QuickEditItem::Mode);
+  const app::quickedit::ChipRect bandRect = app::quickedit::chipRect(app::QuickEditItem::Band);
+  const app::quickedit::ChipRect stepRect = app::quickedit::chipRect(app::QuickEditItem::Step);
+  const app::quickedit::ChipRect bwRect = app::quickedit::chipRect(app::QuickEditItem::Bandwidth);
+  const app::quickedit::ChipRect agcRect = app::quickedit::chipRect(app::QuickEditItem::Agc);
+  const app::quickedit::ChipRect sqlRect = app::quickedit::chipRect(app::QuickEditItem::Sql);
+  const app::quickedit::ChipRect sysRect = app::quickedit::chipRect(app::QuickEditItem::Sys);
+  const app::quickedit::ChipRect setRect = app::quickedit::chipRect(app::QuickEditItem::Settings);
+
+  if (clipTouches(UiRegion::Chips)) {
+    if (editableCal) {
+      drawChip(calRect.x, calRect.y, calRect.w, calRect.h, calText, focusCal, popupOpen && focusCal, 1, editableCal);
+    }
+    drawChip(avcRect.x, avcRect.y, avcRect.w, avcRect.h, avcText, focusAvc, popupOpen && focusAvc, 1, editableAvc);
+    drawFavoriteChip(favRect.x, favRect.y, favRect.w, favRect.h, focusFav, popupOpen && focusFav, currentFavorite);
+    drawChip(modeRect.x, modeRect.y, modeRect.w, modeRect.h, modulationName(state.radio.modulation), focusMode, popupOpen && focusMode, 2, editableMode);
+    drawChip(bandRect.x, bandRect.y, bandRect.w, bandRect.h, band.name, focusBand, popupOpen && focusBand, 2);
+    drawChip(stepRect.x, stepRect.y, stepRect.w, stepRect.h, stepText, focusStep, popupOpen && focusStep, 1);
+    drawChip(bwRect.x, bwRect.y, bwRect.w, bwRect.h, bwText, focusBw, popupOpen && focusBw, 1);
+    drawChip(agcRect.x, agcRect.y, agcRect.w, agcRect.h, agcText, focusAgc, popupOpen && focusAgc, 1);
+    drawChip(sqlRect.x, sqlRect.y, sqlRect.w, sqlRect.h, sqlText, focusSql, popupOpen && focusSql, 1);
+
+    drawChip(sysRect.x, sysRect.y, sysRect.w, sysRect.h, "", focusSys, popupOpen && focusSys, 1);
+    const uint8_t batteryPct = g_lastBatteryPct;
+    const int batteryW = sysRect.w - 6;
+    drawBatteryIcon(sysRect.x + 3, sysRect.y + 4, batteryPct, batteryW);
+    drawMoonIcon(sysRect.x + 13, sysRect.y + sysRect.h - 11, sleepOn);
+    drawWifiIcon(sysRect.x + sysRect.w - 11, sysRect.y + sysRect.h - 11, wifiOn);
+
+    drawChip(setRect.x, setRect.y, setRect.w, setRect.h, "SETTINGS", focusSettings, popupOpen && focusSettings, 1);
+  }
+
+  if (clipTouches(UiRegion::Status)) {
+    g_spr.setTextDatum(MC_DATUM);
+    g_spr.setTextFont(1);
+    g_spr.setTextColor(modeAccent(state.ui.operation), kColorBg);
+    if (state.ui.operation == app::OperationMode::Scan && state.seekScan.fineScanActive) {
+      g_spr.drawString("SCAN FINE", avcRect.x + (avcRect.w / 2), avcRect.y + avcRect.h + 7);
+    } else {
+      g_spr.drawString(operationName(state.ui.operation), avcRect.x + (avcRect.w / 2), avcRect.y + avcRect.h + 7);
+    }
+    if (state.seekScan.active && state.seekScan.batchBandCount > 0) {
+      char prog[20];
+      snprintf(prog,
+               sizeof(prog),
+               "%u/%u %us",
+               static_cast<unsigned>(state.seekScan.batchBand),
+               static_cast<unsigned>(state.seekScan.batchBandCount),
+               static_cast<unsigned>(state.seekScan.batchEtaMs / 1000U));
+      g_spr.setTextColor(kColorMuted, kColorBg);
+      g_spr.drawString(prog, avcRect.x + (avcRect.w / 2), avcRect.y + avcRect.h + 16);
+    } else if (state.seekScan.active && state.seekScan.scanning && state.seekScan.totalPoints > 0) {
+      char prog[16];
+      const uint16_t pts = state.seekScan.pointsVisited > state.seekScan.totalPoints
+                               ? state.seekScan.totalPoints
+                               : state.seekScan.pointsVisited;
+      snprintf(prog, sizeof(prog), "%u/%u", static_cast<unsigned>(pts), static_cast<unsigned>(state.seekScan.totalPoints));
+      g_spr.setTextColor(kColorMuted, kColorBg);
+      g_spr.drawString(prog, avcRect.x + (avcRect.w / 2), avcRect.y + avcRect.h + 16);
+    }
+  }
+
+  if (clipTouches(UiRegion::Clock)) {
+    g_spr.setTextColor(kColorText, kColorBg);
+    g_spr.setTextFont(2);
+    g_spr.setTextDatum(MC_DATUM);
+    g_spr.drawString(clockText, 291, 60);
+  }
+
+  if (clipTouches(UiRegion::Frequency)) {
+    drawFrequencyReadout(state);
+  }
+
+  const bool rdsInfoVisible = clipTouches(UiRegion::RdsInfo);
+  const bool rdsTextVisible = clipTouches(UiRegion::RdsText);
+  if (rdsInfoVisible || rdsTextVisible) {
+    char rdsPsText[24];
+    char rdsRtText[40];
+    char rdsPiText[16];
+    char rdsPtyText[24];
+    buildFmRdsDisplayLines(state,
+                           rdsPsText,
+                           sizeof(rdsPsText),
+                           rdsRtText,
+                           sizeof(rdsRtText),
+                           rdsPiText,
+                           sizeof(rdsPiText),
+                           rdsPtyText,
+                           sizeof(rdsPtyText));
+
+    if (rdsInfoVisible) {
+      g_spr.setTextDatum(MC_DATUM);
+      g_spr.setTextFont(1);
+      g_spr.setTextColor(rdsPiText[0] != '\0' ? kColorText : kColorMuted, kColorBg);
+      g_spr.drawString(rdsPiText, 291, 73);
+      g_spr.setTextColor(rdsPtyText[0] != '\0' ? kColorText : kColorMuted, kColorBg);
+      g_spr.drawString(rdsPtyText, 291, 82);
+    }
+
+    if (rdsTextVisible) {
+      g_spr.setTextDatum(MC_DATUM);
+      g_spr.setTextFont(2);
+      // A PS from the station name cache stays muted until live RDS confirms it.
+      const bool showPsStrong = state.radio.modulation == app::Modulation::FM && state.rds.hasPs &&
+                                !state.rds.psCached && state.global.rdsMode != app::RdsMode::Off;
+      g_spr.setTextColor(showPsStrong ? kColorText : kColorMuted, kColorBg);
+      g_spr.drawString(state.radio.modulation == app::Modulation::FM ? rdsPsText : "EiBi ---",
+                       160,
+                       94);
+
+      g_spr.setTextFont(1);
+      if (state.radio.modulation == app::Modulation::FM) {
+        g_spr.setTextColor(rdsRtText[0] != '\0' ? kColorText : kColorMuted, kColorBg);
+        g_spr.drawString(rdsRtText[0] != '\0' ? rdsRtText : "", 160, 108);
+      } else {
+        char rssiText[24];
+        snprintf(rssiText, sizeof(rssiText), "RSSI:%u SNR:%u", static_cast<unsigned>(g_lastRssi), static_cast<unsigned>(g_lastSnr));
+        g_spr.setTextColor(kColorMuted, kColorBg);
+        g_spr.drawString(rssiText, 160, 108);
+      }
+    }
+  }
+
+  if (clipTouches(UiRegion::Scale)) {
+    drawBottomScale(state);
+  }
+  if (clipTouches(UiRegion::Meters)) {
+    drawSignalMeters(state);
+  }
   drawQuickPopup(state);
   if (volumeHudVisible(millis())) {
     drawVolumeHud(state);
@@ -1661,7 +2003,139 @@ void drawScreen(const app::AppState& state) {
   if (transientHudVisible(millis())) {
     drawTransientHud();
   }
-  g_spr.pushSprite(0, 0);
+}
+
+void pushRects(TFT_eSprite& sprite, const UiRect* rects, uint8_t count) {
+  const uint32_t startUs = micros();
+  for (uint8_t i = 0; i < count; ++i) {
+    const UiRect& rect = rects[i];
+    if (rect.w == kUiWidth && rect.h == kUiHeight) {
+      sprite.pushSprite(0, 0);
+    } else {
+      sprite.pushSprite(rect.x, rect.y, rect.x, rect.y, rect.w, rect.h);
+    }
+  }
+  const uint32_t pushUs = micros() - startUs;
+  g_lastPushUs.store(pushUs, std::memory_order_relaxed);
+  if (pushUs > g_maxPushUs.load(std::memory_order_relaxed)) {
+    g_maxPushUs.store(pushUs, std::memory_order_relaxed);
+  }
+}
+
+void displayTask(void*) {
+  for (;;) {
+    FrameJob job{};
+    if (xQueueReceive(g_frameQueue, &job, portMAX_DELAY) != pdTRUE) {
+      continue;
+    }
+    pushRects(g_front, job.rects, job.count);
+    xSemaphoreGive(g_frameDone);
+  }
+}
+
+// Blocks until the display task has finished streaming the previous frame out of g_front.
+void waitFrameFence() {
+  if (!g_frameInFlight) {
+    return;
+  }
+  if (xSemaphoreTake(g_frameDone, 0) != pdTRUE) {
+    const uint32_t startUs = micros();
+    xSemaphoreTake(g_frameDone, portMAX_DELAY);
+    const uint32_t waitUs = micros() - startUs;
+    ++g_renderStats.fenceWaits;
+    if (waitUs > g_renderStats.maxFenceWaitUs) {
+      g_renderStats.maxFenceWaitUs = waitUs;
+    }
+  }
+  g_frameInFlight = false;
+}
+
+void copyToFront(const UiRect& rect) {
+  const uint16_t* src = static_cast<const uint16_t*>(g_spr.getPointer());
+  uint16_t* dst = static_cast<uint16_t*>(g_front.getPointer());
+  for (int row = rect.y; row < rect.y + rect.h; ++row) {
+    const size_t offset = static_cast<size_t>(row) * kUiWidth + rect.x;
+    memcpy(dst + offset, src + offset, static_cast<size_t>(rect.w) * sizeof(uint16_t));
+  }
+}
+
+// Hands the composed rectangles to the panel. With the second buffer they are copied to g_front once the
+// previous frame has left it, and streamed by the display task (inline when the task is unavailable).
+void presentFrame(const UiRect* rects, uint8_t count) {
+  for (uint8_t i = 0; i < count; ++i) {
+    g_renderStats.pushedPixels += static_cast<uint32_t>(rects[i].w) * rects[i].h;
+  }
+  if (!g_frontReady) {
+    pushRects(g_spr, rects, count);
+    return;
+  }
+
+  waitFrameFence();
+  FrameJob job{};
+  job.count = count;
+  for (uint8_t i = 0; i < count; ++i) {
+    copyToFront(rects[i]);
+    job.rects[i] = rects[i];
+  }
+  if (g_displayTask != nullptr && xQueueSend(g_frameQueue, &job, 0) == pdTRUE) {
+    g_frameInFlight = true;
+    return;
+  }
+  pushRects(g_front, job.rects, job.count);
+}
+
+void drawFullFrame(const app::AppState& state) {
+  g_clip = kFullScreenRect;
+  drawScreen(state);
+  presentFrame(&kFullScreenRect, 1);
+  ++g_renderStats.fullFrames;
+}
+
+#if ATS_UI_VERIFY_PARTIAL
+// Redraws the whole frame over the partially updated sprite and compares. The sprite is left holding the
+// full redraw, which is also what the panel must show after the partial pushes.
+void verifyPartialFrame(const app::AppState& state) {
+  constexpr size_t kFrameBytes = static_cast<size_t>(kUiWidth) * kUiHeight * sizeof(uint16_t);
+  if (g_verifyFrame == nullptr) {
+    g_verifyFrame = static_cast<uint16_t*>(malloc(kFrameBytes));
+  }
+  const void* frame = g_spr.getPointer();
+  if (g_verifyFrame == nullptr || frame == nullptr) {
+    return;
+  }
+
+  memcpy(g_verifyFrame, frame, kFrameBytes);
+  drawScreen(state);
+  ++g_renderStats.verifiedFrames;
+  if (memcmp(g_verifyFrame, frame, kFrameBytes) != 0) {
+    ++g_renderStats.mismatchedFrames;
+    Serial.println("[ui] partial frame differs from full redraw");
+  }
+}
+#endif
+
+void drawPartialFrame(const app::AppState& state, uint16_t dirty) {
+  UiRect rects[kRegionCount];
+  const uint8_t count = collectDirtyRects(dirty, rects);
+  if (count == 0) {
+    return;
+  }
+
+  for (uint8_t i = 0; i < count; ++i) {
+    const UiRect& rect = rects[i];
+    g_clip = rect;
+    g_spr.setViewport(rect.x, rect.y, rect.w, rect.h, false);
+    drawScreen(state);
+    g_spr.resetViewport();
+  }
+  g_clip = kFullScreenRect;
+  ++g_renderStats.partialFrames;
+  g_renderStats.regions += count;
+
+#if ATS_UI_VERIFY_PARTIAL
+  verifyPartialFrame(state);
+#endif
+  presentFrame(rects, count);
 }
 
 }  // namespace
@@ -1713,6 +2187,21 @@ bool begin() {
   }
 
   g_spr.setSwapBytes(true);
+  g_frontReady = g_front.createSprite(kUiWidth, kUiHeight) != nullptr;
+  if (g_frontReady) {
+    g_front.setSwapBytes(true);
+    g_frameQueue = xQueueCreate(1, sizeof(FrameJob));
+    g_frameDone = xSemaphoreCreateBinary();
+    // Core 0 below the radio worker: streaming only fills the gaps between tuner commands.
+    if (g_frameQueue == nullptr || g_frameDone == nullptr ||
+        xTaskCreatePinnedToCore(displayTask, "ui_display", kDisplayStackBytes, nullptr, 1, &g_displayTask, 0) != pdPASS) {
+      g_displayTask = nullptr;
+      Serial.println("[ui] display task unavailable, pushing frames from loop");
+    }
+  } else {
+    Serial.println("[ui] no memory for a second frame buffer; single-buffered");
+  }
+
   g_spr.fillSprite(kColorBg);
   g_spr.setTextColor(kColorText, kColorBg);
   g_spr.setTextFont(2);
@@ -1753,7 +2242,8 @@ void showBoot(const char* message) {
   g_spr.drawString("ATS MINI", kUiWidth / 2, (kUiHeight / 2) - 12);
   g_spr.setTextFont(1);
   g_spr.drawString(message, kUiWidth / 2, (kUiHeight / 2) + 10);
-  g_spr.pushSprite(0, 0);
+  presentFrame(&kFullScreenRect, 1);
+  g_hasRenderKey = false;
 }
 
 void notifyVolumeAdjust(uint8_t volume) {
@@ -1809,6 +2299,7 @@ void render(const app::AppState& state) {
   }
 
   const UiRenderKey renderKey = buildRenderKey(state);
+  const bool stereo = stereoIndicator(state);
   const bool stateChanged = !g_hasRenderKey || !sameRenderKey(g_lastRenderKey, renderKey);
   const int32_t minuteToken = clockMinuteToken(state);
   const bool minuteChanged = g_lastRenderedMinute != minuteToken;
@@ -1826,7 +2317,38 @@ void render(const app::AppState& state) {
   }
 
   if (g_tftReady) {
-    drawScreen(state);
+    const uint32_t renderStartUs = micros();
+    if (!g_partialRedraw || !g_hasRenderKey || keepAliveDue || needsFullRedraw(state, g_lastRenderKey, renderKey)) {
+      drawFullFrame(state);
+    } else {
+      uint16_t dirty = dirtyRegions(g_lastRenderKey, renderKey);
+      if (signalChanged) {
+        dirty |= regionBit(UiRegion::Meters);
+        if (state.radio.modulation != app::Modulation::FM) {
+          dirty |= regionBit(UiRegion::RdsText);
+        }
+      }
+      if (stereo != g_lastStereo) {
+        dirty |= regionBit(UiRegion::Frequency);
+      }
+      if (batteryChanged) {
+        dirty |= regionBit(UiRegion::Battery);
+      }
+      if (minuteChanged) {
+        dirty |= regionBit(UiRegion::Clock);
+      }
+      if (volumeChanged || (volumeVisible && g_volumeHudValue != g_lastVolumeHudValue)) {
+        dirty |= regionBit(UiRegion::VolumeHud);
+      }
+      if (transientChanged) {
+        dirty |= regionBit(UiRegion::TransientHud);
+      }
+      drawPartialFrame(state, dirty);
+    }
+    g_renderStats.lastRenderUs = micros() - renderStartUs;
+    if (g_renderStats.lastRenderUs > g_renderStats.maxRenderUs) {
+      g_renderStats.maxRenderUs = g_renderStats.lastRenderUs;
+    }
   }
 
 #if ATS_UI_DEBUG_LOG
@@ -1842,6 +2364,13 @@ void render(const app::AppState& state) {
                   layerName(state.ui.layer),
                   static_cast<unsigned>(state.seekScan.foundCount),
                   static_cast<int>(state.seekScan.foundIndex));
+    Serial.printf("[ui] frame render=%luus max=%luus push=%luus max=%luus fence_waits=%lu max=%luus\n",
+                  static_cast<unsigned long>(g_renderStats.lastRenderUs),
+                  static_cast<unsigned long>(g_renderStats.maxRenderUs),
+                  static_cast<unsigned long>(g_lastPushUs.load(std::memory_order_relaxed)),
+                  static_cast<unsigned long>(g_maxPushUs.load(std::memory_order_relaxed)),
+                  static_cast<unsigned long>(g_renderStats.fenceWaits),
+                  static_cast<unsigned long>(g_renderStats.maxFenceWaitUs));
     g_lastSerialLogMs = nowMs;
   }
 #endif
@@ -1852,7 +2381,34 @@ void render(const app::AppState& state) {
   g_lastVolumeHudVisible = volumeVisible;
   g_lastTransientHudVisible = transientVisible;
   g_lastTransientTextHash = transientHash;
+  g_lastVolumeHudValue = g_volumeHudValue;
+  g_lastStereo = stereo;
   g_lastRenderMs = nowMs;
 }
 
+void setPartialRedraw(bool enabled) {
+  g_partialRedraw = enabled;
+  g_hasRenderKey = false;
+}
+
+void setBandscope(bool enabled) {
+  g_bandscopeEnabled = enabled;
+  g_hasRenderKey = false;
+}
+
+void renderStats(RenderStats* out) {
+  if (out != nullptr) {
+    *out = g_renderStats;
+    out->lastPushUs = g_lastPushUs.load(std::memory_order_relaxed);
+    out->maxPushUs = g_maxPushUs.load(std::memory_order_relaxed);
+    out->asyncPush = g_displayTask != nullptr;
+  }
+}
+
+void resetRenderStats() {
+  g_renderStats = RenderStats{};
+  g_lastPushUs.store(0, std::memory_order_relaxed);
+  g_maxPushUs.store(0, std::memory_order_relaxed);
+}
+
 }  // namespace services::ui